@@ -36,9 +36,12 @@ namespace Rendering
 	void KulaGameInstance::Initialize()
 	{
 		//Testing Deserializing JSON data to produce a Level
+		//The drawables belong to the old level's cubes and player, so they go with it
+		mDrawableObjects.Clear();
 		mLevel.reset();
 		mLevel = std::make_shared<Level>();
 		auto wrapper = std::make_shared<ScopeParseWrapper>(mLevel);
+		wrapper->CreateInBatches(Cube::TypeNameClass(), Level::CUBE_BATCH_SIZE);
 		auto coordinator = JsonParseCoordinator(wrapper);
 
 		coordinator.PushBackHelper(std::make_unique<ScopeJsonParse::AllScopeJsonParseHelper>());
@@ -46,6 +46,8 @@ namespace Rendering
 		FieaGameEngine::Level& GetLevel();
 
 		DirectX::XMFLOAT4X4 mWorldMatrix{ FieaGameEngine::MatrixHelper::Identity };
+		//Models of the level's cubes and player. Models are not scopes, so they cannot be held by ScopeHandle; they live as long as
+		//the level, and the vector is cleared whenever the level is replaced
 		FieaGameEngine::Vector<FieaGameEngine::BaseDrawableGameobject*> mDrawableObjects{};
 	private:
 		std::shared_ptr<FieaGameEngine::Level> mLevel;
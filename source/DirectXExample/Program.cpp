@@ -45,7 +45,7 @@ void CheckGameLoss(RenderingGame& game, EventQueue& Queue)
 
 void BasicGameLoop(RenderingGame& game, Player& CurrentPlayer, EventQueue& Queue)
 {
-	game.mScoreComponent.get()->SetScore(CurrentPlayer["Score"].GetIntegerElement());
+	game.mScoreComponent.get()->SetScore(Player::SCORE_HANDLE(CurrentPlayer).GetIntegerElement());
 	//This is a test for the reaction system.
 	if (GameplayState::Singleton().GetTime().TotalGameTimeSeconds().count() > 5.0f && GameplayState::Singleton().GetTime().TotalGameTimeSeconds().count() < 6.0f)
 	{
@@ -59,7 +59,7 @@ void BasicGameLoop(RenderingGame& game, Player& CurrentPlayer, EventQueue& Queue
 	}
 }
 
-int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int showCommand)
+int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR commandLine, int showCommand)
 {
 #if defined(DEBUG) | defined(_DEBUG)
 	_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
@@ -69,6 +69,16 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int showCommand)
 
 	current_path(UtilityWin32::ExecutableDirectory());
 
+	//Running with --convert-content writes the binary form of the game's content, then exits
+	if (string(commandLine).find("--convert-content"s) != string::npos)
+	{
+		GameSetup();
+		ConvertContentToBinary();
+		GameFree();
+		CoUninitialize();
+		return 0;
+	}
+
 	const wstring windowClassName = L"RenderingClass"s;
 	const wstring windowTitle = L"Kula World"s;
 
@@ -128,12 +138,12 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int showCommand)
 			}
 			else if (game.InEndScreen) //End Screen behavior
 			{
-				game.InEndScreen = !game.RenderEndScreen(GameplayState::Singleton().GetTime(), CurrentPlayer["Score"].GetIntegerElement(), 0);
+				game.InEndScreen = !game.RenderEndScreen(GameplayState::Singleton().GetTime(), Player::SCORE_HANDLE(CurrentPlayer).GetIntegerElement(), 0);
 				game.InMenu = true;
 			}
 			else if(game.InMenu) //Level Select/Start Screen behavior
 			{
-				CurrentPlayer["Score"].SetElement(0);
+				Player::SCORE_HANDLE(CurrentPlayer).SetElement(0);
 				game.LevelSelected = false;
 				game.InMenu = !game.RenderStartScreen(GameplayState::Singleton().GetTime());
 			}
@@ -0,0 +1,339 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <sstream>
+#include "JsonParseCoordinator.h"
+#include "ScopeParseWrapper.h"
+#include "AllScopeJsonParseHelper.h"
+#include "ScopeJsonKeyTokenTransmuter.h"
+#include "ToStringSpecializations.h"
+#include "AttributedSignatureRegistry.h"
+#include "ActionExpression.h"
+#include "ActionIncrement.h"
+#include "ActionList.h"
+#include "GameObject.h"
+#include "GameplayState.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace FieaGameEngine::ScopeJsonParse;
+using namespace FieaGameEngine::Actions;
+using namespace std::literals::string_literals;
+
+namespace LibraryDesktopTests {
+    TEST_CLASS(ActionProfilerTests) {
+
+    private:
+        inline static _CrtMemState _startMemState;
+
+        using size_type = ActionProfiler::size_type;
+
+        /// <summary>
+        /// Scene with an action named Step, an unnamed increment and an expression action named Sum.
+        /// </summary>
+        static void CreateScene(GameObject& scene) {
+            scene.CreateAction("ActionIncrement"s, "Step"s);
+            scene.CreateAction("ActionIncrement"s, ""s);
+            scene.CreateAction("ActionExpression"s, "Sum"s).At("Expression"s).SetElement("1 2 +"s);
+        }
+
+    public:
+        TEST_METHOD_INITIALIZE(Initialize) {
+            AttributedSignatureRegistry::RegisterSignatures<Transform>();
+            AttributedSignatureRegistry::RegisterSignatures<GameObject>();
+            AttributedSignatureRegistry::RegisterSignatures<Action>();
+            AttributedSignatureRegistry::RegisterSignatures<ActionExpression, Action>();
+            AttributedSignatureRegistry::RegisterSignatures<ActionIncrement, Action>();
+            AttributedSignatureRegistry::RegisterSignatures<ActionList, Action>();
+            ScopeFactory::Register();
+            TransformFactory::Register();
+            GameObjectFactory::Register();
+            ActionExpressionFactory::Register();
+            ActionListFactory::Register();
+            ActionIncrementFactory::Register();
+
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+            _CrtMemCheckpoint(&_startMemState);
+    #endif
+        }
+
+        TEST_METHOD_CLEANUP(Cleanup) {
+            GameplayState::DestroySingleton();
+            GameplayState::CreateSingleton();
+
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtMemState endMemState, diffMemState;
+            _CrtMemCheckpoint(&endMemState);
+
+            if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState)) {
+                _CrtMemDumpStatistics(&diffMemState);
+                Assert::Fail(L"Memory Leaks!");
+            }
+    #endif
+
+            ActionIncrementFactory::Unregister();
+            ActionListFactory::Unregister();
+            ActionExpressionFactory::Unregister();
+            GameObjectFactory::Unregister();
+            TransformFactory::Unregister();
+            ScopeFactory::Unregister();
+            AttributedSignatureRegistry::UnregisterSignatures<ActionList>();
+            AttributedSignatureRegistry::UnregisterSignatures<ActionIncrement>();
+            AttributedSignatureRegistry::UnregisterSignatures<ActionExpression>();
+            AttributedSignatureRegistry::UnregisterSignatures<Action>();
+            AttributedSignatureRegistry::UnregisterSignatures<GameObject>();
+            AttributedSignatureRegistry::UnregisterSignatures<Transform>();
+        }
+
+        TEST_METHOD(Disabled) {
+            ActionProfiler& profiler = GameplayState::Singleton().Profiler();
+            GameObject scene{"Scene"s};
+            CreateScene(scene);
+
+            Assert::IsFalse(profiler.IsEnabled());
+            Assert::IsFalse(profiler.IsTracing());
+
+            scene.Update(GameTime{});
+
+            Assert::IsTrue(profiler.Records().IsEmpty());
+            Assert::IsTrue(profiler.Hottest(size_type(3)).IsEmpty());
+
+            profiler.Enable();
+            profiler.Disable();
+            scene.Update(GameTime{});
+
+            Assert::IsFalse(profiler.IsEnabled());
+            Assert::IsTrue(profiler.Records().IsEmpty());
+        }
+
+        TEST_METHOD(WithoutGameplayState) {
+            GameplayState::DestroySingleton();
+            Assert::IsNull(ActionProfiler::Enabled());
+
+            GameObject scene{"Scene"s};
+            // Lists are all that update without the gameplay state, as other actions search its argument stack.
+            scene.CreateAction("ActionList"s, "Idle"s);
+            scene.CreateAction("ActionList"s, "Think"s);
+            scene.Update(GameTime{});
+
+            ActionProfiler profiler{};
+            profiler.Enable();
+            Assert::IsTrue(ActionProfiler::Enabled() == &profiler);
+
+            scene.Update(GameTime{});
+
+            Assert::AreEqual(size_type(1), profiler.Find("Idle"s)->calls);
+            Assert::AreEqual(size_type(1), profiler.Find("Think"s)->calls);
+
+            // Only one profiler records at a time.
+            ActionProfiler other{};
+            other.Enable();
+            Assert::IsFalse(profiler.IsEnabled());
+            Assert::IsTrue(other.IsEnabled());
+
+            scene.Update(GameTime{});
+
+            Assert::AreEqual(size_type(1), profiler.Find("Idle"s)->calls);
+            Assert::AreEqual(size_type(1), other.Find("Idle"s)->calls);
+
+            other.Disable();
+            Assert::IsNull(ActionProfiler::Enabled());
+        }
+
+        TEST_METHOD(SampleOutlivesProfiler) {
+            ActionList idle{"Idle"s};
+
+            {
+                auto profiler = std::make_unique<ActionProfiler>();
+                profiler->Enable();
+
+                ActionProfiler::Sample sample{idle};
+                profiler.reset();
+                Assert::IsNull(ActionProfiler::Enabled());
+            }
+
+            // Samples still open when their profiler is switched off are discarded.
+            ActionProfiler profiler{};
+            profiler.Enable();
+
+            {
+                ActionProfiler::Sample outer{idle};
+                ActionProfiler::Sample inner{idle};
+                profiler.Disable();
+                profiler.Enable();
+            }
+
+            Assert::IsNull(profiler.Find("Idle"s));
+
+            {
+                ActionProfiler::Sample sample{idle};
+            }
+
+            Assert::AreEqual(size_type(1), profiler.Find("Idle"s)->calls);
+        }
+
+        TEST_METHOD(ExcludesOwnAllocations) {
+            ActionList outer{"Outer"s};
+            ActionList inner{"An inner action named well beyond the small string buffer"s};
+            ActionProfiler profiler{};
+            profiler.Enable(true);
+
+            {
+                ActionProfiler::Sample sample{outer};
+
+                for (int i = 0; i < 3; ++i) {
+                    ActionProfiler::Sample nested{inner};
+                    ActionProfiler::CountCompile(inner);
+                }
+            }
+
+            Assert::AreEqual(size_type(0), profiler.Find("Outer"s)->allocations);
+            Assert::AreEqual(size_type(0), profiler.Find(inner.GetName())->allocations);
+            Assert::AreEqual(size_type(3), profiler.Find(inner.GetName())->compiles);
+        }
+
+        TEST_METHOD(RecordsActionsByName) {
+            ActionProfiler& profiler = GameplayState::Singleton().Profiler();
+            GameObject scene{"Scene"s};
+            CreateScene(scene);
+
+            profiler.Enable();
+            Assert::IsTrue(profiler.IsEnabled());
+            Assert::IsFalse(profiler.IsTracing());
+
+            for (int i = 0; i < 3; ++i) {
+                scene.Update(GameTime{});
+            }
+
+            Assert::AreEqual(size_type(3), profiler.Records().Size());
+            Assert::IsNull(profiler.Find("Scene"s));
+
+            const auto* step = profiler.Find("Step"s);
+            Assert::IsNotNull(step);
+            Assert::AreEqual(size_type(3), step->calls);
+            Assert::AreEqual(size_type(0), step->compiles);
+            Assert::IsTrue(step->max <= step->total);
+
+            const auto* unnamed = profiler.Find(ActionIncrement::TypeNameClass());
+            Assert::IsNotNull(unnamed);
+            Assert::AreEqual(size_type(3), unnamed->calls);
+
+            const auto* sum = profiler.Find("Sum"s);
+            Assert::IsNotNull(sum);
+            Assert::AreEqual(size_type(3), sum->calls);
+            Assert::AreEqual(size_type(1), sum->compiles);
+
+            const auto hottest = profiler.Hottest(size_type(2));
+            Assert::AreEqual(size_type(2), hottest.Size());
+            Assert::IsTrue(hottest[0]->second.total >= hottest[1]->second.total);
+            Assert::AreEqual(size_type(3), profiler.Hottest(size_type(10)).Size());
+
+            profiler.Clear();
+            Assert::IsTrue(profiler.IsEnabled());
+            Assert::IsTrue(profiler.Records().IsEmpty());
+        }
+
+        TEST_METHOD(Write) {
+            ActionProfiler& profiler = GameplayState::Singleton().Profiler();
+            GameObject scene{"Scene"s};
+            CreateScene(scene);
+
+            {
+                std::stringstream csv{}, json{}, trace{};
+                profiler.WriteCsv(csv);
+                profiler.WriteJson(json);
+                profiler.WriteChromeTrace(trace);
+
+                Assert::AreEqual("name,calls,total_us,max_us,allocations,compiles\n"s, csv.str());
+                Assert::AreEqual("[]\n"s, json.str());
+                Assert::AreEqual("{ \"displayTimeUnit\": \"ms\", \"traceEvents\": [] }\n"s, trace.str());
+            }
+
+            profiler.Enable(true);
+            Assert::IsTrue(profiler.IsTracing());
+
+            scene.Update(GameTime{});
+            scene.Update(GameTime{});
+
+            std::stringstream csv{}, json{}, trace{};
+            profiler.WriteCsv(csv);
+            profiler.WriteJson(json);
+            profiler.WriteChromeTrace(trace);
+
+            std::string line{};
+            size_type lines = 0;
+            while (std::getline(csv, line)) {
+                ++lines;
+            }
+
+            Assert::AreEqual(size_type(4), lines);
+            Assert::AreNotEqual(std::string::npos, csv.str().find("\"Sum\",2,"s));
+            Assert::AreNotEqual(std::string::npos, json.str().find("{ \"name\": \"Step\", \"calls\": 2, "s));
+            Assert::AreNotEqual(std::string::npos, json.str().find("\"compiles\": 1 }"s));
+
+            size_type events = 0;
+            for (auto found = trace.str().find("\"ph\": \"X\""s); found != std::string::npos; found = trace.str().find("\"ph\": \"X\""s, found + 1)) {
+                ++events;
+            }
+
+            Assert::AreEqual(size_type(6), events);
+            Assert::AreNotEqual(std::string::npos, trace.str().find("{ \"name\": \"Sum\", \"cat\": \"action\", "s));
+        }
+
+        /// <summary>
+        /// Headless profiling harness: loads a level, ticks it and logs its hottest actions.
+        /// </summary>
+        TEST_METHOD(HottestActionsOfLevel) {
+            constexpr int TICK_COUNT = 1000;
+            constexpr size_type HOTTEST_COUNT = 3;
+
+            auto root = std::make_shared<Scope>();
+            auto wrapper = std::make_shared<ScopeParseWrapper>(root);
+            wrapper->CreateShuntingYardParser();
+            auto coordinator = JsonParseCoordinator(wrapper);
+
+            Assert::IsTrue(coordinator.PushBackHelper(std::make_unique<AllScopeJsonParseHelper>()));
+            Assert::IsTrue(coordinator.PushBackTransmuter(std::make_unique<ScopeJsonKeyTokenTransmuter>()));
+
+            coordinator.DeserializeIntoWrapperFromFile(R"(Files\TestActionProfileLevel.json)"s);
+
+            auto& scene = static_cast<GameObject&>(root->At("Scene"s).FrontTable());
+            ActionProfiler& profiler = GameplayState::Singleton().Profiler();
+            profiler.Enable();
+
+            for (int i = 0; i < TICK_COUNT; ++i) {
+                scene.Update(GameTime{});
+            }
+
+            profiler.Disable();
+
+            Assert::AreEqual(TICK_COUNT, scene.At("Counter"s).FrontInteger());
+            Assert::AreEqual(size_type(5), profiler.Records().Size());
+
+            for (const auto& name : {"Tick"s, "Think"s, "Count"s, "Spin"s, ActionExpression::TypeNameClass()}) {
+                const auto* record = profiler.Find(name);
+                Assert::IsNotNull(record);
+                Assert::AreEqual(size_type(TICK_COUNT), record->calls);
+            }
+
+            // The list's time includes the time of the actions it updates.
+            Assert::IsTrue(profiler.Find("Think"s)->total >= (profiler.Find("Count"s)->total + profiler.Find("Spin"s)->total));
+            Assert::AreEqual(size_type(1), profiler.Find("Spin"s)->compiles);
+
+            const auto hottest = profiler.Hottest(HOTTEST_COUNT);
+            Assert::AreEqual(HOTTEST_COUNT, hottest.Size());
+            Assert::AreEqual("Think"s, hottest[0]->first);
+
+            std::stringstream report{};
+            report << "Hottest actions over "s << TICK_COUNT << " ticks:\n"s;
+
+            for (const auto* pair : hottest) {
+                report << "  "s << pair->first << ": "s << pair->second.calls << " calls, "s
+                    << std::chrono::duration_cast<std::chrono::microseconds>(pair->second.total).count() << "us total, "s
+                    << pair->second.max.count() << "ns max, "s << pair->second.allocations << " allocations\n"s;
+            }
+
+            Logger::WriteMessage(report.str().c_str());
+        }
+    };
+}
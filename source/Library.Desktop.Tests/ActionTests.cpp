@@ -313,5 +313,26 @@ namespace LibraryDesktopTests {
             Assert::IsTrue(FloatsAreEquivalent(0.f, angle.CFrontFloat()));
             Assert::IsTrue(FloatsAreEquivalent(angle.CFrontFloat(), setAngle.GetLastResult().CFrontFloat()));
         }
+
+        TEST_METHOD(CompileExpression) {
+            GameObject scene{"Scene"s};
+            auto* action = scene.CreateAction("ActionExpression"s, "Bad"s).As<ActionExpression>();
+
+            Assert::IsNotNull(action);
+
+            // Nothing to compile yet.
+            action->Compile();
+
+            // Typed against the parent when compiled, before the first update.
+            action->SetReversePolishNotatedExpression("Name 1 -"s);
+            Assert::ExpectException<std::invalid_argument>([action]() { action->Compile(); });
+            Assert::IsTrue(action->GetLastResult().IsEmpty());
+
+            action->SetReversePolishNotatedExpression("Name Name +"s);
+            action->Compile();
+            scene.Update(GameTime{});
+
+            Assert::AreEqual("SceneScene"s, action->GetLastResult().CFrontString());
+        }
     };
 }
\ No newline at end of file
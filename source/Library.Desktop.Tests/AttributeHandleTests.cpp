@@ -0,0 +1,129 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <chrono>
+#include "AttributeHandle.h"
+#include "AttributedTestMonster.h"
+#include "Benchmark.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::literals::string_literals;
+
+namespace LibraryDesktopTests {
+    TEST_CLASS(AttributeHandleTests) {
+
+    private:
+        inline static _CrtMemState _startMemState;
+
+        using size_type = Datum::size_type;
+        using clock = std::chrono::high_resolution_clock;
+
+        inline static const std::size_t BENCHMARK_COUNT = 100000;
+
+    public:
+        TEST_METHOD_INITIALIZE(Initialize) {
+            AttributedSignatureRegistry::RegisterSignatures<AttributedThing>();
+            AttributedSignatureRegistry::RegisterSignatures<AttributedTestMonster, AttributedThing>();
+
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+            _CrtMemCheckpoint(&_startMemState);
+    #endif
+        }
+
+        TEST_METHOD_CLEANUP(Cleanup) {
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtMemState endMemState, diffMemState;
+            _CrtMemCheckpoint(&endMemState);
+
+            if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState)) {
+                _CrtMemDumpStatistics(&diffMemState);
+                Assert::Fail(L"Memory Leaks!");
+            }
+    #endif
+
+            AttributedSignatureRegistry::UnregisterSignatures<AttributedTestMonster>();
+            AttributedSignatureRegistry::UnregisterSignatures<AttributedThing>();
+        }
+
+        TEST_METHOD(Index) {
+            const AttributeHandle<AttributedThing> level{"Level"s};
+            const AttributeHandle<AttributedThing> transform{"Transform"s};
+            const AttributeHandle<AttributedTestMonster> reward{"Reward"s};
+
+            Assert::AreEqual("Level"s, level.Key());
+            Assert::AreEqual(size_type(1), level.Index());
+            Assert::AreEqual(size_type(5), transform.Index());
+            Assert::AreEqual(size_type(7), reward.Index());
+        }
+
+        TEST_METHOD(Access) {
+            const AttributeHandle<AttributedThing> level{"Level"s};
+            const AttributeHandle<AttributedThing> health{"CurrentHealth"s};
+            const AttributeHandle<AttributedTestMonster> message{"EntryMessage"s};
+
+            AttributedThing thing{};
+            thing.LevelUp();
+            Assert::AreSame(thing["Level"s], level(thing));
+            Assert::AreEqual(1, level(thing).FrontInteger());
+
+            health(thing).SetElement(50.f);
+            Assert::AreEqual(50.f, thing.CurrentHealth());
+
+            // Members are written without their datums being told, so the content hash must not be reused.
+            const size_type before = thing.ContentHash();
+            thing.LevelUp();
+            Assert::AreNotEqual(before, thing.ContentHash());
+            Assert::AreEqual(2, level(thing).FrontInteger());
+
+            const AttributedThing& constThing = thing;
+            Assert::AreSame(constThing["CurrentHealth"s], health(constThing));
+
+            AttributedTestMonster monster{};
+            Assert::AreSame(monster["Level"s], level(monster));
+            Assert::AreSame(monster["EntryMessage"s], message(monster));
+        }
+
+        TEST_METHOD(Unresolvable) {
+            const AttributeHandle<AttributedThing> missing{"EntryMessage"s};
+            const AttributeHandle<AttributedThing> auxiliary{"Auxiliary"s};
+
+            Assert::ExpectException<std::invalid_argument>([&missing]() { auto _ = missing.Index(); UNREFERENCED_LOCAL(_); });
+
+            AttributedThing thing{};
+            thing.AppendAuxiliaryAttribute("Auxiliary"s) = 1;
+            Assert::ExpectException<std::invalid_argument>([&auxiliary, &thing]() { auto& _ = auxiliary(thing); UNREFERENCED_LOCAL(_); });
+
+            const AttributeHandle<Attributed> unregistered{"Level"s};
+            Assert::ExpectException<std::logic_error>([&unregistered]() { auto _ = unregistered.Index(); UNREFERENCED_LOCAL(_); });
+        }
+
+        BENCHMARK_METHOD(BenchmarkAccess) {
+            const AttributeHandle<AttributedThing> level{"Level"s};
+            AttributedThing byKey{};
+            AttributedThing byHandle{};
+
+            auto start = clock::now();
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                byKey.At("Level"s).SetElement(byKey.At("Level"s).GetIntegerElement() + 1);
+            }
+            auto byKeyTime = clock::now() - start;
+
+            start = clock::now();
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                Datum& datum = level(byHandle);
+                datum.SetElement(datum.GetIntegerElement() + 1);
+            }
+            auto byHandleTime = clock::now() - start;
+
+            Assert::AreEqual(byKey.Level(), byHandle.Level());
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Incrementing "s + std::to_string(BENCHMARK_COUNT) + " times, by key: "s
+                + std::to_string(duration_cast<microseconds>(byKeyTime).count()) + "us, by handle: "s
+                + std::to_string(duration_cast<microseconds>(byHandleTime).count()) + "us\n"s).c_str());
+        }
+    };
+}
@@ -0,0 +1,256 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <chrono>
+#include <vector>
+#include "AttributedArchetypeStore.h"
+#include "AttributedThing.h"
+#include "Benchmark.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::literals::string_literals;
+
+namespace LibraryDesktopTests {
+    TEST_CLASS(AttributedArchetypeStoreTests) {
+
+    private:
+        inline static _CrtMemState _startMemState;
+
+        using size_type = Datum::size_type;
+        using DatumType = Datum::DatumType;
+        using Matrix = Datum::Matrix;
+        using clock = std::chrono::high_resolution_clock;
+
+        inline static const std::size_t BENCHMARK_COUNT = 10000;
+
+        static std::size_t OffsetOf(const Attributed::key_type& key) {
+            auto signatures = AttributedSignatureRegistry::FindSignatures(AttributedThing::TypeIdClass());
+
+            for (const auto& signature : signatures->second) {
+                if (signature.Key() == key) {
+                    return signature.MemoryOffset();
+                }
+            }
+
+            Assert::Fail(L"Signature not found!");
+            return std::size_t(0);
+        }
+
+    public:
+        TEST_METHOD_INITIALIZE(Initialize) {
+            AttributedSignatureRegistry::RegisterSignatures<AttributedThing>();
+
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+            _CrtMemCheckpoint(&_startMemState);
+    #endif
+        }
+
+        TEST_METHOD_CLEANUP(Cleanup) {
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtMemState endMemState, diffMemState;
+            _CrtMemCheckpoint(&endMemState);
+
+            if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState)) {
+                _CrtMemDumpStatistics(&diffMemState);
+                Assert::Fail(L"Memory Leaks!");
+            }
+    #endif
+
+            AttributedSignatureRegistry::UnregisterSignatures<AttributedThing>();
+        }
+
+        TEST_METHOD(Constructor) {
+            AttributedArchetypeStore store{AttributedThing::TypeIdClass(), size_type(4)};
+
+            Assert::AreEqual(AttributedThing::TypeIdClass(), store.Archetype());
+            Assert::AreEqual(size_type(0), store.Size());
+            Assert::IsTrue(store.IsEmpty());
+            Assert::AreEqual(size_type(5), store.ColumnCount());
+            Assert::IsTrue(store.IsColumn(OffsetOf("Level"s)));
+            Assert::IsTrue(store.IsColumn(OffsetOf("CurrentHealth"s)));
+            Assert::IsTrue(store.IsColumn(OffsetOf("Transform"s)));
+            Assert::IsFalse(store.IsColumn(std::size_t(0)));
+            Assert::IsTrue(store.MemoryFootprint() >= (size_type(4) * (sizeof(int) * 2 + sizeof(float) * 2 + sizeof(Matrix))));
+
+            Assert::ExpectException<std::logic_error>([]() { AttributedArchetypeStore _{Scope::TypeIdClass()}; UNREFERENCED_LOCAL(_); });
+        }
+
+        TEST_METHOD(PushBackAndCopyTo) {
+            AttributedArchetypeStore store{AttributedThing::TypeIdClass()};
+            AttributedThing first{3, 10, 50.f, 25.f, Matrix{1.f}};
+            AttributedThing second{7, 20, 80.f, 80.f, Matrix{2.f}};
+
+            Assert::AreEqual(size_type(0), store.PushBack(first));
+            Assert::AreEqual(size_type(1), store.PushBack(second));
+            Assert::AreEqual(size_type(2), store.Size());
+
+            const auto* levels = store.CColumnData<Datum::Integer>(OffsetOf("Level"s));
+            const auto* health = store.CColumnData<Datum::Float>(OffsetOf("CurrentHealth"s));
+            Assert::AreEqual(3, levels[0]);
+            Assert::AreEqual(7, levels[1]);
+            Assert::AreEqual(25.f, health[0]);
+            Assert::AreEqual(80.f, health[1]);
+            Assert::AreEqual(size_type(2), store.CColumn(OffsetOf("Transform"s)).Size());
+
+            Assert::ExpectException<std::invalid_argument>([&store]() { auto _ = store.CColumnData<Datum::Float>(OffsetOf("Level"s)); UNREFERENCED_LOCAL(_); });
+            Assert::ExpectException<std::out_of_range>([&store]() { auto _ = store.CColumnData<Datum::Float>(std::size_t(0)); UNREFERENCED_LOCAL(_); });
+
+            store.ColumnData<Datum::Float>(OffsetOf("CurrentHealth"s))[1] = 5.f;
+
+            AttributedThing copy{};
+            store.CopyTo(size_type(1), copy);
+            Assert::AreEqual(7, copy.Level());
+            Assert::AreEqual(20, copy.MaxLevel());
+            Assert::AreEqual(80.f, copy.MaxHealth());
+            Assert::AreEqual(5.f, copy.CurrentHealth());
+            Assert::IsTrue(Matrix{2.f} == copy.Transform());
+            Assert::AreEqual(5.f, copy["CurrentHealth"s].FrontFloat());
+
+            Assert::ExpectException<std::out_of_range>([&store, &copy]() { store.CopyTo(size_type(2), copy); });
+        }
+
+        TEST_METHOD(EmplaceBackRemoveAtPopBackClear) {
+            AttributedArchetypeStore store{AttributedThing::TypeIdClass()};
+            AttributedThing thing{9, 99, 10.f, 10.f, Matrix{1.f}};
+
+            Assert::AreEqual(size_type(0), store.EmplaceBack());
+            Assert::AreEqual(size_type(1), store.PushBack(thing));
+            Assert::AreEqual(size_type(2), store.EmplaceBack());
+            Assert::AreEqual(0, store.CColumnData<Datum::Integer>(OffsetOf("Level"s))[0]);
+
+            store.RemoveAt(size_type(0));
+            Assert::AreEqual(size_type(2), store.Size());
+            Assert::AreEqual(0, store.CColumnData<Datum::Integer>(OffsetOf("Level"s))[0]);
+            Assert::AreEqual(9, store.CColumnData<Datum::Integer>(OffsetOf("Level"s))[1]);
+
+            store.RemoveAt(size_type(0));
+            Assert::AreEqual(size_type(1), store.Size());
+            Assert::AreEqual(9, store.CColumnData<Datum::Integer>(OffsetOf("Level"s))[0]);
+            Assert::ExpectException<std::out_of_range>([&store]() { store.RemoveAt(size_type(1)); });
+
+            store.PopBack();
+            Assert::IsTrue(store.IsEmpty());
+            store.PopBack();
+            Assert::IsTrue(store.IsEmpty());
+
+            store.EmplaceBack();
+            store.EmplaceBack();
+            store.Clear();
+            Assert::IsTrue(store.IsEmpty());
+            Assert::AreEqual(size_type(0), store.CColumn(OffsetOf("MaxLevel"s)).Size());
+        }
+
+        TEST_METHOD(View) {
+            AttributedArchetypeStore store{AttributedThing::TypeIdClass(), size_type(2)};
+            store.PushBack(AttributedThing{1, 10, 100.f, 90.f, Matrix{1.f}});
+            store.PushBack(AttributedThing{2, 20, 200.f, 180.f, Matrix{2.f}});
+
+            Scope view = store.View(size_type(1));
+            Assert::AreEqual(size_type(5), view.Size());
+            Assert::IsFalse(view["Level"s].IsDataInternal());
+            Assert::AreEqual(2, view["Level"s].FrontInteger());
+            Assert::AreEqual(180.f, view["CurrentHealth"s].FrontFloat());
+
+            view["CurrentHealth"s].SetElement(170.f);
+            Assert::AreEqual(170.f, store.CColumnData<Datum::Float>(OffsetOf("CurrentHealth"s))[1]);
+
+            store.BindView(view, size_type(0));
+            Assert::AreEqual(size_type(5), view.Size());
+            Assert::AreEqual(1, view["Level"s].FrontInteger());
+            Assert::AreEqual(90.f, view["CurrentHealth"s].FrontFloat());
+            Assert::IsTrue(Matrix{1.f} == view["Transform"s].FrontMatrix());
+
+            Assert::ExpectException<std::out_of_range>([&store, &view]() { store.BindView(view, size_type(2)); });
+
+            // Writes through column data bypass the view's datums, so the view must never reuse a stale content hash.
+            const size_type before = view.ContentHash();
+            store.ColumnData<Datum::Integer>(OffsetOf("Level"s))[0] = 3;
+            Assert::AreNotEqual(before, view.ContentHash());
+            Assert::IsFalse(view == store.View(size_type(1)));
+        }
+
+        TEST_METHOD(ColumnDataUnshares) {
+            AttributedArchetypeStore store{AttributedThing::TypeIdClass()};
+            store.PushBack(AttributedThing{1, 10, 100.f, 90.f, Matrix{1.f}});
+
+            Datum::SharingCopies sharing{};
+            const Datum copy = store.CColumn(OffsetOf("Level"s));
+            store.ColumnData<Datum::Integer>(OffsetOf("Level"s))[0] = 2;
+
+            Assert::AreEqual(1, copy.FrontInteger());
+            Assert::AreEqual(2, store.CColumn(OffsetOf("Level"s)).FrontInteger());
+            Assert::IsFalse(copy == store.CColumn(OffsetOf("Level"s)));
+        }
+
+        BENCHMARK_METHOD(BenchmarkMemoryPerInstance) {
+            std::size_t storeBytes = 0, instanceBytes = 0;
+
+            {
+    #if defined(DEBUG) || defined(_DEBUG)
+                _CrtMemState before, after;
+                _CrtMemCheckpoint(&before);
+    #endif
+                std::vector<std::unique_ptr<AttributedThing>> things;
+                things.reserve(BENCHMARK_COUNT);
+                for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                    things.emplace_back(std::make_unique<AttributedThing>());
+                }
+    #if defined(DEBUG) || defined(_DEBUG)
+                _CrtMemCheckpoint(&after);
+                instanceBytes = after.lSizes[_NORMAL_BLOCK] - before.lSizes[_NORMAL_BLOCK];
+    #else
+                instanceBytes = BENCHMARK_COUNT * sizeof(AttributedThing);
+    #endif
+            }
+
+            {
+                AttributedArchetypeStore store{AttributedThing::TypeIdClass(), BENCHMARK_COUNT};
+                for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                    store.EmplaceBack();
+                }
+                storeBytes = store.MemoryFootprint();
+            }
+
+            Assert::IsTrue(storeBytes < instanceBytes);
+            Logger::WriteMessage(("Bytes per instance, Attributed: "s + std::to_string(instanceBytes / BENCHMARK_COUNT)
+                + ", archetype store: "s + std::to_string(storeBytes / BENCHMARK_COUNT) + "\n"s).c_str());
+        }
+
+        BENCHMARK_METHOD(BenchmarkIteration) {
+            const auto offset = OffsetOf("CurrentHealth"s);
+            std::vector<std::unique_ptr<AttributedThing>> things;
+            AttributedArchetypeStore store{AttributedThing::TypeIdClass(), BENCHMARK_COUNT};
+            things.reserve(BENCHMARK_COUNT);
+
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                things.emplace_back(std::make_unique<AttributedThing>(0, 99, 100.f, float(i % 100), Matrix{1.f}));
+                store.PushBack(*things.back());
+            }
+
+            auto start = clock::now();
+            float byName = 0.f;
+            for (auto& thing : things) {
+                byName += thing->At("CurrentHealth"s).FrontFloat();
+            }
+            auto byNameTime = clock::now() - start;
+
+            start = clock::now();
+            float byColumn = 0.f;
+            const auto* health = store.CColumnData<Datum::Float>(offset);
+            for (size_type i = 0; i < store.Size(); ++i) {
+                byColumn += health[i];
+            }
+            auto byColumnTime = clock::now() - start;
+
+            Assert::AreEqual(byName, byColumn);
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Summing "s + std::to_string(BENCHMARK_COUNT) + " attributes, by name: "s
+                + std::to_string(duration_cast<microseconds>(byNameTime).count()) + "us, by column: "s
+                + std::to_string(duration_cast<microseconds>(byColumnTime).count()) + "us\n"s).c_str());
+        }
+    };
+}
@@ -10,8 +10,10 @@
 #include "JsonParseCoordinator.h"
 #include "ScopeParseWrapper.h"
 #include "AllScopeJsonParseHelper.h"
+#include "Benchmark.h"
 #include "ScopeJsonKeyTokenTransmuter.h"
 #include "ToStringSpecializations.h"
+#include <regex>
 #include <thread>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -27,6 +29,56 @@ namespace LibraryDesktopTests {
         inline static _CrtMemState _startMemState;
 
         using size_type = Scope::size_type;
+        using clock = std::chrono::high_resolution_clock;
+
+        inline static const std::size_t BENCHMARK_REACTION_COUNT = 1000;
+        inline static const std::size_t BENCHMARK_EVENT_COUNT = 10000;
+
+        /// <summary>
+        /// Events the benchmark compiles every regex for, as compiling them for every event would take minutes.
+        /// </summary>
+        inline static const std::size_t BENCHMARK_COMPILED_EVENT_COUNT = 100;
+
+        /// <summary>
+        /// Gives the reaction an increment action, so the increment counts how often it reacts.
+        /// </summary>
+        static Actions::ActionIncrement& AppendCounter(AttributedReaction& reaction) {
+            return static_cast<Actions::ActionIncrement&>(reaction.AppendScope("Actions"s, Actions::ActionIncrement::TypeNameClass()));
+        }
+
+        /// <summary>
+        /// Reaction which turns down every event while it is refusing, whatever its subtype.
+        /// </summary>
+        class RefusingReaction final : public AttributedReaction {
+
+        public:
+            bool isRefusing{false};
+
+            [[nodiscard]] bool IsReactingTo(const IEventArgs& args) const override { return !isRefusing && AttributedReaction::IsReactingTo(args); }
+
+        };
+
+        /// <summary>
+        /// Reaction which unregisters its target and registers it again the next time it reacts.
+        /// </summary>
+        class ReregisteringReaction final : public AttributedReaction {
+
+        public:
+            AttributedReaction* target{nullptr};
+
+        protected:
+            void ReactBeforeActionList(const IEventArgs& args) override {
+                AttributedReaction::ReactBeforeActionList(args);
+
+                if (target != nullptr) {
+                    auto& index = GameplayState::Singleton().ReactionIndex();
+                    index.Unregister(*target);
+                    index.Register(*target);
+                    target = nullptr;
+                }
+            }
+
+        };
 
     public:
         TEST_METHOD_INITIALIZE(Initialize) {
@@ -49,6 +101,10 @@ namespace LibraryDesktopTests {
             AttributedEventArgsFactory::Register();
 
             Event::CreateSubscriptionsSingleton();
+
+            // The reaction index subscribes once, so it is recreated along with the subscriptions it subscribes to.
+            GameplayState::DestroySingleton();
+            GameplayState::CreateSingleton();
     #if defined(DEBUG) || defined(_DEBUG)
             _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
             _CrtMemCheckpoint(&_startMemState);
@@ -166,6 +222,13 @@ namespace LibraryDesktopTests {
             Assert::AreEqual(SUBTYPE, args.Subtype());
             Assert::AreEqual(SUBTYPE, args.CAt(SUBTYPE).CFrontString());
 
+            const IEventArgs& eventArgs = args;
+            Assert::IsTrue(eventArgs.Is<AttributedEventArgs>());
+            Assert::IsTrue(eventArgs.Is<Attributed>());
+            Assert::IsTrue(eventArgs.Is<IEventArgs>());
+            Assert::IsTrue(eventArgs.Is(IEventArgs::TypeIdClass()));
+            Assert::IsFalse(eventArgs.Is<GameObject>());
+
             auto factoryArgs = Factory<Scope>::StaticCreate(AttributedEventArgs::TypeNameClass());
         }
 
@@ -229,5 +292,340 @@ namespace LibraryDesktopTests {
             Assert::IsTrue((response.GetActions().CFrontTable()) == (clone->CAt("Actions"s).CFrontTable()));
             Assert::AreEqual(response.CAt("Number"s).CFrontInteger(), clone->CAt("Number"s).CFrontInteger());
         }
+
+        TEST_METHOD(MatchSubtypes) {
+            AttributedReaction reaction{};
+            auto& regexes = reaction.At("ReactsToSubtypeRegex"s);
+
+            Assert::IsFalse(reaction.IsMatchingSubtype(""s));
+            Assert::IsFalse(reaction.IsMatchingSubtype("Player.Died"s));
+
+            regexes.PushBack(R"(Player\.Died)"s);
+
+            Assert::IsTrue(reaction.IsMatchingSubtype("Player.Died"s));
+            Assert::IsFalse(reaction.IsMatchingSubtype("PlayerxDied"s));
+            Assert::IsFalse(reaction.IsMatchingSubtype("Player.Died "s));
+
+            regexes.PushBack("Damage.*"s);
+
+            Assert::IsTrue(reaction.IsMatchingSubtype("Player.Died"s));
+            Assert::IsTrue(reaction.IsMatchingSubtype("Damage"s));
+            Assert::IsTrue(reaction.IsMatchingSubtype("Damage 10"s));
+            Assert::IsFalse(reaction.IsMatchingSubtype("Damag"s));
+            Assert::IsFalse(reaction.IsMatchingSubtype("Damage\n10"s));
+            Assert::IsFalse(reaction.IsMatchingSubtype("Heavy Damage"s));
+
+            regexes.PushBack(".+mazing .+"s);
+
+            Assert::IsTrue(reaction.IsMatchingSubtype("Amazing Event"s));
+            Assert::IsTrue(reaction.IsMatchingSubtype("Unamazing Occurrence"s));
+            Assert::IsFalse(reaction.IsMatchingSubtype("Amazing"s));
+
+            regexes.SetElement(R"(Unit \d Died)"s, size_type(0));
+            regexes.SetElement(R"(Damage\..*)"s, size_type(1));
+
+            Assert::IsFalse(reaction.IsMatchingSubtype("Player.Died"s));
+            Assert::IsTrue(reaction.IsMatchingSubtype("Unit 4 Died"s));
+            Assert::IsFalse(reaction.IsMatchingSubtype("Unit 42 Died"s));
+            Assert::IsFalse(reaction.IsMatchingSubtype("Damage 10"s));
+            Assert::IsTrue(reaction.IsMatchingSubtype("Damage.10"s));
+
+            AttributedEventArgs amazing{"Amazing Event"s};
+            AttributedEventArgs ignored{"Totally Ignored"s};
+
+            Assert::IsTrue(reaction.IsReactingTo(amazing));
+            Assert::IsFalse(reaction.IsReactingTo(ignored));
+
+            regexes.Clear();
+
+            Assert::IsFalse(reaction.IsReactingTo(amazing));
+        }
+
+        TEST_METHOD(DispatchBySubtype) {
+            auto& index = GameplayState::Singleton().ReactionIndex();
+
+            Assert::AreEqual(std::size_t(0), index.Size());
+
+            AttributedReaction died{};
+            died.At("ReactsToSubtypeRegex"s).PushBack("Died"s);
+            auto& diedCounter = AppendCounter(died);
+
+            auto damaged = std::make_unique<AttributedReaction>();
+            damaged->At("ReactsToSubtypeRegex"s).PushBack("Damage.*"s);
+            auto& damagedCounter = AppendCounter(*damaged);
+
+            Assert::AreEqual(std::size_t(2), index.Size());
+            Assert::IsTrue(index.IsRegistered(died));
+            Assert::AreEqual(std::size_t(1), index.Find("Died"s).Size());
+            Assert::IsTrue(index.Find("Died"s)[0] == &died);
+            Assert::AreEqual(std::size_t(1), index.Find("Damage 5"s).Size());
+            Assert::IsTrue(index.Find("Ignored"s).IsEmpty());
+
+            Event::Publish(std::make_unique<AttributedEventArgs>("Died"s));
+            Event::Publish(std::make_unique<AttributedEventArgs>("Damage 5"s));
+            Event::Publish(std::make_unique<AttributedEventArgs>("Damage 7"s));
+            Event::Publish(std::make_unique<AttributedEventArgs>("Ignored"s));
+
+            Assert::AreEqual(1, diedCounter.GetCurrent());
+            Assert::AreEqual(2, damagedCounter.GetCurrent());
+
+            // Editing the regexes is noticed on the next publish.
+            died.At("ReactsToSubtypeRegex"s).PushBack("Ignored"s);
+            Event::Publish(std::make_unique<AttributedEventArgs>("Ignored"s));
+
+            Assert::AreEqual(2, diedCounter.GetCurrent());
+            Assert::AreEqual(2, damagedCounter.GetCurrent());
+
+            auto copy = std::make_unique<AttributedReaction>(died);
+
+            Assert::AreEqual(std::size_t(3), index.Size());
+            Assert::AreEqual(std::size_t(2), index.Find("Ignored"s).Size());
+
+            AttributedReaction moved{std::move(*copy)};
+
+            Assert::AreEqual(std::size_t(3), index.Size());
+            Assert::IsFalse(index.IsRegistered(*copy));
+            Assert::IsTrue(index.IsRegistered(moved));
+
+            copy.reset();
+            damaged.reset();
+
+            Assert::AreEqual(std::size_t(2), index.Size());
+            Assert::IsTrue(index.Find("Damage 5"s).IsEmpty());
+
+            Event::Publish(std::make_unique<AttributedEventArgs>("Died"s));
+
+            Assert::AreEqual(3, diedCounter.GetCurrent());
+            Assert::AreEqual(3, static_cast<const Actions::ActionIncrement&>(moved.GetActions().CFrontTable()).GetCurrent());
+        }
+
+        TEST_METHOD(DispatchAsksReactions) {
+            RefusingReaction reaction{};
+            reaction.At("ReactsToSubtypeRegex"s).PushBack("Hit"s);
+            auto& counter = AppendCounter(reaction);
+
+            Event::Publish(std::make_unique<AttributedEventArgs>("Hit"s));
+            Assert::AreEqual(1, counter.GetCurrent());
+
+            reaction.isRefusing = true;
+            Event::Publish(std::make_unique<AttributedEventArgs>("Hit"s));
+            Assert::AreEqual(1, counter.GetCurrent());
+        }
+
+        TEST_METHOD(WithoutGameplayState) {
+            GameplayState::DestroySingleton();
+
+            {
+                AttributedReaction reaction{};
+                reaction.At("ReactsToSubtypeRegex"s).PushBack("Hit"s);
+                AttributedReaction copy{reaction};
+                AttributedReaction moved{std::move(copy)};
+                reaction = moved;
+                reaction = std::move(moved);
+
+                Assert::AreEqual("Hit"s, reaction.GetReactsToSubtypeRegex());
+            }
+
+            GameplayState::CreateSingleton();
+
+            // Reactions outliving the gameplay state they registered with are not registered with the next.
+            AttributedReaction unregistered{};
+            GameplayState::DestroySingleton();
+            GameplayState::CreateSingleton();
+            Assert::AreEqual(std::size_t(0), GameplayState::Singleton().ReactionIndex().Size());
+        }
+
+        TEST_METHOD(PublishKeepsBindingsCurrent) {
+            GameObject scene{"Scene"s};
+            scene.AppendAuxiliaryAttribute("Value"s) = 1;
+            Scope& child = scene.AppendScope("Child"s);
+
+            AttributedReaction reaction{};
+            reaction.At("ReactsToSubtypeRegex"s).PushBack("Hit"s);
+            auto& counter = AppendCounter(reaction);
+
+            Scope::Binding binding{};
+            Assert::IsTrue(child.Search("Value"s, binding) == &scene["Value"s]);
+
+            // The arguments of every event are built and pushed as a new scope, which must not make every binding stale.
+            for (int i = 0; i < 3; ++i) {
+                auto args = std::make_unique<AttributedEventArgs>("Hit"s);
+                args->AppendAuxiliaryAttribute("Damage"s) = i;
+                Event::Publish(std::move(args));
+
+                Assert::IsTrue(binding.IsCurrent(child));
+                Assert::IsTrue(child.Search("Value"s, binding) == &scene["Value"s]);
+            }
+
+            Assert::AreEqual(3, counter.GetCurrent());
+        }
+
+        TEST_METHOD(ArgumentsAreNotBound) {
+            AttributedReaction reaction{};
+            reaction.At("ReactsToSubtypeRegex"s).PushBack("Hit"s);
+            auto& counter = AppendCounter(reaction);
+
+            auto args = std::make_unique<AttributedEventArgs>("Hit"s);
+            args->AppendAuxiliaryAttribute("Step"s) = 5;
+            Event::Publish(std::move(args));
+
+            Assert::AreEqual(5, counter.GetCurrent());
+
+            // Updated with no arguments pushed, the counter steps by its own step, rather than through the popped arguments.
+            reaction.Update(GameTime{});
+            Assert::AreEqual(6, counter.GetCurrent());
+
+            Event::Publish(std::make_unique<AttributedEventArgs>("Hit"s));
+            Assert::AreEqual(7, counter.GetCurrent());
+        }
+
+        TEST_METHOD(DispatchTracksChanges) {
+            auto& index = GameplayState::Singleton().ReactionIndex();
+
+            AttributedReaction first{};
+            first.At("ReactsToSubtypeRegex"s).PushBack("Hit"s);
+            AttributedReaction second{};
+            second.At("ReactsToSubtypeRegex"s).PushBack("Hit"s);
+
+            Assert::AreEqual(std::size_t(2), index.Find("Hit"s).Size());
+            Assert::IsTrue(index.Find("Miss"s).IsEmpty());
+
+            // A reaction whose regexes change moves between the remembered subtypes, still in the order reactions were registered.
+            first.At("ReactsToSubtypeRegex"s).SetElement("Miss"s);
+            Assert::AreEqual(std::size_t(1), index.Find("Hit"s).Size());
+            Assert::IsTrue(index.Find("Miss"s)[0] == &first);
+
+            first.At("ReactsToSubtypeRegex"s).SetElement("Hit"s);
+            Assert::IsTrue(index.Find("Miss"s).IsEmpty());
+            Assert::AreEqual(std::size_t(2), index.Find("Hit"s).Size());
+            Assert::IsTrue(index.Find("Hit"s)[0] == &first);
+            Assert::IsTrue(index.Find("Hit"s)[1] == &second);
+
+            // Changes which leave the regexes as they were change nothing.
+            first.AppendAuxiliaryAttribute("Health"s) = 10;
+            Assert::AreEqual(std::size_t(2), index.Find("Hit"s).Size());
+
+            AttributedReaction third{};
+            third.At("ReactsToSubtypeRegex"s).PushBack("Miss"s);
+            second = third;
+            Assert::AreEqual(std::size_t(1), index.Find("Hit"s).Size());
+            Assert::AreEqual(std::size_t(2), index.Find("Miss"s).Size());
+            Assert::IsTrue(index.Find("Miss"s)[0] == &second);
+
+            // Subtypes beyond those remembered are still dispatched to.
+            AttributedReaction unit{};
+            unit.At("ReactsToSubtypeRegex"s).PushBack(R"(Unit \d+)"s);
+            auto& counter = AppendCounter(unit);
+
+            for (std::size_t i = 0; i < (AttributedReactionIndex::MAX_SUBTYPE_COUNT + 10); ++i) {
+                Event::Publish(std::make_unique<AttributedEventArgs>("Unit "s + std::to_string(i)));
+            }
+
+            Event::Publish(std::make_unique<AttributedEventArgs>("Unit 0"s));
+            Assert::AreEqual(static_cast<int>(AttributedReactionIndex::MAX_SUBTYPE_COUNT + 11), counter.GetCurrent());
+            Assert::AreEqual(std::size_t(1), index.Find("Hit"s).Size());
+        }
+
+        TEST_METHOD(DispatchSkipsReregistered) {
+            ReregisteringReaction first{};
+            first.At("ReactsToSubtypeRegex"s).PushBack("Hit"s);
+            AttributedReaction second{};
+            second.At("ReactsToSubtypeRegex"s).PushBack("Hit"s);
+            auto& counter = AppendCounter(second);
+            first.target = &second;
+
+            // Registered again while the event is dispatched, so it only reacts to the next.
+            Event::Publish(std::make_unique<AttributedEventArgs>("Hit"s));
+            Assert::AreEqual(0, counter.GetCurrent());
+            Assert::IsTrue(GameplayState::Singleton().ReactionIndex().IsRegistered(second));
+
+            Event::Publish(std::make_unique<AttributedEventArgs>("Hit"s));
+            Assert::AreEqual(1, counter.GetCurrent());
+        }
+
+        BENCHMARK_METHOD(BenchmarkDispatch) {
+            // Mostly literal regexes, some prefixes and some which have to be matched as regexes, each interested in a few of the subtypes.
+            std::vector<AttributedReaction> reactions{};
+            reactions.reserve(BENCHMARK_REACTION_COUNT);
+
+            for (std::size_t i = 0; i < BENCHMARK_REACTION_COUNT; ++i) {
+                const auto number = std::to_string(i % 100);
+                auto& reaction = reactions.emplace_back();
+                auto& regexes = reaction.At("ReactsToSubtypeRegex"s);
+
+                switch (i % 10) {
+                case 6:
+                case 7:
+                case 8:
+                    regexes.PushBack("Damage "s + number.substr(0, 1) + ".*"s);
+                    break;
+                case 9:
+                    regexes.PushBack(R"(Unit \d*)"s + number.substr(number.size() - 1) + " Died"s);
+                    break;
+                default:
+                    regexes.PushBack("Unit "s + number + " Died"s);
+                    break;
+                }
+
+                AppendCounter(reaction);
+            }
+
+            Vector<std::string> subtypes{};
+            subtypes.Reserve(BENCHMARK_EVENT_COUNT);
+
+            for (std::size_t i = 0; i < BENCHMARK_EVENT_COUNT; ++i) {
+                subtypes.PushBack(((i % 2) == 0) ? ("Unit "s + std::to_string(i % 100) + " Died"s) : ("Damage "s + std::to_string(i % 100)));
+            }
+
+            std::size_t compiledMatches = 0;
+            auto start = clock::now();
+            for (std::size_t i = 0; i < BENCHMARK_COMPILED_EVENT_COUNT; ++i) {
+                for (const auto& reaction : reactions) {
+                    for (size_type j = 0; j < reaction.GetReactsToSubtypeRegexes().Size(); ++j) {
+                        if (std::regex_match(subtypes[i], std::regex{reaction.GetReactsToSubtypeRegex(j)})) {
+                            ++compiledMatches;
+                            break;
+                        }
+                    }
+                }
+            }
+            auto compiledTime = clock::now() - start;
+
+            std::size_t cachedMatches = 0;
+            std::size_t cachedSampleMatches = 0;
+            start = clock::now();
+            for (std::size_t i = 0; i < BENCHMARK_EVENT_COUNT; ++i) {
+                if (i == BENCHMARK_COMPILED_EVENT_COUNT) {
+                    cachedSampleMatches = cachedMatches;
+                }
+
+                for (const auto& reaction : reactions) {
+                    cachedMatches += reaction.IsMatchingSubtype(subtypes[i]) ? 1 : 0;
+                }
+            }
+            auto cachedTime = clock::now() - start;
+
+            start = clock::now();
+            for (std::size_t i = 0; i < BENCHMARK_EVENT_COUNT; ++i) {
+                Event::Publish(std::make_unique<AttributedEventArgs>(subtypes[i]));
+            }
+            auto dispatchedTime = clock::now() - start;
+
+            std::size_t dispatchedMatches = 0;
+            for (const auto& reaction : reactions) {
+                dispatchedMatches += static_cast<std::size_t>(static_cast<const Actions::ActionIncrement&>(reaction.GetActions().CFrontTable()).GetCurrent());
+            }
+
+            Assert::AreEqual(cachedSampleMatches, compiledMatches);
+            Assert::AreEqual(cachedMatches, dispatchedMatches);
+            Assert::IsTrue(dispatchedMatches > BENCHMARK_EVENT_COUNT);
+
+            using std::chrono::duration_cast;
+            Logger::WriteMessage(("Matching "s + std::to_string(BENCHMARK_EVENT_COUNT) + " events against "s + std::to_string(BENCHMARK_REACTION_COUNT)
+                + " reactions, per event, compiling every regex: "s + std::to_string(duration_cast<nanoseconds>(compiledTime).count() / BENCHMARK_COMPILED_EVENT_COUNT)
+                + "ns, testing every reaction: "s + std::to_string(duration_cast<nanoseconds>(cachedTime).count() / BENCHMARK_EVENT_COUNT)
+                + "ns, dispatching by subtype, including the reactions: "s + std::to_string(duration_cast<nanoseconds>(dispatchedTime).count() / BENCHMARK_EVENT_COUNT)
+                + "ns\n"s).c_str());
+        }
     };
 }
\ No newline at end of file
@@ -2,6 +2,9 @@
 #include "CppUnitTest.h"
 #include "AttributedSignatureRegistry.h"
 #include "AttributedTestMonster.h"
+#include "Benchmark.h"
+#include "TestGameObject.h"
+#include <chrono>
 #include "ToStringSpecializations.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -16,6 +19,7 @@ namespace LibraryDesktopTests {
 
         using size_type = Datum::size_type;
         using key_type = Attributed::key_type;
+        using DatumType = Datum::DatumType;
 
     public:
         TEST_METHOD_INITIALIZE(Initialize) {
@@ -91,5 +95,54 @@ namespace LibraryDesktopTests {
 
             AttributedSignatureRegistry::UnregisterSignatures<AttributedThing>();
         }
+
+        TEST_METHOD(FindLayout) {
+            Assert::IsNull(AttributedSignatureRegistry::FindLayout(AttributedThing::TypeIdClass()));
+
+            AttributedSignatureRegistry::RegisterSignatures<AttributedThing>();
+            AttributedSignatureRegistry::RegisterSignatures<AttributedTestMonster, AttributedThing>();
+
+            const SignatureLayout* layout = AttributedSignatureRegistry::FindLayout(AttributedTestMonster::TypeIdClass());
+            const SignatureVector& signatures = AttributedSignatureRegistry::FindSignatures(AttributedTestMonster::TypeIdClass())->second;
+            Assert::IsNotNull(layout);
+            Assert::AreEqual(signatures.Size(), layout->Size());
+
+            for (size_type i = 0; i < layout->Size(); ++i) {
+                const auto& precompiled = (*layout)[i];
+                Assert::IsTrue(signatures[i] == precompiled.signature);
+                Assert::AreEqual(Scope::KeyHashCode(signatures[i].Key()), precompiled.keyHashCode);
+            }
+
+            Assert::IsTrue(DatumType::InternalTable == (*layout)[layout->Size() - 1].internalType);
+
+            AttributedSignatureRegistry::UnregisterSignatures<AttributedTestMonster>();
+            Assert::IsNull(AttributedSignatureRegistry::FindLayout(AttributedTestMonster::TypeIdClass()));
+            AttributedSignatureRegistry::UnregisterSignatures<AttributedThing>();
+        }
+
+        BENCHMARK_METHOD(BenchmarkConstruction) {
+            using clock = std::chrono::high_resolution_clock;
+            const std::size_t count = 100000;
+
+            AttributedSignatureRegistry::RegisterSignatures<Transform>();
+            AttributedSignatureRegistry::RegisterSignatures<GameObject>();
+            AttributedSignatureRegistry::RegisterSignatures<TestGameObject, GameObject>();
+
+            {
+                auto start = clock::now();
+                for (std::size_t i = 0; i < count; ++i) {
+                    TestGameObject object{};
+                    UNREFERENCED_LOCAL(object);
+                }
+                auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start);
+
+                Logger::WriteMessage(("Constructed "s + std::to_string(count) + " game objects in "s
+                    + std::to_string(elapsed.count()) + "us\n"s).c_str());
+            }
+
+            AttributedSignatureRegistry::UnregisterSignatures<TestGameObject>();
+            AttributedSignatureRegistry::UnregisterSignatures<GameObject>();
+            AttributedSignatureRegistry::UnregisterSignatures<Transform>();
+        }
     };
 }
\ No newline at end of file
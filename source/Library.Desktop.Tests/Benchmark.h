@@ -0,0 +1,13 @@
+#pragma once
+#include "CppUnitTest.h"
+
+/// <summary>
+/// Declares a test method in the Benchmark category. Benchmarks time alternatives against each other and assert nothing about speed,
+/// so build/.runsettings excludes the category from test runs. Run them on their own with the test case filter TestCategory=Benchmark.
+/// Behaviour a benchmark relies on is asserted by the unit tests, not by the benchmark.
+/// </summary>
+#define BENCHMARK_METHOD(methodName)                                        \
+    BEGIN_TEST_METHOD_ATTRIBUTE(methodName)                                 \
+        TEST_METHOD_ATTRIBUTE(L"TestCategory", L"Benchmark")               \
+    END_TEST_METHOD_ATTRIBUTE()                                             \
+    TEST_METHOD(methodName)
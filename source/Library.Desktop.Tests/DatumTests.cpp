@@ -1944,5 +1944,63 @@ namespace LibraryDesktopTests {
             Assert::ExpectException<std::logic_error>([&datum](){ int& front = datum.FrontInteger(); UNREFERENCED_LOCAL(front); });
             Assert::ExpectException<std::logic_error>([&datum](){ datum.SetElement(3); });
         }
+
+        TEST_METHOD(SharingCopies) {
+            Datum source{};
+            source.PushBack("A"s);
+            source.PushBack("B"s);
+
+            Datum ints{1, 2, 3};
+            Datum empty{DatumType::Integer};
+
+            {
+                Datum::SharingCopies sharing{};
+
+                Datum copy{source};
+                Assert::IsTrue(copy.IsDataShared());
+                Assert::IsTrue(source.IsDataShared());
+                Assert::AreEqual(source, copy);
+                Assert::AreSame(source.CGetStringElement(1), copy.CGetStringElement(1));
+
+                copy.GetStringElement(1) = "C"s;
+                Assert::IsFalse(copy.IsDataShared());
+                Assert::IsFalse(source.IsDataShared());
+                Assert::AreEqual("B"s, source.CGetStringElement(1));
+                Assert::AreEqual("C"s, copy.CGetStringElement(1));
+
+                Datum second{source};
+                source.PushBack("D"s);
+                Assert::IsFalse(second.IsDataShared());
+                Assert::AreEqual(size_type(2), second.Size());
+                Assert::AreEqual(size_type(3), source.Size());
+
+                Datum third{second};
+                second.Clear();
+                Assert::IsTrue(second.IsEmpty());
+                Assert::IsFalse(third.IsDataShared());
+                Assert::AreEqual("B"s, third.CGetStringElement(1));
+                const String* reclaimed = &(third.CGetStringElement());
+                third.SetElement("E"s);
+                Assert::AreSame(*reclaimed, third.CGetStringElement());
+
+                Datum intsCopy{ints};
+                intsCopy.FrontInteger() = 5;
+                Assert::AreEqual(1, ints.CFrontInteger());
+                Assert::AreEqual(5, intsCopy.CFrontInteger());
+
+                Datum assigned{};
+                assigned = ints;
+                Assert::IsTrue(assigned.IsDataShared());
+                ints.PopBack();
+                Assert::AreEqual(size_type(3), assigned.Size());
+
+                Datum emptyCopy{empty};
+                Assert::IsFalse(emptyCopy.IsDataShared());
+            }
+
+            Datum deep{source};
+            Assert::IsFalse(deep.IsDataShared());
+            Assert::AreEqual(source, deep);
+        }
     };
 }
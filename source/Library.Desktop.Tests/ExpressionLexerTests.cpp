@@ -0,0 +1,234 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Benchmark.h"
+#include <chrono>
+#include <regex>
+#include "ExpressionLexer.h"
+#include "ShuntingYardParser.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::literals::string_literals;
+
+namespace LibraryDesktopTests {
+    TEST_CLASS(ExpressionLexerTests) {
+
+    private:
+        inline static _CrtMemState _startMemState;
+
+        using TokenType = ExpressionLexer::TokenType;
+        using clock = std::chrono::high_resolution_clock;
+
+        inline static const std::size_t BENCHMARK_COUNT = 10000;
+
+        /// <returns>Tokens of the given expression, as the parsers tokenized it with regular expressions, each followed by a newline.</returns>
+        static std::string RegexTokenize(std::string expression) {
+            std::regex extractTokens{"\\s*([^\\s]+)(.*)"};
+            std::smatch stringMatches{};
+            std::string tokens{};
+
+            while (std::regex_match(expression, stringMatches, extractTokens)) {
+                tokens += stringMatches[1].str() + "\n"s;
+                expression = stringMatches[2].str();
+            }
+
+            return tokens;
+        }
+
+        /// <returns>Tokens of the given expression, as read by the lexer, each followed by a newline.</returns>
+        static std::string LexerTokenize(const std::string& expression, std::initializer_list<std::string_view> delimiters = {}) {
+            ExpressionLexer lexer{expression, delimiters};
+            ExpressionLexer::Token token{};
+            std::string tokens{};
+
+            while (lexer.Next(token)) {
+                tokens += std::string{token.text} + "\n"s;
+            }
+
+            return tokens;
+        }
+
+    public:
+        TEST_METHOD_INITIALIZE(Initialize) {
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+            _CrtMemCheckpoint(&_startMemState);
+    #endif
+        }
+
+        TEST_METHOD_CLEANUP(Cleanup) {
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtMemState endMemState, diffMemState;
+            _CrtMemCheckpoint(&endMemState);
+
+            if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState)) {
+                _CrtMemDumpStatistics(&diffMemState);
+                Assert::Fail(L"Memory Leaks!");
+            }
+    #endif
+        }
+
+        TEST_METHOD(TokenTypes) {
+            const std::string expression = "  12 3.5 3. vector<1|2|3|4> matrix[<1|0|0|0>,<0|1|0|0>,<0|0|1|0>,<0|0|0|1>] Outer[1].Inner.Key ++\t"s;
+            ExpressionLexer lexer{expression};
+            ExpressionLexer::Token token{};
+
+            Assert::IsTrue(lexer.Next(token));
+            Assert::IsTrue(token.text == "12"s);
+            Assert::IsTrue(token.type == TokenType::Integer);
+            Assert::IsTrue(lexer.Next(token));
+            Assert::IsTrue(token.type == TokenType::Float);
+            Assert::IsTrue(lexer.Next(token));
+            Assert::IsTrue(token.text == "3."s);
+            Assert::IsTrue(token.type == TokenType::Word);
+            Assert::IsTrue(lexer.Next(token));
+            Assert::IsTrue(token.text == "vector<1|2|3|4>"s);
+            Assert::IsTrue(token.type == TokenType::Vector);
+            Assert::IsTrue(lexer.Next(token));
+            Assert::IsTrue(token.type == TokenType::Matrix);
+            Assert::AreEqual(std::size_t(47), token.text.size());
+            Assert::IsTrue(lexer.Next(token));
+            Assert::IsTrue(token.text == "Outer[1].Inner.Key"s);
+            Assert::IsTrue(token.type == TokenType::Word);
+            Assert::IsTrue(lexer.Next(token));
+            Assert::IsTrue(token.text == "++"s);
+            Assert::IsFalse(lexer.Next(token));
+            Assert::IsFalse(lexer.Next(token));
+
+            ExpressionLexer empty{" \n "};
+            Assert::IsFalse(empty.Next(token));
+        }
+
+        TEST_METHOD(UnterminatedLiterals) {
+            ExpressionLexer::Token token{};
+
+            // A literal missing its closing never reaches past whitespace, such as to a later comparison.
+            ExpressionLexer vector{"a vector<1|2 > b"};
+            Assert::IsTrue(vector.Next(token));
+            Assert::ExpectException<std::invalid_argument>([&vector, &token]() { auto _ = vector.Next(token); UNREFERENCED_LOCAL(_); });
+
+            ExpressionLexer matrix{"matrix[<1|0|0|0>"};
+            Assert::ExpectException<std::invalid_argument>([&matrix, &token]() { auto _ = matrix.Next(token); UNREFERENCED_LOCAL(_); });
+
+            ExpressionLexer closed{"vector<1|2|3|4>> b"};
+            Assert::IsTrue(closed.Next(token));
+            Assert::IsTrue(token.text == "vector<1|2|3|4>"s);
+            Assert::IsTrue(closed.Next(token));
+            Assert::IsTrue(token.text == ">"s);
+        }
+
+        TEST_METHOD(Delimiters) {
+            const std::string expression = "max(a,(b))->c"s;
+            ExpressionLexer lexer{expression, {"(", ")", ",", ""}};
+            ExpressionLexer::Token token{};
+            std::size_t delimiterCount = 0;
+
+            while (lexer.Next(token)) {
+                delimiterCount += (token.type == TokenType::Delimiter) ? std::size_t(1) : std::size_t(0);
+            }
+
+            Assert::AreEqual("max\n(\na\n,\n(\nb\n)\n)\n->c\n"s, LexerTokenize(expression, {"(", ")", ","}));
+            Assert::AreEqual(std::size_t(5), delimiterCount);
+
+            const std::string literal = "f(matrix[<1|0|0|0>,<0|1|0|0>,<0|0|1|0>,<0|0|0|1>])"s;
+            ExpressionLexer literalLexer{literal, {"(", ")", ","}};
+            Assert::IsTrue(literalLexer.Next(token));
+            Assert::IsTrue(literalLexer.Next(token));
+            Assert::IsTrue(literalLexer.Next(token));
+            Assert::IsTrue(token.type == TokenType::Matrix);
+            Assert::IsTrue(literalLexer.Next(token));
+            Assert::IsTrue(token.text == ")"s);
+
+            Assert::ExpectException<std::invalid_argument>([&expression]() { ExpressionLexer _{expression, {"a", "b", "c", "d", "e"}}; });
+        }
+
+        TEST_METHOD(Paths) {
+            std::string_view path = "Outer[12].Inner.a[1][2].Key.Last";
+            std::string_view name{};
+            std::size_t index = 0;
+
+            Assert::IsTrue(ExpressionLexer::NextPathStep(path, name, index));
+            Assert::IsTrue(name == "Outer"s);
+            Assert::AreEqual(std::size_t(12), index);
+            Assert::IsTrue(ExpressionLexer::NextPathStep(path, name, index));
+            Assert::IsTrue(name == "Inner"s);
+            Assert::AreEqual(std::size_t(0), index);
+            Assert::IsTrue(ExpressionLexer::NextPathStep(path, name, index));
+            Assert::IsTrue(name == "a[1]"s);
+            Assert::AreEqual(std::size_t(2), index);
+            Assert::IsTrue(ExpressionLexer::NextPathStep(path, name, index));
+            Assert::IsTrue(name == "Key"s);
+            Assert::IsFalse(ExpressionLexer::NextPathStep(path, name, index));
+            Assert::IsTrue(path == "Last"s);
+
+            std::string_view unsplittable = ".Key";
+            Assert::IsFalse(ExpressionLexer::NextPathStep(unsplittable, name, index));
+            unsplittable = "Key.";
+            Assert::IsFalse(ExpressionLexer::NextPathStep(unsplittable, name, index));
+
+            std::string_view unindexed = "[1].Key";
+            Assert::IsTrue(ExpressionLexer::NextPathStep(unindexed, name, index));
+            Assert::IsTrue(name == "[1]"s);
+            Assert::AreEqual(std::size_t(0), index);
+
+            std::string_view overflowing = "a[99999999999999999999999].Key";
+            Assert::ExpectException<std::out_of_range>([&overflowing, &name, &index]() { auto _ = ExpressionLexer::NextPathStep(overflowing, name, index); UNREFERENCED_LOCAL(_); });
+        }
+
+        TEST_METHOD(RegexParity) {
+            const std::string expressions[] = {
+                ""s,
+                "   "s,
+                "3 5 +"s,
+                "  this.val\t5 +\t Ints.one * "s,
+                "Strings[0].Values shrimp Strings[1].Values + +"s,
+                "1.5 2.25 / 7 % deg->rad rad->deg ~ --"s,
+                "vector<1.000000|2.000000|3.000000|4.000000> this.Position ="s
+            };
+
+            for (const auto& expression : expressions) {
+                Assert::AreEqual(RegexTokenize(expression), LexerTokenize(expression));
+            }
+
+            ShuntingYardParser yard{};
+            Assert::AreEqual("5 this.val + 6 this.val Ints.one - / * Ints.one +"s, yard.Parse("(5 + this.val) * (6 / (this.val - Ints.one)) + Ints.one"s));
+            Assert::AreEqual("a b c sin * ="s, yard.Parse("a = b * sin(c)"s));
+            Assert::AreEqual("vector<1|2|3|4> this.Position +"s, yard.Parse("(vector<1|2|3|4>) + this.Position"s));
+        }
+
+        BENCHMARK_METHOD(BenchmarkTokenize) {
+            std::string expression{};
+            for (std::size_t i = 0; i < 100; ++i) {
+                expression += "this.Counter[" + std::to_string(i) + "].Value 2.5 * 7 + "s;
+            }
+
+            auto start = clock::now();
+            std::size_t regexCount = 0;
+            for (std::size_t i = 0; i < BENCHMARK_COUNT / 100; ++i) {
+                const std::string tokens = RegexTokenize(expression);
+                regexCount += std::size_t(std::count(tokens.begin(), tokens.end(), '\n'));
+            }
+            auto byRegexTime = clock::now() - start;
+
+            start = clock::now();
+            std::size_t lexerCount = 0;
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                ExpressionLexer lexer{expression};
+                ExpressionLexer::Token token{};
+                while (lexer.Next(token)) {
+                    ++lexerCount;
+                }
+            }
+            auto byLexerTime = clock::now() - start;
+
+            Assert::AreEqual(regexCount * 100, lexerCount);
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Tokenizing "s + std::to_string(expression.size()) + " characters, per pass by regex: "s
+                + std::to_string(duration_cast<microseconds>(byRegexTime).count() / (BENCHMARK_COUNT / 100)) + "us, by lexer: "s
+                + std::to_string(duration_cast<microseconds>(byLexerTime).count() / BENCHMARK_COUNT) + "us\n"s).c_str());
+        }
+    };
+}
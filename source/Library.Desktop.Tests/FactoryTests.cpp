@@ -1,8 +1,10 @@
 #include "pch.h"
 #include "CppUnitTest.h"
+#include <chrono>
 #include "Bar.h"
 #include "AttributedSignatureRegistry.h"
 #include "AttributedTestMonster.h"
+#include "Benchmark.h"
 #include "ToStringSpecializations.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -18,6 +20,9 @@ namespace LibraryDesktopTests {
         using size_type = Datum::size_type;
         using DatumType = FieaGameEngine::Datum::DatumType;
         using key_type = Attributed::key_type;
+        using clock = std::chrono::high_resolution_clock;
+
+        inline static const std::size_t BENCHMARK_COUNT = 10000;
 
     public:
         TEST_METHOD_INITIALIZE(Initialize) {
@@ -161,5 +166,152 @@ namespace LibraryDesktopTests {
             Assert::IsFalse(Factory<Scope>::TryFind(AttributedTestMonster::TypeNameClass(), found));
             Assert::IsNull(found);
         }
+
+        TEST_METHOD(CreateByClassId) {
+            Assert::IsTrue(Factory<Scope>::INVALID_CLASS_ID == Factory<Scope>::FindClassId(Bar::TypeNameClass()));
+            Assert::IsFalse(Factory<Scope>::StaticCreate(Factory<Scope>::INVALID_CLASS_ID).operator bool());
+
+            BarFactory::Register();
+            AttributedThingFactory::Register();
+
+            const auto barId = Factory<Scope>::FindClassId(Bar::TypeNameClass());
+            const auto thingId = Factory<Scope>::FindClassId(AttributedThing::TypeNameClass());
+            Assert::IsTrue(barId != thingId);
+            Assert::AreEqual(Bar::TypeNameClass(), Factory<Scope>::Find(barId)->CreatedClassName());
+
+            std::unique_ptr<Scope> bar = Factory<Scope>::StaticCreate(barId);
+            std::unique_ptr<Scope> thing = Factory<Scope>::StaticCreate(thingId);
+            Assert::AreEqual(Bar::TypeIdClass(), bar->TypeIdInstance());
+            Assert::AreEqual(0, bar->As<Bar>()->Number());
+            Assert::AreEqual(AttributedThing::TypeIdClass(), thing->TypeIdInstance());
+
+            Scope parent{};
+            Assert::AreEqual(Bar::TypeIdClass(), parent.AppendScope("Child"s, barId).TypeIdInstance());
+            Vector<std::unique_ptr<Scope>> bars{};
+
+            BarFactory::Register();
+            Assert::IsTrue(barId == Factory<Scope>::FindClassId(Bar::TypeNameClass()));
+
+            BarFactory::Unregister();
+            Assert::IsNull(Factory<Scope>::Find(barId));
+            Assert::IsFalse(Factory<Scope>::StaticCreate(barId).operator bool());
+            Assert::IsTrue(thingId == Factory<Scope>::FindClassId(AttributedThing::TypeNameClass()));
+            Assert::AreEqual(AttributedThing::TypeIdClass(), Factory<Scope>::StaticCreate(thingId)->TypeIdInstance());
+
+            // The removed entry is reused, but the stale id never finds whichever factory reuses it.
+            AttributedTestMonsterFactory::Register();
+            Assert::IsNull(Factory<Scope>::Find(barId));
+            Assert::IsFalse(Factory<Scope>::StaticCreate(barId).operator bool());
+            Assert::IsFalse(Factory<Scope>::StaticCreateMany(barId, 1, bars));
+
+            BarFactory::Register();
+            Assert::IsTrue(barId != Factory<Scope>::FindClassId(Bar::TypeNameClass()));
+            Assert::IsFalse(Factory<Scope>::StaticCreate(barId).operator bool());
+            Assert::AreEqual(Bar::TypeIdClass(), Factory<Scope>::StaticCreate(Factory<Scope>::FindClassId(Bar::TypeNameClass()))->TypeIdInstance());
+
+            BarFactory::Unregister();
+            AttributedTestMonsterFactory::Unregister();
+            AttributedThingFactory::Unregister();
+            Assert::IsTrue(Factory<Scope>::INVALID_CLASS_ID == Factory<Scope>::FindClassId(AttributedThing::TypeNameClass()));
+        }
+
+        TEST_METHOD(CreateMany) {
+            BarFactory::Register();
+            AttributedThingFactory::Register();
+
+            {
+                Vector<std::unique_ptr<Scope>> bars{};
+                Assert::IsTrue(Factory<Scope>::StaticCreateMany(Factory<Scope>::FindClassId(Bar::TypeNameClass()), 8, bars));
+                Assert::IsFalse(Factory<Scope>::StaticCreateMany(Factory<Scope>::INVALID_CLASS_ID, 8, bars));
+                Assert::AreEqual(size_type(8), bars.Size());
+                Assert::AreEqual(std::size_t(1), ObjectPool::SlabCount());
+
+                for (auto i = size_type(0); i < bars.Size(); ++i) {
+                    Assert::AreEqual(Bar::TypeIdClass(), bars[i]->TypeIdInstance());
+                    Assert::AreEqual(0, bars[i]->As<Bar>()->Number());
+                    Assert::AreEqual(reinterpret_cast<std::byte*>(bars[0].get()) + (i * sizeof(Bar)), reinterpret_cast<std::byte*>(bars[i].get()));
+                }
+
+                Scope parent{};
+                parent.AttachAsChild("Bar"s, std::move(bars[3]));
+                parent.At("Bar"s).BackTable()["Child"s] = 5;
+
+                Vector<std::unique_ptr<Scope>> things{};
+                Factory<Scope>::Find(AttributedThing::TypeNameClass())->CreateMany(4, things);
+                Assert::AreEqual(std::size_t(2), ObjectPool::SlabCount());
+                Assert::IsTrue(*things[0] == *things[3]);
+
+                // Copies of pooled objects are allocated normally, and are not tagged as pooled.
+                Scope::ScopeUniquePointer copy = things[0]->Clone();
+                copy.reset();
+                Assert::AreEqual(std::size_t(2), ObjectPool::SlabCount());
+
+                bars.Clear();
+                Assert::AreEqual(std::size_t(2), ObjectPool::SlabCount());
+                parent.Clear();
+                Assert::AreEqual(std::size_t(1), ObjectPool::SlabCount());
+
+                std::unique_ptr<Scope> kept = std::move(things[1]);
+                things.Clear();
+                Assert::AreEqual(std::size_t(1), ObjectPool::SlabCount());
+                kept.reset();
+                Assert::AreEqual(std::size_t(0), ObjectPool::SlabCount());
+            }
+
+            {
+                // Objects are returned to their slab whatever order the slabs were allocated and are released in,
+                // and objects which were not pooled are never mistaken for pooled ones.
+                constexpr size_type SLAB_COUNT = 16;
+                Vector<std::unique_ptr<Scope>> bars{};
+
+                for (auto i = size_type(0); i < SLAB_COUNT; ++i) {
+                    Factory<Scope>::StaticCreateMany(Factory<Scope>::FindClassId(Bar::TypeNameClass()), 2, bars);
+                }
+
+                auto unpooled = std::make_unique<Scope>();
+                Assert::AreEqual(SLAB_COUNT, ObjectPool::SlabCount());
+                unpooled.reset();
+                Assert::AreEqual(SLAB_COUNT, ObjectPool::SlabCount());
+
+                for (auto i = size_type(0); i < bars.Size(); ++i) {
+                    bars[(i * 7) % bars.Size()].reset();
+                }
+
+                Assert::AreEqual(std::size_t(0), ObjectPool::SlabCount());
+            }
+
+            AttributedThingFactory::Unregister();
+            BarFactory::Unregister();
+        }
+
+        BENCHMARK_METHOD(BenchmarkCreateMany) {
+            AttributedThingFactory::Register();
+            const auto thingId = Factory<Scope>::FindClassId(AttributedThing::TypeNameClass());
+
+            {
+                Vector<std::unique_ptr<Scope>> things{BENCHMARK_COUNT};
+                auto start = clock::now();
+                for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                    things.PushBack(Factory<Scope>::StaticCreate(thingId));
+                }
+                things.Clear();
+                auto oneAtATimeTime = clock::now() - start;
+
+                start = clock::now();
+                Factory<Scope>::StaticCreateMany(thingId, BENCHMARK_COUNT, things);
+                things.Clear();
+                auto createManyTime = clock::now() - start;
+
+                Assert::AreEqual(std::size_t(0), ObjectPool::SlabCount());
+
+                using std::chrono::duration_cast;
+                using std::chrono::microseconds;
+                Logger::WriteMessage(("Creating and destroying "s + std::to_string(BENCHMARK_COUNT) + " attributed things, one at a time: "s
+                    + std::to_string(duration_cast<microseconds>(oneAtATimeTime).count()) + "us, with CreateMany: "s
+                    + std::to_string(duration_cast<microseconds>(createManyTime).count()) + "us\n"s).c_str());
+            }
+
+            AttributedThingFactory::Unregister();
+        }
     };
 }
\ No newline at end of file
@@ -226,6 +226,25 @@ namespace LibraryDesktopTests {
             Assert::AreEqual("TestGameObject: { \"Name\": Root, number of children: 0, number of actions: 0 }"s, root.ToString());
         }
 
+        TEST_METHOD(DeepHierarchyUpdate) {
+            const size_type DEPTH = size_type(10000);
+
+            auto root = std::make_unique<TestGameObject>("Root"s);
+            TestGameObject* deepest = root.get();
+
+            for (auto i = size_type(0); i < DEPTH; ++i) {
+                deepest = static_cast<TestGameObject*>(&(deepest->CreateChild("TestGameObject"s, "Child"s + std::to_string(i))));
+            }
+
+            root->Update(GameTime{});
+            root->Update(GameTime{});
+
+            Assert::AreEqual(2, root->UpdateCount());
+            Assert::AreEqual(2, deepest->UpdateCount());
+
+            root.reset();
+        }
+
         TEST_METHOD(CopyAndMoveSemantics) {
             GameObject root{"Root"s};
 
@@ -1,7 +1,9 @@
 #include "pch.h"
 #include "CppUnitTest.h"
+#include <chrono>
 #include "Foo.h"
 #include "Bar.h"
+#include "Benchmark.h"
 #include "ToStringSpecializations.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -9,11 +11,33 @@ using namespace FieaGameEngine;
 using namespace std::literals::string_literals;
 
 namespace LibraryDesktopTests {
+    namespace {
+        class Level1 : public RTTI { RTTI_DECLARATIONS(Level1, RTTI); };
+        class Level2 : public Level1 { RTTI_DECLARATIONS(Level2, Level1); };
+        class Level3 : public Level2 { RTTI_DECLARATIONS(Level3, Level2); };
+        class Level4 : public Level3 { RTTI_DECLARATIONS(Level4, Level3); };
+        class Level5 : public Level4 { RTTI_DECLARATIONS(Level5, Level4); };
+        class Level6 : public Level5 { RTTI_DECLARATIONS(Level6, Level5); };
+        class OtherLevel3 : public Level2 { RTTI_DECLARATIONS(OtherLevel3, Level2); };
+    }
+
+    RTTI_DEFINITIONS(Level1);
+    RTTI_DEFINITIONS(Level2);
+    RTTI_DEFINITIONS(Level3);
+    RTTI_DEFINITIONS(Level4);
+    RTTI_DEFINITIONS(Level5);
+    RTTI_DEFINITIONS(Level6);
+    RTTI_DEFINITIONS(OtherLevel3);
+
     TEST_CLASS(RTTITests) {
 
     private:
         inline static _CrtMemState _startMemState;
 
+        using clock = std::chrono::high_resolution_clock;
+
+        inline static const std::size_t BENCHMARK_COUNT = 10000000;
+
     public:
         TEST_METHOD_INITIALIZE(Initialize) {
     #if defined(DEBUG) || defined(_DEBUG)
@@ -54,5 +78,72 @@ namespace LibraryDesktopTests {
             Assert::IsNotNull(ar.As<Bar>());
             Assert::IsNull(ar.As<Foo>());
         }
+
+        TEST_METHOD(Ancestry) {
+            Level6 deepest{};
+            OtherLevel3 sibling{};
+            const RTTI& deepestBase = deepest;
+
+            Assert::AreEqual(std::size_t(6), Level6::TypeDepthClass());
+            Assert::AreEqual(std::size_t(6), deepestBase.TypeDisplayInstance().depth);
+            Assert::AreEqual(Level1::TypeIdClass(), deepestBase.TypeDisplayInstance().ids[0]);
+            Assert::AreEqual(Level6::TypeIdClass(), deepestBase.TypeDisplayInstance().ids[5]);
+
+            Assert::IsTrue(deepestBase.Is<Level1>());
+            Assert::IsTrue(deepestBase.Is<Level3>());
+            Assert::IsTrue(deepestBase.Is<Level6>());
+            Assert::IsFalse(deepestBase.Is<OtherLevel3>());
+            Assert::IsTrue(deepestBase.Is(Level4::TypeIdClass()));
+            Assert::IsFalse(deepestBase.Is(OtherLevel3::TypeIdClass()));
+            Assert::IsFalse(deepestBase.Is(Foo::TypeIdClass()));
+
+            Assert::IsTrue(sibling.Is<Level2>());
+            Assert::IsFalse(sibling.Is<Level3>());
+            Assert::IsFalse(sibling.Is<Level6>());
+            Assert::IsNull(static_cast<RTTI&>(sibling).As<Level4>());
+            Assert::IsNotNull(static_cast<RTTI&>(sibling).As<Level1>());
+
+            Level2 shallow{};
+            Assert::IsFalse(shallow.Is<Level6>());
+            Assert::IsNull(static_cast<const RTTI&>(shallow).As<Level3>());
+        }
+
+        BENCHMARK_METHOD(BenchmarkDeepHierarchy) {
+            Level6 deepest{};
+            OtherLevel3 sibling{};
+            RTTI* objects[] = {&deepest, &sibling};
+
+            auto start = clock::now();
+            std::size_t byIdCount = 0;
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                byIdCount += objects[i & 1]->Is(Level1::TypeIdClass()) ? 1 : 0;
+            }
+            auto byIdTime = clock::now() - start;
+
+            start = clock::now();
+            std::size_t byDisplayCount = 0;
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                byDisplayCount += (objects[i & 1]->As<Level3>() != nullptr) ? 1 : 0;
+            }
+            auto byDisplayTime = clock::now() - start;
+
+            start = clock::now();
+            std::size_t byDynamicCastCount = 0;
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                byDynamicCastCount += (dynamic_cast<Level3*>(objects[i & 1]) != nullptr) ? 1 : 0;
+            }
+            auto byDynamicCastTime = clock::now() - start;
+
+            Assert::AreEqual(BENCHMARK_COUNT, byIdCount);
+            Assert::AreEqual(BENCHMARK_COUNT / 2, byDisplayCount);
+            Assert::AreEqual(byDisplayCount, byDynamicCastCount);
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Checking "s + std::to_string(BENCHMARK_COUNT) + " objects of a 6 level hierarchy, by id: "s
+                + std::to_string(duration_cast<microseconds>(byIdTime).count()) + "us, by display: "s
+                + std::to_string(duration_cast<microseconds>(byDisplayTime).count()) + "us, by dynamic_cast: "s
+                + std::to_string(duration_cast<microseconds>(byDynamicCastTime).count()) + "us\n"s).c_str());
+        }
     };
-}
+}
\ No newline at end of file
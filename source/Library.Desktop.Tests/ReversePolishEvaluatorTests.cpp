@@ -1,7 +1,11 @@
 #include "pch.h"
 #include "CppUnitTest.h"
+#include <chrono>
+#include <memory>
+#include <vector>
 #include "AttributedSignatureRegistry.h"
 #include "AttributedTestMonster.h"
+#include "Benchmark.h"
 #include "ReversePolishEvaluator.h"
 #include "ShuntingYardParser.h"
 #include "ToStringSpecializations.h"
@@ -23,6 +27,9 @@ namespace LibraryDesktopTests {
         using size_type = Datum::size_type;
         using DatumType = FieaGameEngine::Datum::DatumType;
         using key_type = Attributed::key_type;
+        using clock = std::chrono::high_resolution_clock;
+
+        inline static const std::size_t BENCHMARK_COUNT = 1000000;
 
     public:
         TEST_METHOD_INITIALIZE(Initialize) {
@@ -187,5 +194,509 @@ namespace LibraryDesktopTests {
             Assert::AreEqual(size_type(1), result.Size());
             Assert::IsTrue(FloatsAreEquivalent(25.f, result.CFrontFloat()));
         }
+
+        TEST_METHOD(CompiledExpression) {
+            ReversePolishEvaluator eval{};
+            Scope root{};
+
+            root.Append("val"s) = 3;
+            root.AppendScope("Ints"s).Append("one"s) = 1;
+            root.AppendScope("Ints"s).Append("two"s) = 2;
+
+            auto compiled = eval.Compile("this.val Ints[1].two * missing + Ints.one ++ +"s);
+            Assert::IsFalse(compiled.IsEmpty());
+            Assert::IsTrue(ReversePolishEvaluator::CompiledExpression{}.IsEmpty());
+            Assert::ExpectException<std::invalid_argument>([&eval, &root, &compiled]() { auto _ = eval.Evaluate(compiled, root); UNREFERENCED_LOCAL(_); });
+
+            // So is integer division by zero, which is undefined rather than thrown.
+            Assert::AreEqual(size_type(3), eval.Compile("1 0 /"s).Size());
+            Assert::AreEqual(size_type(1), eval.Compile("1.0 0.0 /"s).Size());
+            Assert::AreEqual(size_type(1), eval.Compile("7 2 /"s).Size());
+
+            compiled = eval.Compile("this.val Ints[1].two * 4 + Ints.one ++ +"s);
+            Assert::AreEqual(Datum{12}, eval.Evaluate(compiled, root));
+            Assert::AreEqual(Datum{13}, eval.Evaluate(compiled, root));
+            Assert::AreEqual(3, root["Ints"s].GetTableElement().At("one"s).CGetIntegerElement());
+
+            Scope other{};
+            other.Append("val"s) = 1;
+            other.AppendScope("Ints"s).Append("one"s) = 0;
+            other.AppendScope("Ints"s).Append("two"s) = 5;
+            Assert::AreEqual(Datum{10}, eval.Evaluate(compiled, other));
+
+            // Paths were bound while evaluating against the other context, and rebind once the tree changes.
+            Assert::IsTrue(root["Ints"s].RemoveAt(1));
+            root.AppendScope("Ints"s).Append("two"s) = 3;
+            Assert::AreEqual(Datum{17}, eval.Evaluate(compiled, root));
+            Assert::ExpectException<std::out_of_range>([&eval, &compiled, &other]() { other["Ints"s].PopBack(); auto _ = eval.Evaluate(compiled, other); UNREFERENCED_LOCAL(_); });
+
+            compiled = eval.Compile("  2.5\t 2.5 "s + ReversePolishEvaluator::DEFAULT_IS_EQUIVALENT + " 1 ===\n"s, false);
+            Assert::AreEqual(size_type(5), compiled.Size());
+            Assert::AreEqual(Datum{1}, eval.Evaluate(compiled, root));
+
+            Assert::ExpectException<std::invalid_argument>([&eval]() { auto _ = eval.Compile("1 +"s); UNREFERENCED_LOCAL(_); });
+            Assert::ExpectException<std::invalid_argument>([&eval]() { auto _ = eval.Compile("1 2"s); UNREFERENCED_LOCAL(_); });
+            Assert::ExpectException<std::invalid_argument>([&eval]() { auto _ = eval.Compile(" "s); UNREFERENCED_LOCAL(_); });
+            Assert::ExpectException<std::invalid_argument>([&eval, &root]() { auto _ = eval.Evaluate(ReversePolishEvaluator::CompiledExpression{}, root); UNREFERENCED_LOCAL(_); });
+        }
+
+        TEST_METHOD(OptimizedExpression) {
+            ReversePolishEvaluator eval{};
+            Scope root{};
+
+            root.Append("val"s) = 3;
+            root.Append("x"s) = 0;
+            root.Append("angle"s) = 0.5f;
+
+            const std::string expressions[] = {
+                "2 3 * 4 + this.val *"s,
+                "90.0 deg->rad sin 2.0 * angle +"s,
+                "5 ++ this.val * this.val this.val * -"s,
+                "vector<1|2|3|4> vector<1|1|1|1> + vector<0|0|0|1> +"s,
+                "1 2 < 3 3 == &&"s,
+                "x 4 -- ="s
+            };
+
+            for (const auto& expression : expressions) {
+                const auto reference = eval.Compile(expression, false);
+                const auto optimized = eval.Compile(expression);
+                Assert::IsTrue(optimized.Size() < reference.Size());
+                Assert::AreEqual(eval.Evaluate(reference, root), eval.Evaluate(optimized, root));
+            }
+
+            // Expressions of constants fold to their result, and repeated variables share one path.
+            Assert::AreEqual(size_type(1), eval.Compile("1 2 < 3 3 == &&"s).Size());
+            Assert::AreEqual(size_type(3), eval.Compile("5 ++ this.val * this.val this.val * -"s, false).PathCount());
+            Assert::AreEqual(size_type(1), eval.Compile("5 ++ this.val * this.val this.val * -"s).PathCount());
+
+            // Folding an operation that throws is left until it is evaluated.
+            auto compiled = eval.Compile("1 2 ="s);
+            Assert::AreEqual(size_type(3), compiled.Size());
+            Assert::ExpectException<std::invalid_argument>([&eval, &root, &compiled]() { auto _ = eval.Evaluate(compiled, root); UNREFERENCED_LOCAL(_); });
+
+            // Assignments are dead when the variable is assigned again before it is read.
+            compiled = eval.Compile("x 1 = x 2 = +"s);
+            Assert::AreEqual(size_type(1), compiled.DeadAssignments().Size());
+            Assert::AreEqual("x"s, compiled.DeadAssignments().Front());
+            Assert::AreEqual(Datum{3}, eval.Evaluate(compiled, root));
+            Assert::IsTrue(eval.Compile("x 1 = x 2 = +"s, false).DeadAssignments().Size() == size_type(1));
+            Assert::IsTrue(eval.Compile("x 1 = x + x 2 = +"s).DeadAssignments().IsEmpty());
+            Assert::IsTrue(eval.Compile("x x 1 = ="s).DeadAssignments().Size() == size_type(1));
+            Assert::IsTrue(eval.Compile("x 1 = this.x 2 = +"s).DeadAssignments().IsEmpty());
+        }
+
+        TEST_METHOD(EvaluateIntoResult) {
+            ReversePolishEvaluator eval{};
+            Scope root{};
+
+            root.Append("i"s) = 3;
+            root.Append("f"s) = 0.5f;
+            root.Append("v"s) = glm::vec4{1.f, 2.f, 3.f, 4.f};
+            root.Append("ints"s) = {1, 2, 3};
+            root.Append("name"s) = "abc"s;
+
+            Datum result{};
+            const auto evaluate = [&eval, &root, &result](const std::string& expression) -> const Datum& {
+                eval.Evaluate(eval.Compile(expression), root, result);
+                return result;
+            };
+
+            Assert::AreEqual(Datum{6.5f}, evaluate("i 2 * f +"s));
+            Assert::AreEqual(Datum{2}, evaluate("7 i /"s));
+            Assert::AreEqual(Datum{1}, evaluate("i 2 /"s));
+            Assert::AreEqual(Datum{glm::vec4{2.f, 4.f, 6.f, 8.f}}, evaluate("v 2 *"s));
+            Assert::AreEqual(Datum{glm::vec4{2.f, 4.f, 6.f, 8.f}}, evaluate("2 v *"s));
+            Assert::AreEqual(Datum{glm::vec4{1.f, 2.f, 3.f, 4.f} / 3.f}, evaluate("v i /"s));
+            Assert::AreEqual(Datum{1}, evaluate("f 0.25 > i 0 && ||"s));
+            Assert::AreEqual(Datum{0}, evaluate("i ~"s));
+            Assert::AreEqual(Datum{1}, evaluate("0 ~"s));
+            Assert::ExpectException<std::invalid_argument>([&evaluate]() { evaluate("i f <"s); });
+            Assert::ExpectException<std::invalid_argument>([&evaluate]() { evaluate("v 2 +"s); });
+
+            // Arrays and strings are still evaluated as datums.
+            Datum expected{};
+            expected = {2, 3, 4};
+            Assert::AreEqual(expected, evaluate("ints 1 +"s));
+            Assert::AreEqual(Datum{"abcabc"s}, evaluate("name name +"s));
+
+            // Stepping and assigning a variable write through to it.
+            Assert::AreEqual(Datum{4}, evaluate("i ++"s));
+            Assert::AreEqual(4, root.At("i"s).CFrontInteger());
+            Assert::AreEqual(Datum{10}, evaluate("i 10 ="s));
+            Assert::AreEqual(10, root.At("i"s).CFrontInteger());
+            Assert::AreEqual(Datum{7}, evaluate("i i 3 - ="s));
+            Assert::AreEqual(7, root.At("i"s).CFrontInteger());
+
+            // A scalar result of the same type is overwritten in place.
+            const Datum::Integer* storage = &result.FrontInteger();
+            Assert::AreEqual(Datum{12}, evaluate("i 5 +"s));
+            Assert::IsTrue(storage == &result.FrontInteger());
+
+            // The same compiled expression is evaluated the same each time.
+            const auto compiled = eval.Compile("i 1 + name name + +"s);
+            Assert::ExpectException<std::invalid_argument>([&eval, &root, &compiled]() { auto _ = eval.Evaluate(compiled, root); UNREFERENCED_LOCAL(_); });
+            const auto scalar = eval.Compile("this.f 2 * this.i +"s);
+            Assert::AreEqual(Datum{8.f}, eval.Evaluate(scalar, root));
+            Assert::AreEqual(Datum{8.f}, eval.Evaluate(scalar, root));
+        }
+
+        BENCHMARK_METHOD(BenchmarkEvaluateInto) {
+            ReversePolishEvaluator eval{};
+            ShuntingYardParser yard{};
+            Scope root{};
+
+            root.Append("val"s) = 3.f;
+            root.AppendScope("Ints"s).Append("one"s) = 1;
+
+            const auto compiled = eval.Compile(yard.Parse("(5 + this.val) * (6 / (this.val - Ints.one)) + Ints.one"s));
+
+            auto start = clock::now();
+            float returnedSum = 0.f;
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                returnedSum += eval.Evaluate(compiled, root).CFrontFloat();
+            }
+            auto returnedTime = clock::now() - start;
+
+            Datum result{};
+            eval.Evaluate(compiled, root, result);
+
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtMemState beforeMemState, afterMemState;
+            _CrtMemCheckpoint(&beforeMemState);
+    #endif
+
+            start = clock::now();
+            float intoSum = 0.f;
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                eval.Evaluate(compiled, root, result);
+                intoSum += result.CFrontFloat();
+            }
+            auto intoTime = clock::now() - start;
+
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtMemCheckpoint(&afterMemState);
+            Assert::AreEqual(beforeMemState.lTotalCount, afterMemState.lTotalCount);
+    #endif
+
+            Assert::AreEqual(returnedSum, intoSum);
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Evaluating a compiled expression "s + std::to_string(BENCHMARK_COUNT) + " times, returning a new datum: "s
+                + std::to_string(duration_cast<microseconds>(returnedTime).count()) + "us, into the same datum: "s
+                + std::to_string(duration_cast<microseconds>(intoTime).count()) + "us\n"s).c_str());
+        }
+
+        TEST_METHOD(SpecializedOpcodes) {
+            ReversePolishEvaluator eval{};
+            Scope referenceRoot{}, optimizedRoot{};
+
+            for (Scope* root : {&referenceRoot, &optimizedRoot}) {
+                root->Append("i"s) = 3;
+                root->Append("f"s) = 0.5f;
+                root->Append("v"s) = glm::vec4{1.f, 2.f, 3.f, 4.f};
+            }
+
+            const std::string expressions[] = {
+                "i i + 2 * i -"s,
+                "f f * f / 0.25 -"s,
+                "v v + v -"s,
+                "i 5 < f 0.25 > &&"s,
+                "i 2 > f 1.0 < ||"s,
+                "i 3 == i 4 == ||"s,
+                "i i ++ +"s,
+                "i i 1 = +"s,
+                "f f 2.0 * ="s
+            };
+
+            // Specialized opcodes are only taken once the operand types have been seen, so each expression is evaluated more than once.
+            for (const auto& expression : expressions) {
+                const auto reference = eval.Compile(expression, false);
+                const auto optimized = eval.Compile(expression);
+
+                for (int i = 0; i < 3; ++i) {
+                    Assert::AreEqual(eval.Evaluate(reference, referenceRoot), eval.Evaluate(optimized, optimizedRoot));
+                    Assert::AreEqual(referenceRoot.At("i"s), optimizedRoot.At("i"s));
+                    Assert::AreEqual(referenceRoot.At("f"s), optimizedRoot.At("f"s));
+                }
+            }
+
+            // Operands that change type fall back to the generic operation, and so still raise the same errors.
+            const auto compiled = eval.Compile("x 2 *"s);
+            Datum& x = optimizedRoot.Append("x"s);
+            x = 3;
+            Assert::AreEqual(Datum{6}, eval.Evaluate(compiled, optimizedRoot));
+            Assert::AreEqual(Datum{6}, eval.Evaluate(compiled, optimizedRoot));
+            x = 1.5f;
+            Assert::AreEqual(Datum{3.f}, eval.Evaluate(compiled, optimizedRoot));
+            x = glm::vec4{1.f};
+            Assert::AreEqual(Datum{glm::vec4{2.f}}, eval.Evaluate(compiled, optimizedRoot));
+            x = "abc"s;
+            Assert::ExpectException<std::invalid_argument>([&eval, &optimizedRoot, &compiled]() { auto _ = eval.Evaluate(compiled, optimizedRoot); UNREFERENCED_LOCAL(_); });
+            x = 4;
+            Assert::AreEqual(Datum{8}, eval.Evaluate(compiled, optimizedRoot));
+        }
+
+        TEST_METHOD(InferTypes) {
+            ReversePolishEvaluator eval{};
+            AttributedTestMonster monster{};
+            monster.AppendAuxiliaryAttribute("Aux"s) = 2;
+            monster["Level"s].SetElement(3);
+            monster["MaxLevel"s].SetElement(10);
+            monster["CurrentHealth"s].SetElement(5.f);
+            monster["MaxHealth"s].SetElement(20.f);
+
+            const auto infer = [&eval, &monster](const std::string& expression) {
+                auto compiled = eval.Compile(expression);
+                eval.InferTypes(compiled, monster.TypeIdInstance());
+                return compiled;
+            };
+
+            // Prescribed attributes are typed from their signatures.
+            auto compiled = infer("this.Level 1 + MaxLevel <"s);
+            Assert::AreEqual(DatumType::Integer, compiled.ResultType());
+            Assert::AreEqual(Datum{1}, eval.Evaluate(compiled, monster));
+
+            compiled = infer("CurrentHealth MaxHealth / 2.0 *"s);
+            Assert::AreEqual(DatumType::Float, compiled.ResultType());
+            Assert::AreEqual(Datum{0.5f}, eval.Evaluate(compiled, monster));
+
+            Assert::AreEqual(DatumType::Matrix, infer("Transform ~"s).ResultType());
+            Assert::AreEqual(DatumType::String, infer("EntryMessage EntryMessage +"s).ResultType());
+            Assert::AreEqual(DatumType::Float, infer("Level 2.5 ="s).ResultType());
+
+            // Auxiliary attributes, and paths which do not resolve, are only typed once evaluated.
+            compiled = infer("Aux 1 +"s);
+            Assert::AreEqual(DatumType::Unknown, compiled.ResultType());
+            Assert::AreEqual(Datum{3}, eval.Evaluate(compiled, monster));
+            Assert::AreEqual(DatumType::Unknown, infer("missing Level +"s).ResultType());
+            Assert::AreEqual(DatumType::Integer, infer("Level"s).ResultType());
+
+            // Type errors are thrown ahead of time.
+            Assert::ExpectException<std::invalid_argument>([&infer]() { infer("Level CurrentHealth <"s); });
+            Assert::ExpectException<std::invalid_argument>([&infer]() { infer("EntryMessage 1 -"s); });
+            Assert::ExpectException<std::invalid_argument>([&infer]() { infer("Transform Level Level + %"s); });
+
+            // Expressions which leave no result cannot be typed.
+            Assert::ExpectException<std::invalid_argument>([&eval, &monster]() {
+                ReversePolishEvaluator::CompiledExpression empty{};
+                eval.InferTypes(empty, monster.TypeIdInstance());
+            });
+
+            // Contexts of other types are still checked when evaluated.
+            compiled = infer("Level 2 *"s);
+            Scope other{};
+            other.Append("Level"s) = 1.5f;
+            Assert::AreEqual(Datum{6}, eval.Evaluate(compiled, monster));
+            Assert::AreEqual(Datum{3.f}, eval.Evaluate(compiled, other));
+            Assert::AreEqual(Datum{6}, eval.Evaluate(compiled, monster));
+        }
+
+        BENCHMARK_METHOD(BenchmarkActionExpressionScripts) {
+            ReversePolishEvaluator eval{};
+            ShuntingYardParser yard{};
+            Scope root{};
+
+            root.Append("Name"s) = "Root"s;
+            Datum& counter = root.Append("Counter"s);
+            root.Append("Angle"s) = 0.f;
+
+            const std::string scripts[] = {
+                yard.Parse("this.Name == Root"s),
+                yard.Parse("++ this.Counter"s),
+                yard.Parse("(this.Counter > 10) || (this.Counter == 10)"s),
+                yard.Parse("this.Angle = 2 * sin(deg->rad(this.Counter * 30))"s)
+            };
+
+            // Unoptimized expressions always go through the generic operations, optimized ones through opcodes specialized to their operand types.
+            const auto run = [&eval, &root, &counter, &scripts](bool isOptimizing, std::size_t& truthy) {
+                std::vector<ReversePolishEvaluator::CompiledExpression> compiled{};
+                for (const auto& script : scripts) {
+                    compiled.push_back(eval.Compile(script, isOptimizing));
+                }
+
+                counter = 0;
+                Datum result{};
+                truthy = 0;
+
+                const auto start = clock::now();
+                for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                    for (const auto& expression : compiled) {
+                        eval.Evaluate(expression, root, result);
+                        truthy += result.IsTruthy() ? 1 : 0;
+                    }
+                }
+
+                return clock::now() - start;
+            };
+
+            std::size_t genericTruthy, threadedTruthy;
+            const auto genericTime = run(false, genericTruthy);
+            const Datum genericAngle = root.At("Angle"s);
+            const auto threadedTime = run(true, threadedTruthy);
+
+            Assert::AreEqual(genericTruthy, threadedTruthy);
+            Assert::AreEqual(genericAngle, root.At("Angle"s));
+            Assert::AreEqual(static_cast<Datum::Integer>(BENCHMARK_COUNT), counter.CFrontInteger());
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Evaluating 4 action expression scripts "s + std::to_string(BENCHMARK_COUNT) + " times, generic: "s
+                + std::to_string(duration_cast<microseconds>(genericTime).count()) + "us, specialized: "s
+                + std::to_string(duration_cast<microseconds>(threadedTime).count()) + "us\n"s).c_str());
+        }
+
+        TEST_METHOD(EvaluateBatch) {
+            ReversePolishEvaluator eval{};
+            const std::size_t count = 37;
+
+            auto scopes = std::make_unique<Scope[]>(count);
+            std::vector<Scope*> contexts{};
+            std::vector<Datum> results(count);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                scopes[i].Append("i"s) = static_cast<Datum::Integer>(i);
+                scopes[i].Append("f"s) = 0.25f * i;
+                scopes[i].AppendScope("Nested"s).Append("v"s) = glm::vec4{static_cast<float>(i)};
+                contexts.push_back(&scopes[i]);
+            }
+
+            // Every lane of the same type runs in columns; the last context holds a float, so its column is evaluated context by context.
+            scopes[count - 1].At("i"s) = 2.5f;
+
+            const std::string expressions[] = {
+                "i 3 * 1 +"s,
+                "f 2 * i +"s,
+                "i 2 / f 5.0 > &&"s,
+                "f sin f cos + 10.0 *"s,
+                "i ~ f 1.0 < ||"s,
+                "Nested.v i *"s,
+                "Nested.v 2.0 * Nested.v -"s,
+                "missing"s
+            };
+
+            for (const auto& expression : expressions) {
+                const auto compiled = eval.Compile(expression);
+                eval.Evaluate(compiled, gsl::span<Scope* const>{contexts.data(), count}, gsl::span<Datum>{results.data(), count});
+
+                for (std::size_t i = 0; i < count; ++i) {
+                    Assert::AreEqual(eval.Evaluate(compiled, scopes[i]), results[i]);
+                }
+            }
+
+            // Assignments are scattered back into each context.
+            const auto assignment = eval.Compile("f f 4.0 * ="s);
+            eval.Evaluate(assignment, gsl::span<Scope* const>{contexts.data(), count}, gsl::span<Datum>{results.data(), count});
+
+            for (std::size_t i = 0; i < count; ++i) {
+                Assert::AreEqual(Datum{float(i)}, results[i]);
+                Assert::AreEqual(float(i), scopes[i].At("f"s).CFrontFloat());
+            }
+
+            Assert::ExpectException<std::invalid_argument>([&eval, &assignment, &contexts, &results]() {
+                eval.Evaluate(assignment, gsl::span<Scope* const>{contexts.data(), contexts.size()}, gsl::span<Datum>{results.data(), results.size() - 1});
+            });
+            Assert::ExpectException<std::invalid_argument>([&eval, &contexts, &results]() {
+                eval.Evaluate(eval.Compile("i Nested +"s), gsl::span<Scope* const>{contexts.data(), contexts.size()}, gsl::span<Datum>{results.data(), results.size()});
+            });
+
+            // Contexts writing to an attribute of their common parent each see the writes of those before them, as they would evaluated alone.
+            Scope parent{};
+            parent.Append("counter"s) = 0;
+            std::vector<Scope*> children{};
+
+            for (std::size_t i = 0; i < count; ++i) {
+                children.push_back(&parent.AppendScope("Child"s));
+            }
+
+            const auto shared = eval.Compile("this.counter this.counter 1 + ="s);
+            eval.Evaluate(shared, gsl::span<Scope* const>{children.data(), count}, gsl::span<Datum>{results.data(), count});
+
+            Assert::AreEqual(static_cast<Datum::Integer>(count), parent.At("counter"s).CFrontInteger());
+            for (std::size_t i = 0; i < count; ++i) {
+                Assert::AreEqual(Datum{static_cast<Datum::Integer>(i + 1)}, results[i]);
+            }
+        }
+
+        BENCHMARK_METHOD(BenchmarkEvaluateBatch) {
+            ReversePolishEvaluator eval{};
+            ShuntingYardParser yard{};
+            const std::size_t count = 10000;
+            const std::size_t frames = 100;
+
+            auto scopes = std::make_unique<Scope[]>(count);
+            std::vector<Scope*> contexts{};
+            std::vector<Datum> results(count);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                scopes[i].Append("val"s) = 3.f + i;
+                scopes[i].AppendScope("Ints"s).Append("one"s) = 1;
+                contexts.push_back(&scopes[i]);
+            }
+
+            const auto compiled = eval.Compile(yard.Parse("(5 + this.val) * (6 / (this.val - Ints.one)) + Ints.one"s));
+
+            auto start = clock::now();
+            float eachSum = 0.f;
+            for (std::size_t frame = 0; frame < frames; ++frame) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    eval.Evaluate(compiled, scopes[i], results[i]);
+                    eachSum += results[i].CFrontFloat();
+                }
+            }
+            auto eachTime = clock::now() - start;
+
+            start = clock::now();
+            float batchSum = 0.f;
+            for (std::size_t frame = 0; frame < frames; ++frame) {
+                eval.Evaluate(compiled, gsl::span<Scope* const>{contexts.data(), count}, gsl::span<Datum>{results.data(), count});
+                for (std::size_t i = 0; i < count; ++i) {
+                    batchSum += results[i].CFrontFloat();
+                }
+            }
+            auto batchTime = clock::now() - start;
+
+            Assert::AreEqual(eachSum, batchSum);
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Evaluating an expression across "s + std::to_string(count) + " contexts "s + std::to_string(frames) + " times, context by context: "s
+                + std::to_string(duration_cast<microseconds>(eachTime).count()) + "us, as a batch: "s
+                + std::to_string(duration_cast<microseconds>(batchTime).count()) + "us\n"s).c_str());
+        }
+
+        BENCHMARK_METHOD(BenchmarkCompiledExpression) {
+            ReversePolishEvaluator eval{};
+            ShuntingYardParser yard{};
+            Scope root{};
+
+            root.Append("val"s) = 3.f;
+            root.AppendScope("Ints"s).Append("one"s) = 1;
+
+            const std::string expression = yard.Parse("(5 + this.val) * (6 / (this.val - Ints.one)) + Ints.one"s);
+
+            auto start = clock::now();
+            float interpretedSum = 0.f;
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                interpretedSum += eval.Evaluate(expression, root).CFrontFloat();
+            }
+            auto interpretedTime = clock::now() - start;
+
+            start = clock::now();
+            const auto compiled = eval.Compile(expression);
+            float compiledSum = 0.f;
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                compiledSum += eval.Evaluate(compiled, root).CFrontFloat();
+            }
+            auto compiledTime = clock::now() - start;
+
+            Assert::AreEqual(interpretedSum, compiledSum);
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Evaluating an expression "s + std::to_string(BENCHMARK_COUNT) + " times, by parsing each time: "s
+                + std::to_string(duration_cast<microseconds>(interpretedTime).count()) + "us, compiled once: "s
+                + std::to_string(duration_cast<microseconds>(compiledTime).count()) + "us\n"s).c_str());
+        }
     };
-}
\ No newline at end of file
+}
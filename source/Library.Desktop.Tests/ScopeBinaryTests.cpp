@@ -0,0 +1,269 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include "ScopeBinaryWriter.h"
+#include "ScopeBinaryReader.h"
+#include "JsonParseCoordinator.h"
+#include "ScopeParseWrapper.h"
+#include "AllScopeJsonParseHelper.h"
+#include "ScopeJsonKeyTokenTransmuter.h"
+#include "AttributedSignatureRegistry.h"
+#include "AttributedTestMonster.h"
+#include "Benchmark.h"
+#include "TestGameObject.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace FieaGameEngine::ScopeJsonParse;
+using namespace std::literals::string_literals;
+
+namespace LibraryDesktopTests {
+    TEST_CLASS(ScopeBinaryTests) {
+
+    private:
+        inline static _CrtMemState _startMemState;
+
+        using size_type = Scope::size_type;
+        using vec4 = Transform::vec4;
+        using mat4 = Datum::Matrix;
+        using clock = std::chrono::high_resolution_clock;
+
+        inline static const std::size_t BENCHMARK_COUNT = 2000;
+
+        /// <summary>
+        /// Writes the given scope, then reads it back as a new tree.
+        /// </summary>
+        static Scope::ScopeUniquePointer RoundTrip(const Scope& source) {
+            std::stringstream stream{std::ios::in | std::ios::out | std::ios::binary};
+            ScopeBinaryWriter{stream}.Write(source);
+            return ScopeBinaryReader{stream}.Read();
+        }
+
+    public:
+        TEST_METHOD_INITIALIZE(Initialize) {
+            AttributedSignatureRegistry::RegisterSignatures<Transform>();
+            AttributedSignatureRegistry::RegisterSignatures<GameObject>();
+            AttributedSignatureRegistry::RegisterSignatures<TestGameObject, GameObject>();
+            AttributedSignatureRegistry::RegisterSignatures<AttributedThing>();
+            AttributedSignatureRegistry::RegisterSignatures<AttributedTestMonster, AttributedThing>();
+            ScopeFactory::Register();
+            TransformFactory::Register();
+            GameObjectFactory::Register();
+            TestGameObjectFactory::Register();
+            AttributedThingFactory::Register();
+
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+            _CrtMemCheckpoint(&_startMemState);
+    #endif
+        }
+
+        TEST_METHOD_CLEANUP(Cleanup) {
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtMemState endMemState, diffMemState;
+            _CrtMemCheckpoint(&endMemState);
+
+            if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState)) {
+                _CrtMemDumpStatistics(&diffMemState);
+                Assert::Fail(L"Memory Leaks!");
+            }
+    #endif
+
+            AttributedThingFactory::Unregister();
+            TestGameObjectFactory::Unregister();
+            GameObjectFactory::Unregister();
+            TransformFactory::Unregister();
+            ScopeFactory::Unregister();
+            AttributedSignatureRegistry::UnregisterSignatures<AttributedTestMonster>();
+            AttributedSignatureRegistry::UnregisterSignatures<AttributedThing>();
+            AttributedSignatureRegistry::UnregisterSignatures<TestGameObject>();
+            AttributedSignatureRegistry::UnregisterSignatures<GameObject>();
+            AttributedSignatureRegistry::UnregisterSignatures<Transform>();
+        }
+
+        TEST_METHOD(RoundTripScope) {
+            Scope source{};
+            source["Integer"s] = 5;
+            source["Floats"s].PushBack(1.f);
+            source["Floats"s].PushBack(2.f);
+            source["Name"s] = "Source"s;
+            source["Empty"s] = ""s;
+            source["Matrix"s] = mat4{2.f};
+            source["Untyped"s];
+            Scope& nested = source.AppendScope("Nested"s);
+            nested["Vector"s] = vec4{1.f, 2.f, 3.f, 4.f};
+            nested["Name"s] = "Nested"s;
+            nested.AppendScope("Deeper"s)["Strings"s].PushBack("a"s);
+            source.AppendScope("Nested"s)["Integer"s] = 6;
+
+            Scope::ScopeUniquePointer loaded = RoundTrip(source);
+            Assert::IsTrue(*loaded == source);
+            Assert::IsTrue(loaded->Is(Scope::TypeIdClass()));
+            Assert::IsNull(loaded->Parent());
+            Assert::AreEqual(size_type(2), (*loaded)["Nested"s].Size());
+            Assert::IsTrue((*loaded)["Nested"s].CGetTableElement().Parent() == loaded.get());
+            Assert::AreEqual(""s, (*loaded)["Empty"s].FrontString());
+            Assert::AreEqual(Datum::DatumType::Unknown, (*loaded)["Untyped"s].ActualType());
+            Assert::AreEqual(vec4{1.f, 2.f, 3.f, 4.f}, (*loaded)["Nested"s].CGetTableElement()["Vector"s].FrontVector());
+
+            Scope::ScopeUniquePointer empty = RoundTrip(Scope{});
+            Assert::IsTrue(*empty == Scope{});
+        }
+
+        TEST_METHOD(RoundTripGameObject) {
+            TestGameObject source{"Root"s};
+            source.LocalTranslate(vec4{1.f, 2.f, 3.f, 0.f});
+            source.CreateChild("TestGameObject"s, "First"s).LocalTranslate(vec4{0.f, 1.f, 0.f, 0.f});
+            source.CreateChild("Second"s).AppendAuxiliaryAttribute("Bonus"s) = 10;
+
+            Datum::Integer external = 7;
+            source.AppendAuxiliaryAttribute("Aliased"s).SetStorage(&external, size_type(1));
+
+            Scope::ScopeUniquePointer loaded = RoundTrip(source);
+            TestGameObject* root = loaded->As<TestGameObject>();
+
+            Assert::IsNotNull(root);
+            Assert::IsTrue(*loaded == source);
+            Assert::AreEqual("Root"s, root->GetName());
+            Assert::AreSame(static_cast<const Scope&>(root->GetTransform()), root->CAt("Transform"s).CGetTableElement());
+            Assert::AreEqual(vec4{1.f, 2.f, 3.f, 0.f}, root->GetTransform().GetLocalPosition());
+            Assert::AreEqual(size_type(2), root->GetChildren().Size());
+            Assert::IsTrue(root->GetChild().Is(TestGameObject::TypeIdClass()));
+            Assert::AreEqual(vec4{0.f, 1.f, 0.f, 0.f}, root->GetChild().GetTransform().GetLocalPosition());
+            Assert::AreEqual(10, root->GetChild(size_type(1)).CAt("Bonus"s).FrontInteger());
+
+            // Aliased storage is written by value.
+            Assert::IsTrue(root->CAt("Aliased"s).IsDataInternal());
+            Assert::AreEqual(7, root->CAt("Aliased"s).FrontInteger());
+        }
+
+        TEST_METHOD(ReadInto) {
+            TestGameObject source{"Source"s};
+            source.LocalTranslate(vec4{4.f, 0.f, 0.f, 0.f});
+            source.AppendAuxiliaryAttribute("Score"s) = 3;
+
+            std::stringstream stream{std::ios::in | std::ios::out | std::ios::binary};
+            ScopeBinaryWriter{stream}.Write(source);
+            const std::string document = stream.str();
+
+            TestGameObject target{"Target"s};
+            target.AppendAuxiliaryAttribute("Score"s) = 1;
+            std::istringstream input{document, std::ios::binary};
+            ScopeBinaryReader{input}.ReadInto(target);
+
+            Assert::AreEqual("Source"s, target.GetName());
+            Assert::AreEqual(vec4{4.f, 0.f, 0.f, 0.f}, target.GetTransform().GetLocalPosition());
+            Assert::AreEqual(size_type(1), target.CAt("Score"s).Size());
+            Assert::AreEqual(3, target.CAt("Score"s).FrontInteger());
+
+            Scope scope{};
+            std::istringstream other{document, std::ios::binary};
+            Assert::ExpectException<std::runtime_error>([&other, &scope]() { ScopeBinaryReader{other}.ReadInto(scope); });
+        }
+
+        TEST_METHOD(MissingFactory) {
+            AttributedTestMonster monster{};
+            std::stringstream stream{std::ios::in | std::ios::out | std::ios::binary};
+            ScopeBinaryWriter{stream}.Write(monster);
+
+            Assert::ExpectException<std::runtime_error>([&stream]() { auto _ = ScopeBinaryReader{stream}.Read(); UNREFERENCED_LOCAL(_); });
+        }
+
+        TEST_METHOD(Malformed) {
+            Scope source{};
+            source["Integers"s].PushBack(1);
+            source["Integers"s].PushBack(2);
+
+            std::stringstream stream{std::ios::in | std::ios::out | std::ios::binary};
+            ScopeBinaryWriter{stream}.Write(source);
+            const std::string document = stream.str();
+
+            auto read = [](const std::string& bytes) {
+                std::istringstream input{bytes, std::ios::binary};
+                auto _ = ScopeBinaryReader{input}.Read();
+                UNREFERENCED_LOCAL(_);
+            };
+
+            read(document);
+            Assert::ExpectException<std::runtime_error>([&read]() { read(""s); });
+            Assert::ExpectException<std::runtime_error>([&read, &document]() { read(document.substr(0, document.size() - 1)); });
+
+            std::string badMagic = document;
+            badMagic[0] = 'X';
+            Assert::ExpectException<std::runtime_error>([&read, &badMagic]() { read(badMagic); });
+
+            std::string badVersion = document;
+            ++badVersion[offsetof(ScopeBinaryFormat::Header, version)];
+            Assert::ExpectException<std::runtime_error>([&read, &badVersion]() { read(badVersion); });
+
+            // Counts and lengths which overrun the document are rejected before anything is allocated for them.
+            using index_type = ScopeBinaryFormat::index_type;
+            std::size_t bodyOffset = sizeof(ScopeBinaryFormat::Header)
+                + (sizeof(index_type) + "Integers"s.size()) + (sizeof(index_type) + Scope::TypeNameClass().size());
+            bodyOffset += ScopeBinaryFormat::PaddingAt(bodyOffset);
+            const std::size_t datumOffset = bodyOffset + sizeof(ScopeBinaryFormat::ScopeRecord);
+
+            auto patched = [&document](std::size_t offset, auto value) {
+                std::string bytes = document;
+                std::memcpy(bytes.data() + offset, &value, sizeof(value));
+                return bytes;
+            };
+
+            const std::initializer_list<std::string> overruns = {
+                patched(offsetof(ScopeBinaryFormat::Header, keyCount), std::numeric_limits<index_type>::max()),
+                patched(offsetof(ScopeBinaryFormat::Header, classCount), std::numeric_limits<index_type>::max()),
+                patched(sizeof(ScopeBinaryFormat::Header), std::numeric_limits<index_type>::max()),
+                patched(bodyOffset + offsetof(ScopeBinaryFormat::ScopeRecord, datumCount), std::numeric_limits<index_type>::max()),
+                patched(datumOffset + offsetof(ScopeBinaryFormat::DatumRecord, count), std::numeric_limits<index_type>::max()),
+                patched(datumOffset + offsetof(ScopeBinaryFormat::DatumRecord, payloadSize), std::numeric_limits<std::uint64_t>::max())
+            };
+
+            for (const auto& overrun : overruns) {
+                Assert::ExpectException<std::runtime_error>([&read, &overrun]() { read(overrun); });
+            }
+
+            Scope pointing{};
+            pointing["Pointer"s] = static_cast<RTTI*>(&source);
+            Assert::ExpectException<std::invalid_argument>([&pointing]() { auto _ = RoundTrip(pointing); UNREFERENCED_LOCAL(_); });
+        }
+
+        BENCHMARK_METHOD(BenchmarkLoad) {
+            std::string json = R"({ "Cubes": {)"s;
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                json += ((i > 0) ? ","s : ""s) + R"( "object GameObject )"s + std::to_string(i) + R"(": { "string Name": "Cube )"s + std::to_string(i)
+                    + R"(", "integer Value": )"s + std::to_string(i) + R"(, "object Transform Transform": { "LocalPosition": "vector<)"s
+                    + std::to_string(i % 7) + "|0|"s + std::to_string(i / 7) + R"(|0>" } })"s;
+            }
+            json += " } }"s;
+
+            auto start = clock::now();
+            auto jsonRoot = std::make_shared<Scope>();
+            auto wrapper = std::make_shared<ScopeParseWrapper>(jsonRoot);
+            auto coordinator = JsonParseCoordinator(wrapper);
+            coordinator.PushBackHelper(std::make_unique<AllScopeJsonParseHelper>());
+            coordinator.PushBackTransmuter(std::make_unique<ScopeJsonKeyTokenTransmuter>());
+            coordinator.DeserializeIntoWrapperFromString(json);
+            auto byJsonTime = clock::now() - start;
+
+            std::stringstream stream{std::ios::in | std::ios::out | std::ios::binary};
+            ScopeBinaryWriter{stream}.Write(*jsonRoot);
+            const std::string document = stream.str();
+
+            start = clock::now();
+            std::istringstream input{document, std::ios::binary};
+            Scope::ScopeUniquePointer binaryRoot = ScopeBinaryReader{input}.Read();
+            auto byBinaryTime = clock::now() - start;
+
+            Assert::IsTrue(*binaryRoot == *jsonRoot);
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Loading "s + std::to_string(BENCHMARK_COUNT) + " game objects, from json ("s + std::to_string(json.size())
+                + " bytes): "s + std::to_string(duration_cast<microseconds>(byJsonTime).count()) + "us, from binary ("s
+                + std::to_string(document.size()) + " bytes): "s + std::to_string(duration_cast<microseconds>(byBinaryTime).count()) + "us\n"s).c_str());
+        }
+    };
+}
@@ -0,0 +1,290 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <chrono>
+#include "ScopeImage.h"
+#include "ScopeBinaryWriter.h"
+#include "ScopeBinaryReader.h"
+#include "AttributedSignatureRegistry.h"
+#include "Benchmark.h"
+#include "TestGameObject.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::literals::string_literals;
+
+namespace LibraryDesktopTests {
+    TEST_CLASS(ScopeImageTests) {
+
+    private:
+        inline static _CrtMemState _startMemState;
+
+        using size_type = Scope::size_type;
+        using vec4 = Transform::vec4;
+        using mat4 = Datum::Matrix;
+        using clock = std::chrono::high_resolution_clock;
+
+        inline static const std::size_t BENCHMARK_COUNT = 10000;
+
+        /// <returns>The given scope, as a binary document.</returns>
+        static std::string WriteDocument(const Scope& source) {
+            std::ostringstream stream{std::ios::binary};
+            ScopeBinaryWriter{stream}.Write(source);
+            return stream.str();
+        }
+
+        /// <returns>Path of a scratch file for the given test.</returns>
+        static std::string ScratchFile(const std::string& name) {
+            return (std::filesystem::temp_directory_path() / (name + ".scb"s)).string();
+        }
+
+    public:
+        TEST_METHOD_INITIALIZE(Initialize) {
+            AttributedSignatureRegistry::RegisterSignatures<Transform>();
+            AttributedSignatureRegistry::RegisterSignatures<GameObject>();
+            AttributedSignatureRegistry::RegisterSignatures<TestGameObject, GameObject>();
+            ScopeFactory::Register();
+            TransformFactory::Register();
+            GameObjectFactory::Register();
+            TestGameObjectFactory::Register();
+
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+            _CrtMemCheckpoint(&_startMemState);
+    #endif
+        }
+
+        TEST_METHOD_CLEANUP(Cleanup) {
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtMemState endMemState, diffMemState;
+            _CrtMemCheckpoint(&endMemState);
+
+            if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState)) {
+                _CrtMemDumpStatistics(&diffMemState);
+                Assert::Fail(L"Memory Leaks!");
+            }
+    #endif
+
+            TestGameObjectFactory::Unregister();
+            GameObjectFactory::Unregister();
+            TransformFactory::Unregister();
+            ScopeFactory::Unregister();
+            AttributedSignatureRegistry::UnregisterSignatures<TestGameObject>();
+            AttributedSignatureRegistry::UnregisterSignatures<GameObject>();
+            AttributedSignatureRegistry::UnregisterSignatures<Transform>();
+        }
+
+        TEST_METHOD(ViewMappedFile) {
+            Scope source{};
+            source["Integers"s].PushBack(5);
+            source["Integers"s].PushBack(6);
+            source["Float"s] = 1.5f;
+            source["Names"s].PushBack("First"s);
+            source["Names"s].PushBack("Second"s);
+            source["Matrix"s] = mat4{2.f};
+            Scope& nested = source.AppendScope("Nested"s);
+            nested["Vector"s] = vec4{1.f, 2.f, 3.f, 4.f};
+            source.AppendScope("Nested"s)["Integer"s] = 7;
+            source["Hierarchy"s].PushBack(std::make_unique<TestGameObject>("Root"s));
+
+            const std::string filename = ScratchFile("ViewMappedFile"s);
+            {
+                std::ofstream file{filename, std::ios::binary};
+                ScopeBinaryWriter{file}.Write(source);
+            }
+
+            {
+                ScopeImage image{filename};
+                ScopeView root = image.Root();
+
+                Assert::AreEqual("Scope"s, std::string{root.ClassName()});
+                Assert::AreEqual(source.Size(), root.Size());
+                Assert::AreEqual("Integers"s, std::string{root.At(size_type(0)).Key()});
+
+                DatumView datum{};
+                Assert::IsFalse(root.TryFind("Missing"s, datum));
+                Assert::IsTrue(root.TryFind("Integers"s, datum));
+                Assert::AreEqual(Datum::DatumType::Integer, datum.Type());
+                Assert::AreEqual(size_type(2), datum.Size());
+                Assert::AreEqual(6, datum.GetIntegerElement(1));
+                Assert::ExpectException<std::out_of_range>([&datum]() { auto _ = datum.GetIntegerElement(2); UNREFERENCED_LOCAL(_); });
+                Assert::ExpectException<std::invalid_argument>([&datum]() { auto _ = datum.GetFloatElement(); UNREFERENCED_LOCAL(_); });
+
+                Datum bound{};
+                datum.Bind(bound);
+                Assert::IsTrue(bound.IsDataExternalConst());
+                Assert::AreEqual(size_type(2), bound.Size());
+                Assert::IsFalse(bound.IsDataInternal());
+                Assert::AreEqual(6, bound.CGetIntegerElement(1));
+
+                Assert::IsTrue(root.TryFind("Float"s, datum));
+                Assert::AreEqual(1.5f, datum.GetFloatElement());
+                Assert::IsTrue(root.TryFind("Names"s, datum));
+                Assert::AreEqual("Second"s, std::string{datum.GetStringElement(1)});
+                Assert::ExpectException<std::invalid_argument>([&datum, &bound]() { datum.Bind(bound); });
+                Assert::IsTrue(root.TryFind("Matrix"s, datum));
+                Assert::AreEqual(mat4{2.f}, datum.GetMatrixElement());
+
+                Assert::IsTrue(root.TryFind("Nested"s, datum));
+                Assert::AreEqual(size_type(2), datum.Size());
+                Assert::IsTrue(datum.GetTableElement().TryFind("Vector"s, datum));
+                Assert::AreEqual(vec4{1.f, 2.f, 3.f, 4.f}, datum.GetVectorElement());
+
+                Assert::IsTrue(root.TryFind("Nested"s, datum));
+                size_type visited = 0;
+                datum.ForEachTableElement([&visited](const ScopeView& view) { visited += view.Size(); });
+                Assert::AreEqual(size_type(2), visited);
+
+                Scope::ScopeUniquePointer promoted = datum.GetTableElement(1).Promote();
+                Assert::IsTrue(*promoted == source["Nested"s].CGetTableElement(1));
+                promoted->At("Integer"s) = 8;
+                Assert::AreEqual(7, datum.GetTableElement(1).At(size_type(0)).GetIntegerElement());
+
+                Assert::IsTrue(root.TryFind("Hierarchy"s, datum));
+                Assert::AreEqual("TestGameObject"s, std::string{datum.GetTableElement().ClassName()});
+
+                Scope::ScopeUniquePointer whole = root.Promote();
+                Assert::IsTrue(*whole == source);
+            }
+
+            std::filesystem::remove(filename);
+            Assert::ExpectException<std::runtime_error>([&filename]() { ScopeImage image{filename}; });
+        }
+
+        TEST_METHOD(ViewMemory) {
+            Scope source{};
+            source["Vectors"s].PushBack(vec4{1.f});
+            source["Vectors"s].PushBack(vec4{2.f});
+            source.AppendScope("Nested"s)["Name"s] = "Nested"s;
+
+            const std::string document = WriteDocument(source);
+            auto buffer = std::make_unique<std::byte[]>(document.size());
+            std::memcpy(buffer.get(), document.data(), document.size());
+
+            ScopeImage image{buffer.get(), document.size()};
+            Assert::AreEqual(document.size(), image.Size());
+
+            DatumView datum{};
+            Assert::IsTrue(image.Root().TryFind("Vectors"s, datum));
+            Assert::AreEqual(std::uintptr_t(0), reinterpret_cast<std::uintptr_t>(&datum.GetVectorElement()) % ScopeBinaryFormat::PAYLOAD_ALIGNMENT);
+            Assert::AreEqual(vec4{2.f}, datum.GetVectorElement(1));
+
+            size_type count = 0;
+            image.Root().ForEachDatum([&count](const DatumView&) { ++count; });
+            Assert::AreEqual(size_type(2), count);
+
+            Assert::ExpectException<std::runtime_error>([&buffer]() { ScopeImage truncated{buffer.get(), size_type(8)}; });
+            Assert::ExpectException<std::out_of_range>([&image]() { auto _ = image.Root().At(size_type(2)); UNREFERENCED_LOCAL(_); });
+
+            ScopeImage truncated{buffer.get(), document.size() - 1};
+            Assert::ExpectException<std::runtime_error>([&truncated, &datum]() { auto _ = truncated.Root().TryFind("Nested"s, datum); UNREFERENCED_LOCAL(_); });
+        }
+
+        TEST_METHOD(ViewMisalignedMemory) {
+            Scope source{};
+            source["Matrix"s] = mat4{3.f};
+            source["Integer"s] = 4;
+
+            const std::string document = WriteDocument(source);
+            auto buffer = std::make_unique<std::byte[]>(document.size() + ScopeBinaryFormat::PAYLOAD_ALIGNMENT);
+            std::byte* misaligned = buffer.get() + 1;
+            if ((reinterpret_cast<std::uintptr_t>(misaligned) % ScopeBinaryFormat::PAYLOAD_ALIGNMENT) == 0) {
+                ++misaligned;
+            }
+            std::memcpy(misaligned, document.data(), document.size());
+
+            ScopeImage image{misaligned, document.size()};
+            Assert::AreNotEqual(static_cast<const void*>(misaligned), static_cast<const void*>(image.Data()));
+            Assert::AreEqual(std::uintptr_t(0), reinterpret_cast<std::uintptr_t>(image.Data()) % ScopeBinaryFormat::PAYLOAD_ALIGNMENT);
+
+            // The document is copied, so the image no longer depends on the given memory.
+            std::memset(misaligned, 0, document.size());
+            DatumView datum = image.Root().At(size_type(0));
+            Assert::AreEqual(std::uintptr_t(0), reinterpret_cast<std::uintptr_t>(&datum.GetMatrixElement()) % ScopeBinaryFormat::PAYLOAD_ALIGNMENT);
+            Assert::AreEqual(mat4{3.f}, datum.GetMatrixElement());
+            Assert::AreEqual(4, image.Root().At(size_type(1)).GetIntegerElement());
+        }
+
+        TEST_METHOD(IndexOutOfOrder) {
+            Scope source{};
+            for (auto i = 0; i < 8; ++i) {
+                source.AppendScope("Tables"s)["Name"s] = std::to_string(i);
+            }
+            for (auto i = 0; i < 8; ++i) {
+                source["Value"s + std::to_string(i)] = i;
+            }
+
+            const std::string document = WriteDocument(source);
+            auto buffer = std::make_unique<std::byte[]>(document.size());
+            std::memcpy(buffer.get(), document.data(), document.size());
+            ScopeImage image{buffer.get(), document.size()};
+
+            const ScopeView root = image.Root();
+            DatumView tables{};
+            Assert::IsTrue(root.TryFind("Tables"s, tables));
+
+            for (auto i : {7, 0, 3, 5, 1, 6, 2, 4}) {
+                Assert::AreEqual("Value"s + std::to_string(i), std::string{root.At(size_type(i + 1)).Key()});
+                Assert::AreEqual(i, root.At(size_type(i + 1)).GetIntegerElement());
+
+                DatumView name{};
+                Assert::IsTrue(tables.GetTableElement(size_type(i)).TryFind("Name"s, name));
+                Assert::AreEqual(std::to_string(i), std::string{name.GetStringElement()});
+            }
+
+            Assert::ExpectException<std::out_of_range>([&tables]() { auto _ = tables.GetTableElement(size_type(8)); UNREFERENCED_LOCAL(_); });
+        }
+
+        BENCHMARK_METHOD(BenchmarkOpen) {
+            Scope source{};
+            Datum& cubes = source["Cubes"s];
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                auto cube = std::make_unique<GameObject>("Cube "s + std::to_string(i));
+                cube->LocalTranslate(vec4{float(i % 7), 0.f, float(i / 7), 0.f});
+                cubes.PushBack(std::move(cube));
+            }
+
+            const std::string filename = ScratchFile("BenchmarkOpen"s);
+            {
+                std::ofstream file{filename, std::ios::binary};
+                ScopeBinaryWriter{file}.Write(source);
+            }
+
+            auto start = clock::now();
+            std::ifstream file{filename, std::ios::binary};
+            Scope::ScopeUniquePointer loaded = ScopeBinaryReader{file}.Read();
+            float loadedSum = 0.f;
+            const Datum& loadedCubes = loaded->At("Cubes"s);
+            for (auto i = size_type(0); i < loadedCubes.Size(); ++i) {
+                loadedSum += static_cast<const GameObject&>(loadedCubes.CGetTableElement(i)).GetTransform().GetLocalPosition()[2];
+            }
+            auto byReaderTime = clock::now() - start;
+
+            start = clock::now();
+            float viewedSum = 0.f;
+            {
+                ScopeImage image{filename};
+                DatumView datum{};
+                Assert::IsTrue(image.Root().TryFind("Cubes"s, datum));
+                datum.ForEachTableElement([&viewedSum](const ScopeView& cube) {
+                    DatumView transform{};
+                    DatumView position{};
+                    if (cube.TryFind("Transform"s, transform) && transform.GetTableElement().TryFind("LocalPosition"s, position)) {
+                        viewedSum += position.GetVectorElement()[2];
+                    }
+                });
+            }
+            auto byImageTime = clock::now() - start;
+
+            file.close();
+            std::filesystem::remove(filename);
+            Assert::AreEqual(loadedSum, viewedSum);
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Reading positions of "s + std::to_string(BENCHMARK_COUNT) + " game objects, by loading: "s
+                + std::to_string(duration_cast<microseconds>(byReaderTime).count()) + "us, by mapping: "s
+                + std::to_string(duration_cast<microseconds>(byImageTime).count()) + "us\n"s).c_str());
+        }
+    };
+}
@@ -0,0 +1,218 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <chrono>
+#include "ScopePrototype.h"
+#include "AttributedSignatureRegistry.h"
+#include "AttributedTestMonster.h"
+#include "Benchmark.h"
+#include "TestGameObject.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::literals::string_literals;
+
+namespace LibraryDesktopTests {
+    TEST_CLASS(ScopePrototypeTests) {
+
+    private:
+        inline static _CrtMemState _startMemState;
+
+        using size_type = Scope::size_type;
+        using vec4 = Transform::vec4;
+        using clock = std::chrono::high_resolution_clock;
+
+        inline static const std::size_t BENCHMARK_COUNT = 10000;
+
+    public:
+        TEST_METHOD_INITIALIZE(Initialize) {
+            AttributedSignatureRegistry::RegisterSignatures<Transform>();
+            AttributedSignatureRegistry::RegisterSignatures<GameObject>();
+            AttributedSignatureRegistry::RegisterSignatures<TestGameObject, GameObject>();
+            AttributedSignatureRegistry::RegisterSignatures<AttributedThing>();
+            AttributedSignatureRegistry::RegisterSignatures<AttributedTestMonster, AttributedThing>();
+            ScopeFactory::Register();
+            TransformFactory::Register();
+            GameObjectFactory::Register();
+            TestGameObjectFactory::Register();
+            AttributedThingFactory::Register();
+
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+            _CrtMemCheckpoint(&_startMemState);
+    #endif
+        }
+
+        TEST_METHOD_CLEANUP(Cleanup) {
+    #if defined(DEBUG) || defined(_DEBUG)
+            _CrtMemState endMemState, diffMemState;
+            _CrtMemCheckpoint(&endMemState);
+
+            if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState)) {
+                _CrtMemDumpStatistics(&diffMemState);
+                Assert::Fail(L"Memory Leaks!");
+            }
+    #endif
+
+            AttributedThingFactory::Unregister();
+            TestGameObjectFactory::Unregister();
+            GameObjectFactory::Unregister();
+            TransformFactory::Unregister();
+            ScopeFactory::Unregister();
+            AttributedSignatureRegistry::UnregisterSignatures<AttributedTestMonster>();
+            AttributedSignatureRegistry::UnregisterSignatures<AttributedThing>();
+            AttributedSignatureRegistry::UnregisterSignatures<TestGameObject>();
+            AttributedSignatureRegistry::UnregisterSignatures<GameObject>();
+            AttributedSignatureRegistry::UnregisterSignatures<Transform>();
+        }
+
+        TEST_METHOD(Empty) {
+            ScopePrototype prototype{};
+
+            Assert::IsTrue(prototype.IsEmpty());
+            Assert::AreEqual(size_type(0), prototype.NodeCount());
+            Assert::ExpectException<std::logic_error>([&prototype]() { auto _ = prototype.Instantiate(); UNREFERENCED_LOCAL(_); });
+
+            prototype.Snapshot(Scope{});
+            Assert::IsFalse(prototype.IsEmpty());
+            Assert::AreEqual(size_type(1), prototype.NodeCount());
+
+            prototype.Clear();
+            Assert::IsTrue(prototype.IsEmpty());
+        }
+
+        TEST_METHOD(InstantiateScope) {
+            Scope source{};
+            source["Integer"s] = 5;
+            source["Floats"s].PushBack(1.f);
+            source["Floats"s].PushBack(2.f);
+            source["Name"s] = "Source"s;
+            source["Untyped"s];
+            Scope& nested = source.AppendScope("Nested"s);
+            nested["Vector"s] = vec4{1.f, 2.f, 3.f, 4.f};
+            nested.AppendScope("Deeper"s)["Strings"s].PushBack("a"s);
+
+            ScopePrototype prototype{source};
+            Assert::AreEqual(size_type(3), prototype.NodeCount());
+            Assert::AreEqual(sizeof(Datum::Integer) + (sizeof(Datum::Float) * 2) + sizeof(vec4), std::size_t(prototype.PayloadSize()));
+
+            Scope::ScopeUniquePointer instance = prototype.Instantiate();
+            Assert::IsTrue(*instance == source);
+            Assert::IsNull(instance->Parent());
+            Assert::AreEqual(source.Size(), instance->Size());
+            Assert::IsTrue((*instance)["Nested"s].CGetTableElement().Parent() == instance.get());
+            Assert::AreEqual(Datum::DatumType::Unknown, (*instance)["Untyped"s].ActualType());
+
+            source["Integer"s] = 6;
+            nested["Vector"s] = vec4{};
+            Assert::AreEqual(5, (*instance)["Integer"s].FrontInteger());
+            Assert::AreEqual(vec4{1.f, 2.f, 3.f, 4.f}, (*instance)["Nested"s].CGetTableElement()["Vector"s].FrontVector());
+
+            Scope::ScopeUniquePointer other = prototype.Instantiate();
+            Assert::IsTrue(*instance == *other);
+            Assert::IsFalse(*other == source);
+        }
+
+        TEST_METHOD(InstantiateGameObject) {
+            TestGameObject source{"Root"s};
+            source.LocalTranslate(vec4{1.f, 2.f, 3.f, 0.f});
+            source.CreateChild("TestGameObject"s, "First"s).LocalTranslate(vec4{0.f, 1.f, 0.f, 0.f});
+            source.CreateChild("Second"s).AppendAuxiliaryAttribute("Bonus"s) = 10;
+
+            Datum::Integer external = 7;
+            source.AppendAuxiliaryAttribute("External"s).SetStorage(&external, size_type(1));
+
+            ScopePrototype prototype{source};
+            Scope::ScopeUniquePointer instance = prototype.Instantiate();
+
+            TestGameObject* root = instance->As<TestGameObject>();
+            Assert::IsNotNull(root);
+            Assert::IsTrue(*instance == source);
+            Assert::AreEqual("Root"s, root->GetName());
+            Assert::IsTrue(source.GetTransform() == root->GetTransform());
+            Assert::AreSame(static_cast<const Scope&>(root->GetTransform()), root->CAt("Transform"s).CGetTableElement());
+            Assert::AreEqual(size_type(2), root->GetChildren().Size());
+            Assert::IsTrue(root->GetChild().Is(TestGameObject::TypeIdClass()));
+            Assert::AreEqual(vec4{0.f, 1.f, 0.f, 0.f}, root->GetChild().GetTransform().GetLocalPosition());
+            Assert::AreEqual(10, root->GetChild(size_type(1)).CAt("Bonus"s).FrontInteger());
+            Assert::AreSame(static_cast<const Scope&>(*root), *root->GetChild().Parent());
+
+            // Auxiliary attributes with external storage are copied, so instances never refer to the source's storage.
+            Assert::IsTrue(root->CAt("External"s).IsDataInternal());
+            external = 8;
+            Assert::AreEqual(7, root->CAt("External"s).FrontInteger());
+        }
+
+        TEST_METHOD(OutlivesSource) {
+            ScopePrototype prototype{};
+
+            {
+                auto external = std::make_unique<Datum::Float[]>(2);
+                external[0] = 1.5f;
+                external[1] = 2.5f;
+                Scope shared{};
+                shared.Append("Value"s) = 3;
+                Scope* tables[] = {&shared};
+
+                Scope source{};
+                source.Append("Floats"s).SetStorage(external.get(), size_type(2));
+                source.Append("Shared"s).SetTableStorage(tables, size_type(1));
+                prototype.Snapshot(source);
+            }
+
+            Scope::ScopeUniquePointer instance = prototype.Instantiate();
+            Assert::IsTrue(instance->CAt("Floats"s).IsDataInternal());
+            Assert::AreEqual(size_type(2), instance->CAt("Floats"s).Size());
+            Assert::AreEqual(2.5f, instance->CAt("Floats"s).CGetFloatElement(1));
+
+            // External tables are instantiated as nested scopes owned by the instance.
+            Assert::IsTrue(Datum::DatumType::InternalTable == instance->CAt("Shared"s).ActualType());
+            Assert::AreEqual(3, instance->CAt("Shared"s).CFrontTable().CAt("Value"s).FrontInteger());
+            Assert::AreSame(static_cast<const Scope&>(*instance), *instance->CAt("Shared"s).CFrontTable().Parent());
+        }
+
+        TEST_METHOD(MissingFactory) {
+            ScopePrototype prototype{};
+            AttributedTestMonster monster{};
+            Scope scope{};
+            scope.AppendScope("Thing"s, "AttributedThing"s);
+
+            Assert::ExpectException<std::logic_error>([&prototype, &monster]() { prototype.Snapshot(monster); });
+
+            scope["Thing"s].PushBack(monster.Clone());
+            Assert::ExpectException<std::logic_error>([&prototype, &scope]() { prototype.Snapshot(scope); });
+        }
+
+        BENCHMARK_METHOD(BenchmarkInstantiate) {
+            GameObject source{"Cube"s};
+            source.LocalTranslate(vec4{1.f, 0.f, 1.f, 0.f});
+            for (auto i = 0; i < 6; ++i) {
+                source.CreateChild("Occupant"s + std::to_string(i)).AppendAuxiliaryAttribute("Value"s) = i;
+            }
+
+            Vector<Scope::ScopeUniquePointer> byClone{BENCHMARK_COUNT};
+            Vector<Scope::ScopeUniquePointer> byPrototype{BENCHMARK_COUNT};
+
+            auto start = clock::now();
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                byClone.EmplaceBack(source.Clone());
+            }
+            auto byCloneTime = clock::now() - start;
+
+            start = clock::now();
+            ScopePrototype prototype{source};
+            for (std::size_t i = 0; i < BENCHMARK_COUNT; ++i) {
+                byPrototype.EmplaceBack(prototype.Instantiate());
+            }
+            auto byPrototypeTime = clock::now() - start;
+
+            Assert::IsTrue(*byClone.Back() == *byPrototype.Back());
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Instantiating "s + std::to_string(BENCHMARK_COUNT) + " game objects, by clone: "s
+                + std::to_string(duration_cast<microseconds>(byCloneTime).count()) + "us, by prototype: "s
+                + std::to_string(duration_cast<microseconds>(byPrototypeTime).count()) + "us\n"s).c_str());
+        }
+    };
+}
@@ -1,8 +1,11 @@
 #include "pch.h"
 #include "CppUnitTest.h"
+#include <chrono>
+#include <unordered_set>
 #include "Foo.h"
 #include "Scope.h"
 #include "Bar.h"
+#include "Benchmark.h"
 #include "ToStringSpecializations.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -26,6 +29,47 @@ namespace LibraryDesktopTests {
         using Pointer = Datum::Pointer;
         using DatumType = Datum::DatumType;
 
+        using clock = std::chrono::high_resolution_clock;
+
+        inline static const Integer BENCHMARK_COUNT = 10000;
+
+        /// <returns>Bytes of String, Vector and Matrix elements stored by the given trees, counting arrays shared between datums once.</returns>
+        static std::size_t ElementBytes(const std::vector<const Scope*>& roots) {
+            std::unordered_set<const void*> arrays{};
+            std::size_t bytes = 0;
+
+            for (const Scope* root : roots) {
+                const_cast<Scope*>(root)->ForEachScopeInTree([&arrays, &bytes](Scope& scope, size_type) {
+                    for (auto i = size_type(0); i < scope.Size(); ++i) {
+                        const Datum& datum = scope.CAt(i);
+                        const void* array = nullptr;
+                        std::size_t elementSize = 0;
+
+                        if (datum.IsEmpty()) {
+                            continue;
+                        } else if (datum.IsType(DatumType::String)) {
+                            array = &(datum.CGetStringElement());
+                            elementSize = sizeof(String);
+                        } else if (datum.IsType(DatumType::Vector)) {
+                            array = &(datum.CGetVectorElement());
+                            elementSize = sizeof(Vector);
+                        } else if (datum.IsType(DatumType::Matrix)) {
+                            array = &(datum.CGetMatrixElement());
+                            elementSize = sizeof(Matrix);
+                        }
+
+                        if ((array != nullptr) && arrays.insert(array).second) {
+                            bytes += datum.Size() * elementSize;
+                        }
+                    }
+
+                    return false;
+                });
+            }
+
+            return bytes;
+        }
+
     public:
         TEST_METHOD_INITIALIZE(Initialize) {
     #if defined(DEBUG) || defined(_DEBUG)
@@ -328,12 +372,16 @@ namespace LibraryDesktopTests {
             Assert::IsFalse(scope.IsEmpty());
             Assert::IsFalse(child.IsEmpty());
 
-            child.DetachFromTree();
+            // The parent owns its nested scopes, so detaching one destroys it. Moving out of it detaches it and keeps its contents.
+            Scope detached{std::move(child)};
+            Assert::AreEqual(size_type(0), scope[CHILD].Size());
+            Assert::IsNull(detached.Parent());
 
             scope.Clear();
 
             Assert::IsTrue(scope.IsEmpty());
-            Assert::IsFalse(child.IsEmpty());
+            Assert::IsFalse(detached.IsEmpty());
+            Assert::AreEqual(size_type(5), detached[VALUES].Size());
         }
 
         TEST_METHOD(CopySemanticsAndEquals) {
@@ -696,6 +744,452 @@ namespace LibraryDesktopTests {
             Assert::IsFalse(children.CGetTableElement(size_type(2)).IsEmpty());
         }
 
+        TEST_METHOD(SearchCacheInvalidation) {
+            const key_type KEY = "Key"s;
+            const key_type CHILD = "Child"s;
+
+            Scope root{};
+            root.Append(KEY) = 1;
+            Scope& parent = root.AppendScope(CHILD);
+            Scope& child = parent.AppendScope(CHILD);
+
+            Scope* containingScope = nullptr;
+            Assert::AreEqual(1, child.Search(KEY, containingScope)->CFrontInteger());
+            Assert::AreEqual(&root, containingScope);
+            Assert::AreEqual(1, child.Search(KEY, containingScope)->CFrontInteger());
+            Assert::AreEqual(&root, containingScope);
+
+            parent.Append(KEY) = 2;
+            Assert::AreEqual(2, child.Search(KEY, containingScope)->CFrontInteger());
+            Assert::AreEqual(&parent, containingScope);
+
+            Assert::IsNull(child.Search(CHILD + KEY, containingScope));
+            Assert::IsNull(containingScope);
+            child.Append(CHILD + KEY) = 3;
+            Assert::AreEqual(3, child.Search(CHILD + KEY)->CFrontInteger());
+
+            Scope other{};
+            other.Append(KEY) = 4;
+            other.AttachAsChild(CHILD, parent.At(CHILD).BackTable().Clone());
+            Scope& moved = other.At(CHILD).BackTable();
+            Assert::AreEqual(4, moved.Search(KEY)->CFrontInteger());
+
+            parent.Clear();
+            Assert::AreEqual(1, parent.Search(KEY)->CFrontInteger());
+
+            Scope orphan{};
+            orphan.Append(KEY) = 5;
+            Assert::AreEqual(5, orphan.Search(KEY)->CFrontInteger());
+            Assert::IsTrue(orphan.TrySetParent(&root));
+            Assert::AreEqual(5, orphan.Search(KEY)->CFrontInteger());
+            Assert::IsTrue(orphan.Search(CHILD) == &(root.At(CHILD)));
+            orphan.DetachFromTree();
+        }
+
+        BENCHMARK_METHOD(BenchmarkDeepSearch) {
+            const key_type KEY = "Key"s;
+            const key_type CHILD = "Child"s;
+            const std::size_t DEPTH = 8;
+            const std::size_t SEARCHES = 1000000;
+
+            Scope root{};
+            root.Append(KEY) = 1;
+            Scope* deepest = &root;
+
+            for (std::size_t i = 1; i < DEPTH; ++i) {
+                deepest = &(deepest->AppendScope(CHILD));
+                deepest->Append(CHILD + std::to_string(i)) = static_cast<Integer>(i);
+            }
+
+            Integer byWalkSum = 0;
+            auto start = clock::now();
+            for (std::size_t i = 0; i < SEARCHES; ++i) {
+                for (Scope* scope = deepest; scope != nullptr; scope = scope->Parent()) {
+                    auto found = scope->Find(KEY);
+
+                    if (found != scope->end()) {
+                        byWalkSum += found->second.CFrontInteger();
+                        break;
+                    }
+                }
+            }
+            auto byWalkTime = clock::now() - start;
+
+            Integer bySearchSum = 0;
+            start = clock::now();
+            for (std::size_t i = 0; i < SEARCHES; ++i) {
+                bySearchSum += deepest->Search(KEY)->CFrontInteger();
+            }
+            auto bySearchTime = clock::now() - start;
+
+            Assert::AreEqual(byWalkSum, bySearchSum);
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Searching "s + std::to_string(SEARCHES) + " times from " + std::to_string(DEPTH) + " deep, by walking parents: "s
+                + std::to_string(duration_cast<microseconds>(byWalkTime).count()) + "us, by cached search: "s
+                + std::to_string(duration_cast<microseconds>(bySearchTime).count()) + "us\n"s).c_str());
+        }
+
+        TEST_METHOD(ForEachScopeInTree) {
+            const key_type NAME = "Name"s;
+            const key_type CHILD = "Child"s;
+
+            Scope root{};
+            root.Append(NAME) = "R"s;
+            Scope& first = root.AppendScope(CHILD);
+            first.Append(NAME) = "A"s;
+            first.AppendScope(CHILD).Append(NAME) = "B"s;
+            root.AppendScope(CHILD).Append(NAME) = "C"s;
+
+            String visited{};
+            auto visit = [&visited, &NAME](Scope& scope, size_type depth) {
+                visited += scope.At(NAME).CFrontString() + std::to_string(depth);
+                return false;
+            };
+
+            root.ForEachScopeInTree(visit);
+            Assert::AreEqual("R0A1B2C1"s, visited);
+
+            visited.clear();
+            root.ForEachScopeInTree(visit, Scope::TraversalOrder::PostOrder);
+            Assert::AreEqual("B2A1C1R0"s, visited);
+
+            visited.clear();
+            root.ForEachScopeInTree([&visited, &NAME](Scope& scope, size_type) {
+                visited += scope.At(NAME).CFrontString();
+                return scope.At(NAME).CFrontString() == "B"s;
+            });
+            Assert::AreEqual("RAB"s, visited);
+
+            visited.clear();
+            root.ForEachScopeInTree([&visited, &NAME, &CHILD](Scope& scope, size_type depth) {
+                visited += scope.At(NAME).CFrontString();
+
+                if (depth == size_type(2)) {
+                    scope.AppendScope(CHILD).Append(NAME) = "D"s;
+                }
+
+                return false;
+            });
+            Assert::AreEqual("RABDC"s, visited);
+        }
+
+        TEST_METHOD(DeepChainStress) {
+            const key_type CHILD = "Child"s;
+            const key_type VALUE = "Value"s;
+
+            // Deep enough to overflow the default 1MB stack if any of these recursed, and no deeper, as it runs with every unit test.
+            const Integer DEPTH = 20000;
+
+            auto build = [&CHILD, &VALUE, DEPTH](Scope& root) {
+                Scope* deepest = &root;
+
+                for (auto i = 0; i < DEPTH; ++i) {
+                    deepest = &(deepest->AppendScope(CHILD));
+                    deepest->Append(VALUE) = i;
+                }
+
+                return deepest;
+            };
+
+            auto lhs = std::make_unique<Scope>();
+            auto rhs = std::make_unique<Scope>();
+            Scope* lhsDeepest = build(*lhs);
+            Scope* rhsDeepest = build(*rhs);
+
+            Assert::IsTrue(*lhs == *rhs);
+            rhsDeepest->At(VALUE) = -1;
+            Assert::IsFalse(*lhs == *rhs);
+
+            Assert::IsTrue(lhs->IsThisOrAncestorOf(*lhsDeepest));
+            Assert::IsTrue(lhsDeepest->IsDescendantOf(*lhs));
+            Assert::IsFalse(lhs->IsThisOrAncestorOf(*rhsDeepest));
+
+            size_type maxDepth = size_type(0);
+            lhs->ForEachScopeInTree([&maxDepth](Scope&, size_type depth) { maxDepth = std::max(maxDepth, depth); return false; });
+            Assert::AreEqual(size_type(DEPTH), maxDepth);
+
+            const String string = lhs->ToString();
+            Assert::AreEqual("{ pair{ \"Value\": [ "s + std::to_string(DEPTH - 1) + " ] } }"s, lhsDeepest->ToString());
+            Assert::AreEqual(0, string.compare(0, 32, "{ pair{ \"Child\": [ { pair{ \"Valu"s));
+            Assert::AreEqual(0, string.compare(string.size() - 6, 6, " ] } }"s));
+
+            rhs->Clear();
+            Assert::IsTrue(rhs->IsEmpty());
+
+            lhs.reset();
+            rhs.reset();
+        }
+
+        TEST_METHOD(DetachKeepsSiblingPositions) {
+            const key_type CHILDREN = "Children"s;
+            const key_type INDEX = "Index"s;
+
+            Scope scope{};
+            Scope* children[5];
+
+            for (auto i = 0; i < 5; ++i) {
+                children[i] = &scope.AppendScope(CHILDREN);
+                children[i]->Append(INDEX) = i;
+            }
+
+            children[1]->DetachFromTree();
+            children[3]->DetachFromTree();
+
+            Assert::AreEqual(size_type(3), scope.At(CHILDREN).Size());
+            Assert::AreEqual(0, scope.At(CHILDREN).GetTableElement(0).At(INDEX).FrontInteger());
+            Assert::AreEqual(2, scope.At(CHILDREN).GetTableElement(1).At(INDEX).FrontInteger());
+            Assert::AreEqual(4, scope.At(CHILDREN).GetTableElement(2).At(INDEX).FrontInteger());
+
+            Scope moved{std::move(scope)};
+            children[4]->DetachFromTree();
+
+            Assert::AreEqual(size_type(2), moved.At(CHILDREN).Size());
+            Assert::AreEqual(&moved, children[0]->Parent());
+
+            Scope copy{moved};
+            copy.At(CHILDREN).GetTableElement(0).DetachFromTree();
+
+            Assert::AreEqual(size_type(1), copy.At(CHILDREN).Size());
+            Assert::AreEqual(2, copy.At(CHILDREN).GetTableElement(0).At(INDEX).FrontInteger());
+            Assert::AreEqual(size_type(2), moved.At(CHILDREN).Size());
+
+            children[0]->DetachFromTree();
+            Assert::AreEqual(size_type(1), moved.At(CHILDREN).Size());
+            Assert::AreEqual(2, moved.At(CHILDREN).GetTableElement(0).At(INDEX).FrontInteger());
+        }
+
+        BENCHMARK_METHOD(BenchmarkDestroyWideScope) {
+            const key_type CHILDREN = "Children"s;
+            const key_type VALUE = "Value"s;
+
+            auto populate = [&CHILDREN, &VALUE](Scope& scope) {
+                for (auto i = 0; i < BENCHMARK_COUNT; ++i) {
+                    scope.AppendScope(CHILDREN).Append(VALUE) = i;
+                }
+            };
+
+            auto scope = std::make_unique<Scope>();
+            populate(*scope);
+
+            auto start = clock::now();
+            scope.reset();
+            auto destroyTime = clock::now() - start;
+
+            scope = std::make_unique<Scope>();
+            populate(*scope);
+            Datum& children = scope->At(CHILDREN);
+
+            start = clock::now();
+            while (!children.IsEmpty()) {
+                children.BackTable().DetachFromTree();
+            }
+            auto detachTime = clock::now() - start;
+
+            Assert::AreEqual(size_type(1), scope->Size());
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Removing "s + std::to_string(BENCHMARK_COUNT) + " children, by destroying the parent: "s
+                + std::to_string(duration_cast<microseconds>(destroyTime).count()) + "us, by detaching each child: "s
+                + std::to_string(duration_cast<microseconds>(detachTime).count()) + "us\n"s).c_str());
+        }
+
+        TEST_METHOD(ContentHash) {
+            Scope lhs{};
+            lhs["Integer"s] = 1;
+            lhs["Strings"s] = {"A"s, "B"s};
+            Scope& lhsNested = lhs.AppendScope("Nested"s);
+            lhsNested["Vector"s] = Vector{1.f, 2.f, 3.f, 4.f};
+
+            Scope rhs{};
+            rhs.AppendScope("Nested"s)["Vector"s] = Vector{1.f, 2.f, 3.f, 4.f};
+            rhs["Strings"s] = {"A"s, "B"s};
+            rhs["Integer"s] = 1;
+
+            const size_type original = lhs.ContentHash();
+            Assert::AreEqual(original, lhs.ContentHash());
+            Assert::AreEqual(original, rhs.ContentHash());
+            Assert::AreEqual(lhs, rhs);
+
+            lhsNested["Vector"s] = Vector{0.f};
+            Assert::AreNotEqual(original, lhs.ContentHash());
+            Assert::AreNotEqual(lhs, rhs);
+            lhsNested["Vector"s].GetVectorElement() = Vector{1.f, 2.f, 3.f, 4.f};
+            Assert::AreEqual(original, lhs.ContentHash());
+            Assert::AreEqual(lhs, rhs);
+
+            lhs["Strings"s].GetStringElement(1) = "C"s;
+            Assert::AreNotEqual(original, lhs.ContentHash());
+            lhs["Strings"s].SetElement("B"s, 1);
+            Assert::AreEqual(original, lhs.ContentHash());
+
+            Scope& added = lhsNested.AppendScope("Added"s);
+            const size_type withAdded = lhs.ContentHash();
+            Assert::AreNotEqual(original, withAdded);
+            added["Integer"s] = 2;
+            Assert::AreNotEqual(withAdded, lhs.ContentHash());
+            added.DetachFromTree();
+            Assert::AreNotEqual(withAdded, lhs.ContentHash());
+            Assert::AreNotEqual(original, lhs.ContentHash());
+
+            Scope copy{rhs};
+            Assert::AreEqual(original, copy.ContentHash());
+            copy.Clear();
+            Assert::AreEqual(Scope{}.ContentHash(), copy.ContentHash());
+
+            Integer external = 1;
+            Scope withExternal{};
+            withExternal["External"s].SetStorage(&external, size_type(1));
+            const size_type beforeExternal = withExternal.ContentHash();
+            external = 2;
+            Assert::AreNotEqual(beforeExternal, withExternal.ContentHash());
+            external = 1;
+            Assert::AreEqual(beforeExternal, withExternal.ContentHash());
+
+            // Const storage can still be written by its owner.
+            Scope withConst{};
+            withConst["Const"s].SetStorage(&external, size_type(1), true);
+            const size_type beforeConst = withConst.ContentHash();
+            external = 3;
+            Assert::AreNotEqual(beforeConst, withConst.ContentHash());
+        }
+
+        BENCHMARK_METHOD(BenchmarkCompareLargeTrees) {
+            const std::size_t BRANCHES = 100;
+            const std::size_t LEAVES = std::size_t(BENCHMARK_COUNT) / BRANCHES;
+
+            Scope lhs{};
+            for (std::size_t i = 0; i < BRANCHES; ++i) {
+                Scope& branch = lhs.AppendScope("Branch"s);
+                branch["Index"s] = static_cast<Integer>(i);
+
+                for (std::size_t j = 0; j < LEAVES; ++j) {
+                    Scope& leaf = branch.AppendScope("Leaf"s);
+                    leaf["Position"s] = Vector{static_cast<Float>(i), static_cast<Float>(j), 0.f, 1.f};
+                    leaf["Name"s] = "Leaf "s + std::to_string(j);
+                }
+            }
+
+            Scope rhs{lhs};
+            Scope& changed = rhs["Branch"s].FrontTable()["Leaf"s].FrontTable();
+            changed["Name"s] = "Changed"s;
+
+            auto start = clock::now();
+            const bool isEqualByWalk = (lhs == rhs);
+            auto byWalkTime = clock::now() - start;
+
+            start = clock::now();
+            const bool isHashDifferent = (lhs.ContentHash() != rhs.ContentHash());
+            auto hashTime = clock::now() - start;
+
+            start = clock::now();
+            const bool isEqualByHash = (lhs == rhs);
+            auto byHashTime = clock::now() - start;
+
+            changed["Name"s] = "Leaf 0"s;
+            start = clock::now();
+            const bool isHashSame = (lhs.ContentHash() == rhs.ContentHash());
+            auto rehashTime = clock::now() - start;
+
+            Assert::IsFalse(isEqualByWalk);
+            Assert::IsTrue(isHashDifferent);
+            Assert::IsFalse(isEqualByHash);
+            Assert::IsTrue(isHashSame);
+            Assert::AreEqual(lhs, rhs);
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Comparing trees of "s + std::to_string(BENCHMARK_COUNT) + " scopes differing in one leaf, by walking: "s
+                + std::to_string(duration_cast<microseconds>(byWalkTime).count()) + "us, by cached hash: "s
+                + std::to_string(duration_cast<microseconds>(byHashTime).count()) + "us, after hashing both in "s
+                + std::to_string(duration_cast<microseconds>(hashTime).count()) + "us and rehashing the changed leaf in "s
+                + std::to_string(duration_cast<microseconds>(rehashTime).count()) + "us\n"s).c_str());
+        }
+
+        TEST_METHOD(Snapshot) {
+            Scope source{};
+            source["Name"s] = "Source"s;
+            Scope& nested = source.AppendScope("Nested"s);
+            nested["Path"s] = {Vector{1.f}, Vector{2.f}};
+
+            Scope::ScopeUniquePointer snapshot = source.Snapshot();
+            Assert::AreEqual(source, *snapshot);
+            Assert::IsTrue(snapshot->At("Name"s).IsDataShared());
+
+            Scope& snapshotNested = snapshot->At("Nested"s).GetTableElement();
+            Assert::AreNotSame(nested, snapshotNested);
+            Assert::IsTrue(snapshotNested.Parent() == snapshot.get());
+            Assert::AreSame(nested.At("Path"s).CGetVectorElement(), snapshotNested.At("Path"s).CGetVectorElement());
+
+            nested["Path"s].SetElement(Vector{3.f}, size_type(1));
+            Assert::AreEqual(Vector{2.f}, snapshotNested.At("Path"s).CGetVectorElement(1));
+            Assert::AreNotEqual(source, *snapshot);
+
+            snapshot->At("Name"s) = "Snapshot"s;
+            Assert::AreEqual("Source"s, source.At("Name"s).CGetStringElement());
+
+            Scope::ScopeUniquePointer clone = source.Clone();
+            Assert::IsFalse(clone->At("Name"s).IsDataShared());
+        }
+
+        BENCHMARK_METHOD(BenchmarkSnapshot) {
+            const std::size_t OBJECTS = 1000;
+            const std::size_t FRAMES = 60;
+            const std::size_t MOVED_PER_FRAME = 10;
+
+            // Stands in for a level: objects with a name, a transform and a path, most of which stay put from one frame to the next.
+            Scope level{};
+            for (std::size_t i = 0; i < OBJECTS; ++i) {
+                Scope& object = level.AppendScope("Objects"s);
+                object["Name"s] = "Object "s + std::to_string(i);
+                object["Transform"s] = Matrix{1.f};
+                Datum& path = object["Path"s];
+                for (std::size_t j = 0; j < 8; ++j) {
+                    path.PushBack(Vector{static_cast<Float>(i), static_cast<Float>(j), 0.f, 1.f});
+                }
+            }
+
+            const auto runFrames = [&level, &FRAMES, &MOVED_PER_FRAME](bool isSharing, std::size_t& outputBytes) {
+                Scope copy{level};
+                std::vector<Scope::ScopeUniquePointer> states{};
+                Datum& objects = copy["Objects"s];
+
+                auto start = clock::now();
+                for (std::size_t frame = 0; frame < FRAMES; ++frame) {
+                    states.push_back(isSharing ? copy.Snapshot() : copy.Clone());
+
+                    for (std::size_t i = 0; i < MOVED_PER_FRAME; ++i) {
+                        Scope& moved = objects.GetTableElement((frame * MOVED_PER_FRAME + i) % objects.Size());
+                        moved["Transform"s].GetMatrixElement()[3][0] += 1.f;
+                    }
+                }
+                auto time = clock::now() - start;
+
+                std::vector<const Scope*> roots{&copy};
+                for (const auto& state : states) {
+                    roots.push_back(state.get());
+                }
+
+                outputBytes = ElementBytes(roots);
+                return time;
+            };
+
+            std::size_t byCloneBytes = 0;
+            std::size_t bySnapshotBytes = 0;
+            auto byCloneTime = runFrames(false, byCloneBytes);
+            auto bySnapshotTime = runFrames(true, bySnapshotBytes);
+
+            Assert::IsTrue(bySnapshotBytes < byCloneBytes);
+
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            Logger::WriteMessage(("Saving "s + std::to_string(FRAMES) + " frames of "s + std::to_string(OBJECTS) + " objects, by clone: "s
+                + std::to_string(duration_cast<microseconds>(byCloneTime).count()) + "us and "s + std::to_string(byCloneBytes) + " bytes, by snapshot: "s
+                + std::to_string(duration_cast<microseconds>(bySnapshotTime).count()) + "us and "s + std::to_string(bySnapshotBytes) + " bytes\n"s).c_str());
+        }
+
         TEST_METHOD(TrySetParent) {
             Scope parent{};
             Scope child{};
@@ -748,5 +1242,107 @@ namespace LibraryDesktopTests {
 
             Assert::ExpectException<std::invalid_argument>([&ATTACHED, &ptr, &root](){ ptr->AttachAsChild(ATTACHED, std::move(root)); });
         }
+
+        TEST_METHOD(Handle) {
+            Scope holder{};
+            {
+                Scope root{};
+                Scope& child = root.AppendScope("Child"s);
+                child.Append("Name"s) = "Child"s;
+
+                const ScopeHandle handle = child.Handle();
+                Assert::IsTrue(handle.IsValid());
+                Assert::IsTrue(handle.Resolve() == &child);
+                Assert::IsTrue(handle == child.Handle());
+                Assert::IsTrue(handle != root.Handle());
+                Assert::AreEqual(size_type(2), ScopeHandle::LiveCount());
+
+                holder["Target"s] = handle;
+                holder["Targets"s] = Datum{handle, root.Handle()};
+                Assert::AreEqual(DatumType::Handle, holder["Target"s].ApparentType());
+                Assert::IsTrue(holder["Target"s] == handle);
+                Assert::IsTrue(holder["Target"s].IsTruthy());
+                Assert::IsTrue(holder["Targets"s].IsContaining(handle));
+                Assert::IsTrue(holder["Target"s].GetHandleElement().Resolve<Scope>() == &child);
+                Assert::IsNull(holder["Target"s].GetHandleElement().Resolve<Foo>());
+
+                // Handles follow the scope they were issued for, wherever it is moved within the tree.
+                Scope::ScopeUniquePointer parent = std::make_unique<Scope>();
+                Scope::ScopeUniquePointer owned = std::make_unique<Scope>();
+                Scope& adopted = *owned;
+                const ScopeHandle adoptedHandle = adopted.Handle();
+                parent->AttachAsChild("Adopted"s, std::move(owned));
+                root.AttachAsChild("Parent"s, std::move(parent));
+                Assert::IsTrue(adoptedHandle.Resolve() == &adopted);
+                Assert::IsTrue(handle.Resolve() == &child);
+
+                // Copies are different scopes, so they are issued handles of their own.
+                Scope copy{child};
+                Assert::IsTrue(copy.Handle() != handle);
+                Assert::IsTrue(copy.Handle().Resolve() == &copy);
+            }
+
+            Assert::AreEqual(size_type(0), ScopeHandle::LiveCount());
+            Assert::IsFalse(holder["Target"s].GetHandleElement().IsValid());
+            Assert::IsNull(holder["Target"s].GetHandleElement().Resolve());
+            Assert::IsFalse(holder["Target"s].IsTruthy());
+            Assert::IsFalse(holder["Targets"s].IsTruthy(1));
+            Assert::AreEqual("null"s, holder["Target"s].ToString(size_type(0)));
+            Assert::IsFalse(ScopeHandle{}.IsValid());
+
+            // A scope issued the same slot later is not mistaken for the destroyed one.
+            Scope other{};
+            Assert::IsTrue(other.Handle() != holder["Target"s].GetHandleElement());
+            Assert::IsFalse(holder["Target"s].GetHandleElement().IsValid());
+        }
+
+        TEST_METHOD(SearchBinding) {
+            Scope root{};
+            root.Append("Value"s) = 1;
+            Scope& child = root.AppendScope("Child"s);
+            Scope& sibling = root.AppendScope("Child"s);
+
+            Scope::Binding binding{};
+            Assert::IsFalse(binding.IsCurrent(child));
+            Assert::IsTrue(child.Search("Value"s, binding) == &root["Value"s]);
+            Assert::IsTrue(binding.IsCurrent(child));
+            Assert::IsFalse(binding.IsCurrent(sibling));
+            Assert::IsTrue(child.CSearch("Value"s, binding) == &root["Value"s]);
+
+            // Shadowing the key adds one, which makes the binding stale.
+            child.Append("Value"s) = 2;
+            Assert::IsFalse(binding.IsCurrent(child));
+            Assert::IsTrue(child.Search("Value"s, binding) == &child["Value"s]);
+
+            // Misses are bound too.
+            Scope::Binding missing{};
+            Assert::IsNull(sibling.Search("Missing"s, missing));
+            Assert::IsTrue(missing.IsCurrent(sibling));
+
+            // Destroying a table element makes the binding stale, since it may have been bound into the destroyed scope.
+            binding.Bind(root, &sibling["Missing"s]);
+            Assert::IsTrue(root["Child"s].RemoveAt(1));
+            Assert::IsFalse(binding.IsCurrent(root));
+
+            // Moving a scope moves its datums away from it.
+            Scope original{};
+            original.Append("Value"s) = 3;
+            binding.Bind(original, &original["Value"s]);
+            Assert::IsTrue(binding.IsCurrent(original));
+            Scope target{std::move(original)};
+            Assert::IsFalse(binding.IsCurrent(original));
+            Assert::IsTrue(target.Search("Value"s, binding) == &target["Value"s]);
+
+            // Building and moving a scope no search has passed through cannot make a binding stale.
+            Scope built{};
+            built.Append("Value"s) = 4;
+            Scope moved{std::move(built)};
+            Assert::IsTrue(binding.IsCurrent(target));
+
+            // Once a search has passed through it, gaining a key can.
+            Assert::IsTrue(moved.Search("Value"s) == &moved["Value"s]);
+            moved.Append("Other"s) = 5;
+            Assert::IsFalse(binding.IsCurrent(target));
+        }
     };
 }
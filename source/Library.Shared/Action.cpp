@@ -20,14 +20,18 @@ namespace FieaGameEngine {
     }
 
     Datum* Action::Search(const key_type& key, Scope*& outputContainingScope) {
-        auto found = end();
         auto& stack = GameplayState::Singleton().ActionArgumentStack();
 
         if (!(stack.IsEmpty())) {
-            outputContainingScope = &(*(stack.Top()));
-            found = outputContainingScope->Find(key);
+            Scope& arguments = *(stack.Top());
+            auto found = arguments.Find(key);
+
+            if (found != arguments.end()) {
+                outputContainingScope = &arguments;
+                return &(found->second);
+            }
         }
 
-        return (found == end()) ? Attributed::Search(key, outputContainingScope) : &(found->second);
+        return Attributed::Search(key, outputContainingScope);
     }
 }
@@ -18,6 +18,10 @@ namespace FieaGameEngine {
 
         virtual void Update(const GameTime& gameTime) = 0;
 
+        /// <summary>
+        /// Searches the arguments on top of the action argument stack, then this action and its ancestors.
+        /// The arguments are popped without invalidating searches, so searches from actions are never bound.
+        /// </summary>
         virtual Datum* Search(const key_type& key, Scope*& outputContainingScope) override;
 
         String& Name();
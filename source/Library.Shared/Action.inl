@@ -4,9 +4,9 @@
 namespace FieaGameEngine {
     inline SignatureVector Action::Signatures() { return SignatureVector{ Signature{NAME_KEY, Datum::DatumType::String, true, Datum::size_type(1), offsetof(Action, _name)} }; }
 
-    inline Action::Action(IdType idOfSignaturesToAppend, const String& name) : Attributed{idOfSignaturesToAppend}, _name{name} {}
-    inline Action::Action(const Action& other) : Attributed{other}, _name{other._name} {}
-    inline Action::Action(Action&& other) noexcept : Attributed{std::move(other)}, _name{other._name} { other._name.clear(); }
+    inline Action::Action(IdType idOfSignaturesToAppend, const String& name) : Attributed{idOfSignaturesToAppend}, _name{name} { DisableSearchBinding(); }
+    inline Action::Action(const Action& other) : Attributed{other}, _name{other._name} { DisableSearchBinding(); }
+    inline Action::Action(Action&& other) noexcept : Attributed{std::move(other)}, _name{other._name} { other._name.clear(); DisableSearchBinding(); }
 
     inline typename Action::String& Action::Name() { return _name; }
     inline const typename Action::String& Action::GetName() const { return _name; }
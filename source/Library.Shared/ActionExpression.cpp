@@ -1,6 +1,5 @@
 #include "pch.h"
 #include "ActionExpression.h"
-#include <regex>
 #include "GameplayState.h"
 
 using namespace std::literals::string_literals;
@@ -19,15 +18,48 @@ namespace FieaGameEngine::Actions {
             Attributed::operator=(other);
             _expression = other._expression;
             _lastResult.Clear();
+            InvalidateCompiled();
         }
 
         return *this;
     }
 
+    void ActionExpression::Compile() {
+        if (_expression.empty() || !GameplayState::HasSingleton()) {
+            return;
+        }
+
+        Compile(!!_parent ? *_parent : *this);
+    }
+
     inline bool ActionExpression::Evaluate(Scope* context) {
-        return _expression.empty()
-            ? false 
-            : (_lastResult = GameplayState::Singleton().RpnEvaluator().Evaluate(_expression, !!context ? *context : *this)).IsTruthy();
+        if (_expression.empty()) {
+            return false;
+        }
+
+        Scope& target = !!context ? *context : *this;
+        Compile(target);
+        GameplayState::Singleton().RpnEvaluator().Evaluate(_compiled, target, _lastResult);
+        return _lastResult.IsTruthy();
+    }
+
+    void ActionExpression::Compile(const Scope& target) {
+        if (!_compiled.IsEmpty() && (_compiledFrom == _expression)) {
+            return;
+        }
+
+        const ReversePolishEvaluator& evaluator = GameplayState::Singleton().RpnEvaluator();
+        ActionProfiler::CountCompile(*this);
+        auto compiled = evaluator.Compile(_expression);
+
+        // Typed once against the context, so type errors are thrown before anything is written. Actions search the arguments
+        // of the event being handled before their own attributes, so only other attributed contexts are typed ahead of time.
+        if (target.Is(Attributed::TypeIdClass()) && !target.Is(Action::TypeIdClass())) {
+            evaluator.InferTypes(compiled, target.TypeIdInstance());
+        }
+
+        _compiled = std::move(compiled);
+        _compiledFrom = _expression;
     }
 
     std::string ActionExpression::ToString() const {
@@ -43,5 +75,7 @@ namespace FieaGameEngine::Actions {
 
         swap(_expression, other._expression);
         swap(_lastResult, other._lastResult);
+        swap(_compiled, other._compiled);
+        swap(_compiledFrom, other._compiledFrom);
     }
 }
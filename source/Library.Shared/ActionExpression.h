@@ -1,5 +1,6 @@
 #pragma once
 #include "Action.h"
+#include "ReversePolishEvaluator.h"
 
 namespace FieaGameEngine::Actions {
     class ActionExpression final : public Action {
@@ -23,6 +24,12 @@ namespace FieaGameEngine::Actions {
         bool Evaluate(Scope* context);
         bool Evaluate();
 
+        /// <summary>
+        /// Compiles the expression and types it against the parent, so type errors are thrown when the action is loaded rather than on its first update.
+        /// Does nothing while the expression is empty or there is no gameplay state to compile with.
+        /// </summary>
+        void Compile();
+
         void Clear() override;
         [[nodiscard]] ScopeUniquePointer Clone() const override;
         [[nodiscard]] std::string ToString() const override;
@@ -35,6 +42,23 @@ namespace FieaGameEngine::Actions {
         String _expression{};
         Datum _lastResult{};
 
+        /// <summary>
+        /// Expression as last compiled, and the expression it was compiled from.
+        /// The expression attribute can be written without going through the setter, so the two are compared before each evaluation.
+        /// </summary>
+        ReversePolishEvaluator::CompiledExpression _compiled{};
+        String _compiledFrom{};
+
+        /// <summary>
+        /// Discards the compiled expression, so it is compiled again before the next evaluation.
+        /// </summary>
+        void InvalidateCompiled();
+
+        /// <summary>
+        /// Compiles the expression unless it is already compiled, typing it against the given context.
+        /// </summary>
+        void Compile(const Scope& target);
+
     };
 
     void swap(ActionExpression& lhs, ActionExpression& rhs);
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "ActionList.h"
 #include <sstream>
+#include "ActionProfiler.h"
 
 using namespace std::literals::string_literals;
 
@@ -28,6 +29,7 @@ namespace FieaGameEngine::Actions {
             auto* action = static_cast<Action*>(&actions.GetTableElement(i));
 
             assert(action != nullptr);
+            ActionProfiler::Sample sample{*action};
             action->Update(gameTime);
         }
     }
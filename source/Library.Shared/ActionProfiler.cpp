@@ -0,0 +1,231 @@
+#include "pch.h"
+#include "ActionProfiler.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <vector>
+#include "Action.h"
+
+using namespace std::literals::string_literals;
+
+namespace FieaGameEngine {
+    namespace {
+#if defined(DEBUG) || defined(_DEBUG)
+        std::atomic<std::size_t> allocationCount{0};
+        _CRT_ALLOC_HOOK previousAllocHook = nullptr;
+        bool isAllocHookInstalled = false;
+
+        int CountAllocation(int allocType, void* data, std::size_t size, int blockType, long request, const unsigned char* file, int line) {
+            if ((allocType == _HOOK_ALLOC) || (allocType == _HOOK_REALLOC)) {
+                allocationCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            return (previousAllocHook != nullptr) ? previousAllocHook(allocType, data, size, blockType, request, file, line) : TRUE;
+        }
+#endif
+
+        double Microseconds(ActionProfiler::duration length) {
+            return std::chrono::duration<double, std::micro>(length).count();
+        }
+
+        /// <returns>The string as a JSON string literal.</returns>
+        std::string JsonString(const std::string& value) {
+            std::string quoted{"\""};
+
+            for (const char c : value) {
+                if ((c == '"') || (c == '\\')) {
+                    quoted += '\\';
+                    quoted += c;
+                } else if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[7];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                    quoted += escaped;
+                } else {
+                    quoted += c;
+                }
+            }
+
+            return quoted + "\""s;
+        }
+
+        /// <returns>The string as a CSV field, quoted and with its quotes doubled.</returns>
+        std::string CsvString(const std::string& value) {
+            std::string quoted{"\""};
+
+            for (const char c : value) {
+                quoted += c;
+
+                if (c == '"') {
+                    quoted += c;
+                }
+            }
+
+            return quoted + "\""s;
+        }
+    }
+
+    ActionProfiler::~ActionProfiler() {
+        Disable();
+    }
+
+    void ActionProfiler::Enable(bool isTracing) {
+        if ((_enabled != nullptr) && (_enabled != this)) {
+            _enabled->Disable();
+        }
+
+#if defined(DEBUG) || defined(_DEBUG)
+        // The debug heap takes a single hook, so whichever hook was already installed is still called.
+        if (!isAllocHookInstalled) {
+            previousAllocHook = _CrtSetAllocHook(CountAllocation);
+            isAllocHookInstalled = true;
+        }
+#endif
+
+        _enabled = this;
+        _isTracing = isTracing;
+    }
+
+    void ActionProfiler::Disable() {
+#if defined(DEBUG) || defined(_DEBUG)
+        if (IsEnabled() && isAllocHookInstalled) {
+            _CrtSetAllocHook(previousAllocHook);
+            previousAllocHook = nullptr;
+            isAllocHookInstalled = false;
+        }
+#endif
+
+        if (IsEnabled()) {
+            _enabled = nullptr;
+        }
+
+        for (Sample* sample = _innermost; sample != nullptr; sample = sample->_outer) {
+            sample->_profiler = nullptr;
+        }
+
+        _innermost = nullptr;
+
+        _isTracing = false;
+    }
+
+    void ActionProfiler::Clear() {
+        _records.Clear();
+        _events.Clear();
+        _events.ShrinkToFit();
+        _epoch = clock::now();
+    }
+
+    const typename ActionProfiler::Record* ActionProfiler::Find(const std::string& name) const {
+        const auto found = _records.CFind(name);
+        return (found == _records.cend()) ? nullptr : &(found->second);
+    }
+
+    Vector<const typename ActionProfiler::RecordPair*> ActionProfiler::Hottest(size_type count) const {
+        std::vector<const RecordPair*> sorted{};
+        sorted.reserve(_records.Size());
+
+        for (const auto& pair : _records) {
+            sorted.push_back(&pair);
+        }
+
+        count = std::min(count, sorted.size());
+        std::partial_sort(sorted.begin(), sorted.begin() + count, sorted.end(), [](const RecordPair* lhs, const RecordPair* rhs) {
+            return (lhs->second.total != rhs->second.total) ? (lhs->second.total > rhs->second.total) : (lhs->first < rhs->first);
+        });
+
+        Vector<const RecordPair*> hottest{};
+        hottest.Reserve(count);
+
+        for (size_type i = 0; i < count; ++i) {
+            hottest.PushBack(sorted[i]);
+        }
+
+        return hottest;
+    }
+
+    void ActionProfiler::WriteCsv(std::ostream& stream) const {
+        stream << "name,calls,total_us,max_us,allocations,compiles\n"s;
+
+        for (const RecordPair* pair : Hottest(_records.Size())) {
+            const Record& record = pair->second;
+            stream << CsvString(pair->first) << ',' << record.calls << ',' << Microseconds(record.total) << ',' << Microseconds(record.max)
+                << ',' << record.allocations << ',' << record.compiles << '\n';
+        }
+    }
+
+    void ActionProfiler::WriteJson(std::ostream& stream) const {
+        stream << '[';
+        bool isFirst = true;
+
+        for (const RecordPair* pair : Hottest(_records.Size())) {
+            const Record& record = pair->second;
+            stream << (isFirst ? "\n  "s : ",\n  "s) << "{ \"name\": "s << JsonString(pair->first) << ", \"calls\": "s << record.calls
+                << ", \"totalMicroseconds\": "s << Microseconds(record.total) << ", \"maxMicroseconds\": "s << Microseconds(record.max)
+                << ", \"allocations\": "s << record.allocations << ", \"compiles\": "s << record.compiles << " }"s;
+            isFirst = false;
+        }
+
+        stream << (isFirst ? "]\n"s : "\n]\n"s);
+    }
+
+    void ActionProfiler::WriteChromeTrace(std::ostream& stream) const {
+        stream << "{ \"displayTimeUnit\": \"ms\", \"traceEvents\": ["s;
+
+        for (auto i = Vector<TraceEvent>::size_type(0); i < _events.Size(); ++i) {
+            const TraceEvent& event = _events[i];
+            stream << ((i == 0) ? "\n  "s : ",\n  "s) << "{ \"name\": "s << JsonString(event.name) << ", \"cat\": \"action\", \"ph\": \"X\", \"ts\": "s
+                << Microseconds(std::chrono::duration_cast<duration>(event.start - _epoch)) << ", \"dur\": "s << Microseconds(event.length)
+                << ", \"pid\": 0, \"tid\": 0 }"s;
+        }
+
+        stream << (_events.IsEmpty() ? "] }\n"s : "\n] }\n"s);
+    }
+
+    typename ActionProfiler::size_type ActionProfiler::AllocationCount() {
+#if defined(DEBUG) || defined(_DEBUG)
+        return allocationCount.load(std::memory_order_relaxed);
+#else
+        return size_type(0);
+#endif
+    }
+
+    void ActionProfiler::Begin(Sample& sample, const Action& action) {
+        const size_type before = AllocationCount();
+        sample._name = NameOf(action);
+        sample._outer = _innermost;
+        _innermost = &sample;
+        _ownAllocations += AllocationCount() - before;
+
+        sample._allocations = AllocationCount() - _ownAllocations;
+        sample._start = clock::now();
+    }
+
+    void ActionProfiler::Finish(Sample& sample) {
+        const auto finish = clock::now();
+        const size_type before = AllocationCount();
+        const size_type allocations = (before - _ownAllocations) - sample._allocations;
+        const auto length = std::chrono::duration_cast<duration>(finish - sample._start);
+        _innermost = sample._outer;
+
+        Record& record = _records[sample._name];
+        ++record.calls;
+        record.total += length;
+        record.max = std::max(record.max, length);
+        record.allocations += allocations;
+
+        if (_isTracing) {
+            _events.PushBack(TraceEvent{std::move(sample._name), sample._start, length});
+        }
+
+        _ownAllocations += AllocationCount() - before;
+    }
+
+    void ActionProfiler::CountCompileOf(const Action& action) {
+        const size_type before = AllocationCount();
+        ++(_records[NameOf(action)].compiles);
+        _ownAllocations += AllocationCount() - before;
+    }
+
+    std::string ActionProfiler::NameOf(const Action& action) {
+        return action.GetName().empty() ? action.TypeNameInstance() : action.GetName();
+    }
+}
@@ -0,0 +1,160 @@
+#pragma once
+#include <chrono>
+#include <ostream>
+#include "HashMap.h"
+#include "Vector.h"
+
+namespace FieaGameEngine {
+    class Action;
+
+    /// <summary>
+    /// Records how often each action is updated, how long its updates take and how much they allocate, by action name.
+    /// Unnamed actions are recorded by type name. Only one profiler is enabled at a time, and samples are recorded by whichever is.
+    /// Switched off, which every profiler is by default, a sample costs a single branch, and nothing need exist to record it.
+    /// Times include any samples nested within, so an action list's time includes the actions it updates.
+    /// Allocations are only counted in debug builds, where they are hooked through the debug heap. Allocations the profiler makes itself are not counted.
+    /// </summary>
+    class ActionProfiler final {
+
+    public:
+        using size_type = std::size_t;
+        using clock = std::chrono::high_resolution_clock;
+        using duration = std::chrono::nanoseconds;
+
+        struct Record final {
+            size_type calls{0};
+            duration total{0};
+            duration max{0};
+            size_type allocations{0};
+
+            /// <summary>
+            /// Number of times an expression action compiled its expression.
+            /// </summary>
+            size_type compiles{0};
+        };
+
+        using RecordPair = std::pair<const std::string, Record>;
+
+        /// <summary>
+        /// Times one update of an action, from construction until destruction, if a profiler is enabled when it is constructed.
+        /// Samples still open when their profiler is disabled or destroyed are discarded, so a sample may outlive its profiler.
+        /// </summary>
+        class Sample final {
+
+        public:
+            explicit Sample(const Action& action);
+            Sample(const Sample&) = delete;
+            Sample(Sample&&) noexcept = delete;
+            Sample& operator=(const Sample&) = delete;
+            Sample& operator=(Sample&&) noexcept = delete;
+            ~Sample();
+
+        private:
+            friend class ActionProfiler;
+
+            /// <summary>
+            /// Profiler recording the sample, or nullptr if none was enabled or it has since been disabled.
+            /// </summary>
+            ActionProfiler* _profiler;
+
+            /// <summary>
+            /// Sample this one is nested within, if any.
+            /// </summary>
+            Sample* _outer{nullptr};
+
+            std::string _name{};
+            clock::time_point _start{};
+            size_type _allocations{0};
+
+        };
+
+        ActionProfiler() = default;
+        ActionProfiler(const ActionProfiler&) = delete;
+        ActionProfiler(ActionProfiler&&) noexcept = delete;
+        ActionProfiler& operator=(const ActionProfiler&) = delete;
+        ActionProfiler& operator=(ActionProfiler&&) noexcept = delete;
+        ~ActionProfiler();
+
+        [[nodiscard]] bool IsEnabled() const;
+        [[nodiscard]] bool IsTracing() const;
+
+        /// <summary>
+        /// Starts recording, disabling whichever other profiler was. If tracing, every sample is also kept as a trace event, so memory grows with the number of updates.
+        /// </summary>
+        void Enable(bool isTracing = false);
+        void Disable();
+
+        /// <summary>
+        /// Discards every record and trace event, releasing the trace, without switching the profiler on or off.
+        /// </summary>
+        void Clear();
+
+        /// <summary>
+        /// Counts a compile of the action's expression in the enabled profiler, if any is.
+        /// </summary>
+        static void CountCompile(const Action& action);
+
+        [[nodiscard]] const HashMap<std::string, Record>& Records() const;
+
+        /// <returns>Record of the action with the given name, or nullptr if it has not been recorded.</returns>
+        [[nodiscard]] const Record* Find(const std::string& name) const;
+
+        /// <returns>Up to the given number of records, in descending order of total time.</returns>
+        [[nodiscard]] Vector<const RecordPair*> Hottest(size_type count) const;
+
+        /// <summary>
+        /// Writes every record, in descending order of total time, with times in microseconds.
+        /// </summary>
+        void WriteCsv(std::ostream& stream) const;
+        void WriteJson(std::ostream& stream) const;
+
+        /// <summary>
+        /// Writes the trace events as complete events in the Chrome trace event format, which chrome://tracing and Perfetto load.
+        /// </summary>
+        void WriteChromeTrace(std::ostream& stream) const;
+
+        /// <returns>Number of allocations made since the profiler was first enabled. Always zero outside of debug builds.</returns>
+        [[nodiscard]] static size_type AllocationCount();
+
+        /// <returns>Profiler currently enabled, or nullptr if none is.</returns>
+        [[nodiscard]] static ActionProfiler* Enabled();
+
+    private:
+        struct TraceEvent final {
+            std::string name;
+            clock::time_point start;
+            duration length;
+        };
+
+        inline static ActionProfiler* _enabled{nullptr};
+
+        bool _isTracing{false};
+        HashMap<std::string, Record> _records{};
+        Vector<TraceEvent> _events{};
+
+        /// <summary>
+        /// Time trace events are measured from.
+        /// </summary>
+        clock::time_point _epoch{clock::now()};
+
+        /// <summary>
+        /// Innermost sample still open, through which every open sample is detached when the profiler is disabled.
+        /// </summary>
+        Sample* _innermost{nullptr};
+
+        /// <summary>
+        /// Number of allocations the profiler has made itself, which samples discount.
+        /// </summary>
+        size_type _ownAllocations{0};
+
+        void Begin(Sample& sample, const Action& action);
+        void Finish(Sample& sample);
+        void CountCompileOf(const Action& action);
+
+        /// <returns>Name the action is recorded by.</returns>
+        static std::string NameOf(const Action& action);
+
+    };
+}
+
+#include "ActionProfiler.inl"
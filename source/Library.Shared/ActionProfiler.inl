@@ -0,0 +1,29 @@
+#pragma once
+#include "ActionProfiler.h"
+
+namespace FieaGameEngine {
+    inline ActionProfiler::Sample::Sample(const Action& action) : _profiler{_enabled} {
+        if (_profiler != nullptr) {
+            _profiler->Begin(*this, action);
+        }
+    }
+
+    inline ActionProfiler::Sample::~Sample() {
+        if (_profiler != nullptr) {
+            _profiler->Finish(*this);
+        }
+    }
+
+    inline bool ActionProfiler::IsEnabled() const { return _enabled == this; }
+    inline bool ActionProfiler::IsTracing() const { return _isTracing; }
+
+    inline void ActionProfiler::CountCompile(const Action& action) {
+        if (_enabled != nullptr) {
+            _enabled->CountCompileOf(action);
+        }
+    }
+
+    inline ActionProfiler* ActionProfiler::Enabled() { return _enabled; }
+
+    inline const HashMap<std::string, ActionProfiler::Record>& ActionProfiler::Records() const { return _records; }
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "Attributed.h"
+#include "AttributedSignatureRegistry.h"
+
+namespace FieaGameEngine {
+    /// <summary>
+    /// Slot index of a prescribed attribute of TAttributed. The registry appends prescribed attributes in signature order
+    /// (parents first) right after "this", so each one lives at a fixed index of the scope's ordered array. The index is
+    /// resolved from the registry once, on first use, after which access is a direct index with no hashing or string construction.
+    /// Because parent signatures come first, a handle for a base type also works on instances of derived types.
+    /// </summary>
+    template <typename TAttributed>
+    class AttributeHandle final {
+
+    public:
+        using key_type = Attributed::key_type;
+        using size_type = Attributed::size_type;
+
+    private:
+        inline static constexpr size_type UNRESOLVED = std::numeric_limits<size_type>::max();
+
+        key_type _key;
+        mutable size_type _index{UNRESOLVED};
+
+        /// <summary>
+        /// Looks up the key among the registered signatures of TAttributed. Throws an exception if it is not prescribed.
+        /// </summary>
+        void Resolve() const;
+
+    public:
+        /// <summary>
+        /// Constructor. Does not touch the registry, so handles may be declared as statics before signatures are registered.
+        /// </summary>
+        explicit AttributeHandle(const key_type& key);
+
+        /// <returns>Key of the attribute.</returns>
+        [[nodiscard]] const key_type& Key() const;
+
+        /// <returns>Index of the attribute within the scope, resolving it if needed.</returns>
+        [[nodiscard]] size_type Index() const;
+
+        /// <returns>Reference to the attribute's datum within the given instance.</returns>
+        [[nodiscard]] Datum& operator()(TAttributed& instance) const;
+
+        /// <returns>Reference to the attribute's datum within the given instance.</returns>
+        [[nodiscard]] const Datum& operator()(const TAttributed& instance) const;
+
+    };
+}
+
+#include "AttributeHandle.inl"
@@ -0,0 +1,47 @@
+#pragma once
+#include "AttributeHandle.h"
+
+namespace FieaGameEngine {
+    template <typename TAttributed> inline AttributeHandle<TAttributed>::AttributeHandle(const key_type& key) : _key{key} {}
+
+    template <typename TAttributed> inline void AttributeHandle<TAttributed>::Resolve() const {
+        using namespace std::literals::string_literals;
+
+        auto signatures = AttributedSignatureRegistry::FindSignatures(TAttributed::TypeIdClass());
+
+        if (!AttributedSignatureRegistry::IsFound(signatures)) {
+            throw std::logic_error("No signatures found for "s + TAttributed::TypeNameClass() + "!"s);
+        }
+
+        for (auto i = size_type(0); i < signatures->second.Size(); ++i) {
+            if (signatures->second[i].Key() == _key) {
+                _index = i + size_type(1);
+                return;
+            }
+        }
+
+        throw std::invalid_argument(_key + " is not a prescribed attribute of "s + TAttributed::TypeNameClass() + "."s);
+    }
+
+    template <typename TAttributed> inline const typename AttributeHandle<TAttributed>::key_type& AttributeHandle<TAttributed>::Key() const { return _key; }
+
+    template <typename TAttributed> inline typename AttributeHandle<TAttributed>::size_type AttributeHandle<TAttributed>::Index() const {
+        if (_index == UNRESOLVED) {
+            Resolve();
+        }
+
+        return _index;
+    }
+
+    template <typename TAttributed> inline Datum& AttributeHandle<TAttributed>::operator()(TAttributed& instance) const {
+        auto index = Index();
+        assert(&instance[index] == &instance.At(_key));
+        return instance[index];
+    }
+
+    template <typename TAttributed> inline const Datum& AttributeHandle<TAttributed>::operator()(const TAttributed& instance) const {
+        auto index = Index();
+        assert(&instance[index] == &instance.CAt(_key));
+        return instance[index];
+    }
+}
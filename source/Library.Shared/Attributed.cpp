@@ -26,25 +26,30 @@ namespace FieaGameEngine {
     void Attributed::Populate(IdType idOfSignaturesToAppend) {
         using namespace std::literals::string_literals;
 
-        Append(THIS_KEY) = this;
+        const SignatureLayout* layout = AttributedSignatureRegistry::FindLayout(idOfSignaturesToAppend);
 
-        auto signatures = AttributedSignatureRegistry::FindSignatures(idOfSignaturesToAppend);
-
-        if (!AttributedSignatureRegistry::IsFound(signatures)) {
+        if (layout == nullptr) {
             throw std::logic_error("No signatures found for Attributed ID "s + std::to_string(idOfSignaturesToAppend) + "!"s);
         }
 
-        _prescribedAttributeCount = size_type(1) + signatures->second.Size();
-        for (const auto& signature : signatures->second) {
+        _prescribedAttributeCount = size_type(1) + layout->Size();
+        _array.Reserve(_prescribedAttributeCount);
+
+        AppendWithHashCode(THIS_KEY, THIS_KEY_HASH_CODE) = this;
+
+        for (const auto& precompiled : *layout) {
+            const auto& signature = precompiled.signature;
+            Datum& appended = AppendWithHashCode(signature.Key(), precompiled.keyHashCode);
+
             if (signature.IsStorageExternal()) {
-                Append(signature.Key()).SetStorage(
+                appended.SetStorage(
                     signature.Type(),
                     reinterpret_cast<std::byte*>(this) + signature.MemoryOffset(),
                     signature.Count(),
                     signature.IsStorageConst()
                 );
             } else {
-                Append(signature.Key()).SetType((signature.Type() == DatumType::Table) ? DatumType::InternalTable : signature.Type());
+                appended.SetType(precompiled.internalType);
             }
         }
     }
@@ -69,7 +74,8 @@ namespace FieaGameEngine {
             assert(IsContainingKey(signature.Key()));
             assert(&(operator[](signature.Key())) == &(operator[](i)));
             assert((signature.Type() != DatumType::InternalTable) || (operator[](i).ActualType() == DatumType::InternalTable));
-            if (signature.Type() != DatumType::InternalTable) {
+            // Internally stored attributes were copied with the scope, so only external storage is pointed at this instance.
+            if ((signature.Type() != DatumType::InternalTable) && signature.IsStorageExternal()) {
                 operator[](i).SetStorage(
                     signature.Type(),
                     reinterpret_cast<std::byte*>(this) + signature.MemoryOffset(),
@@ -186,6 +192,8 @@ namespace FieaGameEngine {
         }
 
         _array.Remove(start, finish);
+        InvalidateSearches();
+        MarkContentChanged();
     }
 
     void Attributed::swap(Attributed& other) {
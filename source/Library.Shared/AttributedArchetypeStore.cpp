@@ -0,0 +1,312 @@
+#include "pch.h"
+#include "AttributedArchetypeStore.h"
+
+using namespace std::literals::string_literals;
+
+namespace FieaGameEngine {
+    AttributedArchetypeStore::AttributedArchetypeStore(IdType archetype, size_type capacity) : _archetype{archetype} {
+        auto signatures = AttributedSignatureRegistry::FindSignatures(archetype);
+
+        if (!AttributedSignatureRegistry::IsFound(signatures)) {
+            throw std::logic_error("No signatures found for Attributed ID "s + std::to_string(archetype) + "!"s);
+        }
+
+        _columns.Reserve(signatures->second.Size());
+
+        for (const auto& signature : signatures->second) {
+            if (IsColumnSignature(signature) && !_columnIndices.IsContainingKey(signature.MemoryOffset())) {
+                _columnIndices.Insert(std::make_pair(signature.MemoryOffset(), _columns.Size()));
+                _columns.EmplaceBack(Column{signature, Datum{signature.Type()}});
+            }
+        }
+
+        Reserve(capacity);
+    }
+
+    bool AttributedArchetypeStore::IsColumnSignature(const Signature& signature) {
+        switch (signature.Type()) {
+
+        case DatumType::Integer:
+        case DatumType::Float:
+        case DatumType::String:
+        case DatumType::Vector:
+        case DatumType::Matrix:
+        case DatumType::Pointer:
+            return signature.IsStorageExternal() && (signature.Count() > size_type(0));
+
+        default:
+            return false;
+
+        }
+    }
+
+    void AttributedArchetypeStore::PushBackElements(Datum& column, const std::byte* source, size_type count) {
+        for (auto i = size_type(0); i < count; ++i) {
+            switch (column.ActualType()) {
+
+            case DatumType::Integer:
+                column.PushBack(reinterpret_cast<const Datum::Integer*>(source)[i]);
+                break;
+
+            case DatumType::Float:
+                column.PushBack(reinterpret_cast<const Datum::Float*>(source)[i]);
+                break;
+
+            case DatumType::String:
+                column.PushBack(reinterpret_cast<const Datum::String*>(source)[i]);
+                break;
+
+            case DatumType::Vector:
+                column.PushBack(reinterpret_cast<const Datum::Vector*>(source)[i]);
+                break;
+
+            case DatumType::Matrix:
+                column.PushBack(reinterpret_cast<const Datum::Matrix*>(source)[i]);
+                break;
+
+            case DatumType::Pointer:
+                column.PushBack(reinterpret_cast<const Datum::Pointer*>(source)[i]);
+                break;
+
+            default:
+                assert(false);
+
+            }
+        }
+    }
+
+    void AttributedArchetypeStore::PushBackDefaults(Datum& column, size_type count) {
+        for (auto i = size_type(0); i < count; ++i) {
+            switch (column.ActualType()) {
+
+            case DatumType::Integer:
+                column.PushBack(Datum::Integer{});
+                break;
+
+            case DatumType::Float:
+                column.PushBack(Datum::Float{});
+                break;
+
+            case DatumType::String:
+                column.PushBack(Datum::String{});
+                break;
+
+            case DatumType::Vector:
+                column.PushBack(Datum::Vector{});
+                break;
+
+            case DatumType::Matrix:
+                column.PushBack(Datum::Matrix{});
+                break;
+
+            case DatumType::Pointer:
+                column.PushBack(Datum::Pointer{nullptr});
+                break;
+
+            default:
+                assert(false);
+
+            }
+        }
+    }
+
+    void AttributedArchetypeStore::CopyElements(const Datum& column, size_type first, std::byte* destination, size_type count) {
+        for (auto i = size_type(0); i < count; ++i) {
+            switch (column.ActualType()) {
+
+            case DatumType::Integer:
+                reinterpret_cast<Datum::Integer*>(destination)[i] = column.CGetIntegerElement(first + i);
+                break;
+
+            case DatumType::Float:
+                reinterpret_cast<Datum::Float*>(destination)[i] = column.CGetFloatElement(first + i);
+                break;
+
+            case DatumType::String:
+                reinterpret_cast<Datum::String*>(destination)[i] = column.CGetStringElement(first + i);
+                break;
+
+            case DatumType::Vector:
+                reinterpret_cast<Datum::Vector*>(destination)[i] = column.CGetVectorElement(first + i);
+                break;
+
+            case DatumType::Matrix:
+                reinterpret_cast<Datum::Matrix*>(destination)[i] = column.CGetMatrixElement(first + i);
+                break;
+
+            case DatumType::Pointer:
+                reinterpret_cast<Datum::Pointer*>(destination)[i] = column.CGetPointerElement(first + i);
+                break;
+
+            default:
+                assert(false);
+
+            }
+        }
+    }
+
+    void AttributedArchetypeStore::CopyElement(Datum& column, size_type to, size_type from) {
+        switch (column.ActualType()) {
+
+        case DatumType::Integer:
+            column.SetElement(column.CGetIntegerElement(from), to);
+            break;
+
+        case DatumType::Float:
+            column.SetElement(column.CGetFloatElement(from), to);
+            break;
+
+        case DatumType::String:
+            column.GetStringElement(to) = column.CGetStringElement(from);
+            break;
+
+        case DatumType::Vector:
+            column.GetVectorElement(to) = column.CGetVectorElement(from);
+            break;
+
+        case DatumType::Matrix:
+            column.GetMatrixElement(to) = column.CGetMatrixElement(from);
+            break;
+
+        case DatumType::Pointer:
+            column.SetElement(column.CGetPointerElement(from), to);
+            break;
+
+        default:
+            assert(false);
+
+        }
+    }
+
+    typename AttributedArchetypeStore::Column& AttributedArchetypeStore::FindColumn(std::size_t memoffset) {
+        auto found = _columnIndices.Find(memoffset);
+
+        if (found == _columnIndices.end()) {
+            throw std::out_of_range("No column at memory offset "s + std::to_string(memoffset) + "!"s);
+        }
+
+        return _columns[found->second];
+    }
+
+    const typename AttributedArchetypeStore::Column& AttributedArchetypeStore::CFindColumn(std::size_t memoffset) const {
+        return const_cast<AttributedArchetypeStore*>(this)->FindColumn(memoffset);
+    }
+
+    typename AttributedArchetypeStore::size_type AttributedArchetypeStore::MemoryFootprint() const {
+        size_type bytes = size_type(0);
+
+        for (const auto& column : _columns) {
+            bytes += column.data.Capacity() * column.data.TypeSize();
+        }
+
+        return bytes;
+    }
+
+    void AttributedArchetypeStore::Reserve(size_type capacity) {
+        for (auto& column : _columns) {
+            column.data.Reserve(capacity * column.signature.Count());
+        }
+    }
+
+    typename AttributedArchetypeStore::size_type AttributedArchetypeStore::PushBack(const Attributed& instance) {
+        if (instance.TypeIdInstance() != _archetype) {
+            throw std::invalid_argument("Cannot store "s + instance.TypeNameInstance() + " in an archetype store of a different type!"s);
+        }
+
+        const auto* base = reinterpret_cast<const std::byte*>(&instance);
+
+        for (auto& column : _columns) {
+            PushBackElements(column.data, base + column.signature.MemoryOffset(), column.signature.Count());
+        }
+
+        return _size++;
+    }
+
+    typename AttributedArchetypeStore::size_type AttributedArchetypeStore::EmplaceBack() {
+        for (auto& column : _columns) {
+            PushBackDefaults(column.data, column.signature.Count());
+        }
+
+        return _size++;
+    }
+
+    void AttributedArchetypeStore::RemoveAt(size_type row) {
+        if (row >= _size) {
+            throw std::out_of_range("Row "s + std::to_string(row) + " is out of range!"s);
+        }
+
+        auto last = _size - size_type(1);
+
+        if (row != last) {
+            for (auto& column : _columns) {
+                auto count = column.signature.Count();
+
+                for (auto i = size_type(0); i < count; ++i) {
+                    CopyElement(column.data, (row * count) + i, (last * count) + i);
+                }
+            }
+        }
+
+        PopBack();
+    }
+
+    void AttributedArchetypeStore::PopBack() {
+        if (_size == size_type(0)) {
+            return;
+        }
+
+        for (auto& column : _columns) {
+            for (auto i = size_type(0); i < column.signature.Count(); ++i) {
+                column.data.PopBack();
+            }
+        }
+
+        --_size;
+    }
+
+    void AttributedArchetypeStore::Clear() {
+        for (auto& column : _columns) {
+            column.data.Clear();
+        }
+
+        _size = size_type(0);
+    }
+
+    void AttributedArchetypeStore::CopyTo(size_type row, Attributed& instance) const {
+        if (row >= _size) {
+            throw std::out_of_range("Row "s + std::to_string(row) + " is out of range!"s);
+        }
+
+        if (instance.TypeIdInstance() != _archetype) {
+            throw std::invalid_argument("Cannot copy row into "s + instance.TypeNameInstance() + ", which is not the archetype's type!"s);
+        }
+
+        auto* base = reinterpret_cast<std::byte*>(&instance);
+
+        for (const auto& column : _columns) {
+            auto count = column.signature.Count();
+            CopyElements(column.data, row * count, base + column.signature.MemoryOffset(), count);
+        }
+    }
+
+    Scope AttributedArchetypeStore::View(size_type row) {
+        Scope view{_columns.Size()};
+        BindView(view, row);
+        return view;
+    }
+
+    void AttributedArchetypeStore::BindView(Scope& view, size_type row) {
+        if (row >= _size) {
+            throw std::out_of_range("Row "s + std::to_string(row) + " is out of range!"s);
+        }
+
+        for (auto& column : _columns) {
+            view.Append(column.signature.Key()).SetStorage(
+                column.signature.Type(),
+                RowData(column, row),
+                column.signature.Count(),
+                column.signature.IsStorageConst()
+            );
+        }
+    }
+}
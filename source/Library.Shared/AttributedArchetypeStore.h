@@ -0,0 +1,190 @@
+#pragma once
+#include "Attributed.h"
+#include "AttributedSignatureRegistry.h"
+
+namespace FieaGameEngine {
+    /// <summary>
+    /// Opt-in struct-of-arrays storage for many instances of the same Attributed type. Each external, non-table
+    /// prescribed attribute is packed into its own contiguous column, keyed by the signature's memory offset,
+    /// so that a system touching one attribute across every instance walks a single array.
+    /// Rows can still be accessed by name through a view scope whose datums use external storage into the columns.
+    /// </summary>
+    class AttributedArchetypeStore final {
+
+    public:
+        using size_type = Datum::size_type;
+        using key_type = Attributed::key_type;
+        using DatumType = Datum::DatumType;
+        using IdType = RTTI::IdType;
+        using Signature = Attributed::Signature;
+
+    private:
+        /// <summary>
+        /// A single packed attribute. The data datum is internal and holds `Count() * Size()` elements.
+        /// </summary>
+        struct Column final {
+            Signature signature;
+            Datum data;
+        };
+
+        /// <summary>
+        /// Type of the archetype whose signatures describe the columns.
+        /// </summary>
+        IdType _archetype;
+
+        /// <summary>
+        /// Columns in signature order.
+        /// </summary>
+        Vector<Column> _columns{};
+
+        /// <summary>
+        /// Maps a signature's memory offset to its column index.
+        /// </summary>
+        HashMap<std::size_t, size_type> _columnIndices{};
+
+        /// <summary>
+        /// Number of rows currently stored.
+        /// </summary>
+        size_type _size{size_type(0)};
+
+        /// <returns>Is the given signature eligible to be packed into a column?</returns>
+        [[nodiscard]] static bool IsColumnSignature(const Signature& signature);
+
+        /// <summary>
+        /// Helper function which pushes back `count` elements read from raw instance memory onto the column.
+        /// </summary>
+        static void PushBackElements(Datum& column, const std::byte* source, size_type count);
+
+        /// <summary>
+        /// Helper function which pushes back `count` default constructed elements onto the column.
+        /// </summary>
+        static void PushBackDefaults(Datum& column, size_type count);
+
+        /// <summary>
+        /// Helper function which copies `count` elements of the column, starting at the given index, into raw instance memory.
+        /// </summary>
+        static void CopyElements(const Datum& column, size_type first, std::byte* destination, size_type count);
+
+        /// <summary>
+        /// Helper function which copies an element of the column onto another element of the same column.
+        /// </summary>
+        static void CopyElement(Datum& column, size_type to, size_type from);
+
+        /// <returns>Pointer to the first element of the given row within the given column.</returns>
+        [[nodiscard]] static void* RowData(Column& column, size_type row);
+
+        /// <returns>Reference to the column at the given memory offset. Throws an exception if no such column exists.</returns>
+        [[nodiscard]] Column& FindColumn(std::size_t memoffset);
+
+        /// <returns>Reference to the column at the given memory offset. Throws an exception if no such column exists.</returns>
+        [[nodiscard]] const Column& CFindColumn(std::size_t memoffset) const;
+
+        /// <summary>
+        /// Throws an exception if the given column is not of the given storage type.
+        /// </summary>
+        template <typename T> static void ValidateColumnType(const Column& column);
+
+        /// <summary>
+        /// Helper function which maps a storage type to its datum type at compile time.
+        /// </summary>
+        template <typename T> [[nodiscard]] static constexpr DatumType TypeOf();
+
+    public:
+        /// <summary>
+        /// Constructor. Builds one column per external, non-table signature registered for the given archetype.
+        /// </summary>
+        /// <param name="archetype"> - Type ID whose signatures were registered with the AttributedSignatureRegistry.</param>
+        /// <param name="capacity"> - Number of rows to reserve up front.</param>
+        explicit AttributedArchetypeStore(IdType archetype, size_type capacity = size_type(0));
+
+        AttributedArchetypeStore(const AttributedArchetypeStore&) = delete;
+        AttributedArchetypeStore(AttributedArchetypeStore&&) noexcept = default;
+        AttributedArchetypeStore& operator=(const AttributedArchetypeStore&) = delete;
+        AttributedArchetypeStore& operator=(AttributedArchetypeStore&&) noexcept = default;
+        ~AttributedArchetypeStore() = default;
+
+        /// <returns>Type ID of the archetype stored.</returns>
+        [[nodiscard]] IdType Archetype() const;
+
+        /// <returns>Number of rows stored.</returns>
+        [[nodiscard]] size_type Size() const;
+
+        /// <returns>Is the store empty?</returns>
+        [[nodiscard]] bool IsEmpty() const;
+
+        /// <returns>Number of packed columns.</returns>
+        [[nodiscard]] size_type ColumnCount() const;
+
+        /// <returns>Number of bytes reserved by the columns.</returns>
+        [[nodiscard]] size_type MemoryFootprint() const;
+
+        /// <summary>
+        /// Reserves space for the given number of rows. Invalidates existing views if the columns are reallocated.
+        /// </summary>
+        void Reserve(size_type capacity);
+
+        /// <summary>
+        /// Appends a row copied from the prescribed attributes of the given instance, which must be of the archetype's type.
+        /// </summary>
+        /// <returns>Index of the new row.</returns>
+        size_type PushBack(const Attributed& instance);
+
+        /// <summary>
+        /// Appends a row of default constructed values.
+        /// </summary>
+        /// <returns>Index of the new row.</returns>
+        size_type EmplaceBack();
+
+        /// <summary>
+        /// Removes the given row by moving the last row into its place. Views of the last row are invalidated.
+        /// </summary>
+        void RemoveAt(size_type row);
+
+        /// <summary>
+        /// Removes the last row, or does nothing if the store is empty.
+        /// </summary>
+        void PopBack();
+
+        /// <summary>
+        /// Removes all rows. Columns are kept.
+        /// </summary>
+        void Clear();
+
+        /// <summary>
+        /// Copies the given row back into the prescribed attributes of the given instance.
+        /// </summary>
+        void CopyTo(size_type row, Attributed& instance) const;
+
+        /// <returns>Does the store have a column for the signature at the given memory offset?</returns>
+        [[nodiscard]] bool IsColumn(std::size_t memoffset) const;
+
+        /// <returns>The internal datum packing every row of the signature at the given memory offset.</returns>
+        [[nodiscard]] const Datum& CColumn(std::size_t memoffset) const;
+
+        /// <summary>
+        /// Returns the contiguous array backing the column at the given memory offset, for tight iteration over all rows.
+        /// The type must match the column's type. Elements of row `r` start at index `r * count`.
+        /// </summary>
+        template <typename T> [[nodiscard]] T* ColumnData(std::size_t memoffset);
+
+        /// <summary>
+        /// Returns the contiguous array backing the column at the given memory offset, for tight iteration over all rows.
+        /// The type must match the column's type. Elements of row `r` start at index `r * count`.
+        /// </summary>
+        template <typename T> [[nodiscard]] const T* CColumnData(std::size_t memoffset) const;
+
+        /// <summary>
+        /// Creates a scope whose datums refer to the given row by attribute name, using external storage.
+        /// </summary>
+        [[nodiscard]] Scope View(size_type row);
+
+        /// <summary>
+        /// Points the datums of the given view at the given row, appending any that are missing.
+        /// Cheaper than creating a new view for every row.
+        /// </summary>
+        void BindView(Scope& view, size_type row);
+
+    };
+}
+
+#include "AttributedArchetypeStore.inl"
@@ -0,0 +1,63 @@
+#pragma once
+#include "AttributedArchetypeStore.h"
+
+namespace FieaGameEngine {
+    inline typename AttributedArchetypeStore::IdType AttributedArchetypeStore::Archetype() const { return _archetype; }
+    inline typename AttributedArchetypeStore::size_type AttributedArchetypeStore::Size() const { return _size; }
+    inline bool AttributedArchetypeStore::IsEmpty() const { return _size == size_type(0); }
+    inline typename AttributedArchetypeStore::size_type AttributedArchetypeStore::ColumnCount() const { return _columns.Size(); }
+
+    inline bool AttributedArchetypeStore::IsColumn(std::size_t memoffset) const { return _columnIndices.IsContainingKey(memoffset); }
+    inline const Datum& AttributedArchetypeStore::CColumn(std::size_t memoffset) const { return CFindColumn(memoffset).data; }
+
+    inline void* AttributedArchetypeStore::RowData(Column& column, size_type row) {
+        // Rows are written through the returned pointer, as with ColumnData.
+        column.data.Unshare();
+        column.data.MarkContentChanged();
+        return column.data.GetElementPointerNoCheck<std::byte>(row * column.signature.Count());
+    }
+
+    template <typename T> inline constexpr typename AttributedArchetypeStore::DatumType AttributedArchetypeStore::TypeOf() {
+        if constexpr (std::is_same_v<T, Datum::Integer>) {
+            return DatumType::Integer;
+        } else if constexpr (std::is_same_v<T, Datum::Float>) {
+            return DatumType::Float;
+        } else if constexpr (std::is_same_v<T, Datum::String>) {
+            return DatumType::String;
+        } else if constexpr (std::is_same_v<T, Datum::Vector>) {
+            return DatumType::Vector;
+        } else if constexpr (std::is_same_v<T, Datum::Matrix>) {
+            return DatumType::Matrix;
+        } else if constexpr (std::is_same_v<T, Datum::Pointer>) {
+            return DatumType::Pointer;
+        } else {
+            return DatumType::Unknown;
+        }
+    }
+
+    template <typename T> inline void AttributedArchetypeStore::ValidateColumnType(const Column& column) {
+        static_assert(TypeOf<T>() != DatumType::Unknown, "Type cannot be stored in an archetype column.");
+
+        if (column.signature.Type() != TypeOf<T>()) {
+            using namespace std::literals::string_literals;
+
+            throw std::invalid_argument("Column "s + column.signature.Key() + " is not of type "s + ToStringDatumType(TypeOf<T>()) + "."s);
+        }
+    }
+
+    template <typename T> inline T* AttributedArchetypeStore::ColumnData(std::size_t memoffset) {
+        Column& column = FindColumn(memoffset);
+        ValidateColumnType<T>(column);
+
+        // Elements are written through the returned array, so the column must not share it with copies.
+        column.data.Unshare();
+        column.data.MarkContentChanged();
+        return column.data.GetElementPointerNoCheck<T>(size_type(0));
+    }
+
+    template <typename T> inline const T* AttributedArchetypeStore::CColumnData(std::size_t memoffset) const {
+        const Column& column = CFindColumn(memoffset);
+        ValidateColumnType<T>(column);
+        return column.data.CGetElementPointerNoCheck<T>(size_type(0));
+    }
+}
@@ -25,9 +25,15 @@ namespace FieaGameEngine {
     public:
         inline static IdType TypeIdClass() { return _typeId; }
         inline static std::string TypeNameClass() { using namespace std::literals::string_literals; return "AttributedEventArgs"s; }
+        inline static constexpr std::size_t TypeDepthClass() { return Attributed::TypeDepthClass() + 1; }
+        inline static const TypeDisplay& TypeDisplayClass() { static const TypeDisplay display{Attributed::TypeDisplayClass(), reinterpret_cast<IdType>(&_typeId)}; return display; }
         inline IdType TypeIdInstance() const override { return TypeIdClass(); }
         inline std::string TypeNameInstance() const override { return TypeNameClass(); }
-        inline bool Is(IdType id) const override { return (id == _typeId) ? true : (Attributed::Is(id) || IEventArgs::Is(id)); }
+        inline const TypeDisplay& TypeDisplayInstance() const override { return TypeDisplayClass(); }
+        using Attributed::Is;
+        // The display only follows the Attributed chain, so the IEventArgs chain is checked separately.
+        inline bool Is(IdType id) const override { return TypeDisplayInstance().Contains(id) || IEventArgs::TypeDisplayClass().Contains(id); }
+        inline bool Is(const TypeDisplay& type) const override { return TypeDisplayInstance().Contains(type) || IEventArgs::TypeDisplayClass().Contains(type); }
     private:
         static const IdType _typeId;
 #pragma endregion RTTI_DECLARATIONS
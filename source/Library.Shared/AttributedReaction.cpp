@@ -1,30 +1,84 @@
 #include "pch.h"
 #include "AttributedReaction.h"
 #include "AttributedEventArgs.h"
-#include <regex>
+#include <cctype>
+#include <string_view>
 
 using namespace std::literals::string_literals;
 
 namespace FieaGameEngine {
+    namespace {
+        /// <summary>
+        /// Characters with a meaning of their own in ECMAScript regexes, which is the grammar subtype regexes are compiled with.
+        /// </summary>
+        const std::string SPECIAL_CHARACTERS = "^$\\.*+?()[]{}|"s;
+
+        /// <summary>
+        /// Characters the `.` of a regex does not match.
+        /// </summary>
+        const std::string LINE_TERMINATORS = "\n\r"s;
+
+        /// <summary>
+        /// Unescapes a regex which only matches one string, such as `Player\.Died`, into that string.
+        /// </summary>
+        /// <returns>Does the regex only match the literal it was unescaped into?</returns>
+        bool TryUnescapeLiteral(std::string_view regex, std::string& literal) {
+            literal.clear();
+
+            for (auto i = std::size_t(0); i < regex.size(); ++i) {
+                char c = regex[i];
+
+                if (c == '\\') {
+                    // Escaped letters, digits and underscores are classes, anchors or backreferences rather than characters.
+                    if ((++i == regex.size()) || std::isalnum(static_cast<unsigned char>(regex[i])) || (regex[i] == '_')) {
+                        return false;
+                    }
+
+                    c = regex[i];
+                } else if (SPECIAL_CHARACTERS.find(c) != std::string::npos) {
+                    return false;
+                }
+
+                literal += c;
+            }
+
+            return true;
+        }
+    }
+
     RTTI_DEFINITIONS(AttributedReaction);
 
     const typename AttributedReaction::String AttributedReaction::REACTS_TO_SUBTYPE_REGEX_KEY = "ReactsToSubtypeRegex"s;
 
     AttributedReaction::AttributedReaction(const String& name)
-        : Reaction{AttributedReaction::TypeIdClass(), name, { AttributedEventArgs::TypeIdClass() }}
+        : Reaction{AttributedReaction::TypeIdClass(), name, {}}
     {
         _reactsToSubtypeRegexes = &(At(REACTS_TO_SUBTYPE_REGEX_KEY));
+        ObserveContent();
+
+        if (GameplayState::HasSingleton()) {
+            GameplayState::Singleton().ReactionIndex().Register(*this);
+        }
     }
     AttributedReaction::AttributedReaction(IdType idOfSignaturesToAppend, const String& name)
-        : Reaction{idOfSignaturesToAppend, name, { AttributedEventArgs::TypeIdClass() }}
+        : Reaction{idOfSignaturesToAppend, name, {}}
     {
         _reactsToSubtypeRegexes = &(At(REACTS_TO_SUBTYPE_REGEX_KEY));
+        ObserveContent();
+
+        if (GameplayState::HasSingleton()) {
+            GameplayState::Singleton().ReactionIndex().Register(*this);
+        }
     }
 
     AttributedReaction& AttributedReaction::operator=(const AttributedReaction& other) {
         if (this != &other) {
             Reaction::operator=(other);
             _reactsToSubtypeRegexes = &(At(REACTS_TO_SUBTYPE_REGEX_KEY));
+
+            if (GameplayState::HasSingleton()) {
+                GameplayState::Singleton().ReactionIndex().Register(*this);
+            }
         }
         return *this;
     }
@@ -34,20 +88,82 @@ namespace FieaGameEngine {
             Reaction::operator=(std::move(other));
             _reactsToSubtypeRegexes = &(At(REACTS_TO_SUBTYPE_REGEX_KEY));
             other._reactsToSubtypeRegexes = nullptr;
+
+            if (GameplayState::HasSingleton()) {
+                auto& index = GameplayState::Singleton().ReactionIndex();
+                index.Unregister(other);
+                index.Register(*this);
+            }
         }
         return *this;
     }
 
     bool AttributedReaction::IsReactingTo(const IEventArgs& args) const {
-        assert(_reactsToSubtypeRegexes != nullptr);
         assert(args.Is(AttributedEventArgs::TypeIdClass()));
         const auto& attrargs = static_cast<const AttributedEventArgs&>(args);
 
-        auto size = _reactsToSubtypeRegexes->Size();
-        for (auto i = decltype(size)(0); i < size; ++i) {
-            auto regex = std::regex{GetReactsToSubtypeRegex(i)};
-            if (std::regex_match(attrargs.GetSubtype(), regex)) {
-                return Reaction::IsReactingTo(args);
+        return IsMatchingSubtype(attrargs.GetSubtype()) && Reaction::IsReactingTo(args);
+    }
+
+    bool AttributedReaction::IsMatchingSubtype(const String& subtype) const {
+        CompileMatcher();
+        return MatchSubtype(subtype);
+    }
+
+    void AttributedReaction::ContentChanged() {
+        Reaction::ContentChanged();
+
+        // Any change may be to the subtype regexes, which the index compares against those the matcher was compiled from once it refreshes.
+        if ((_registration != std::size_t(0)) && !_isMatcherStale && GameplayState::HasSingleton()) {
+            _isMatcherStale = true;
+            GameplayState::Singleton().ReactionIndex().MarkStale(*this);
+        }
+    }
+
+    bool AttributedReaction::CompileMatcher() const {
+        assert(_reactsToSubtypeRegexes != nullptr);
+        const Datum& regexes = *_reactsToSubtypeRegexes;
+
+        if (regexes == _matcherCompiledFrom) {
+            return false;
+        }
+
+        SubtypeMatcher matcher{};
+        String literal{};
+
+        for (auto i = size_type(0); i < regexes.Size(); ++i) {
+            const std::string_view regex = regexes.CGetStringElement(i);
+
+            if (TryUnescapeLiteral(regex, literal)) {
+                matcher.literals.PushBack(literal);
+            } else if ((regex.size() >= 2) && (regex.substr(regex.size() - 2) == ".*") && TryUnescapeLiteral(regex.substr(0, regex.size() - 2), literal)) {
+                matcher.prefixes.PushBack(literal);
+            } else {
+                matcher.regexes.emplace_back(regex.data(), regex.size());
+            }
+        }
+
+        _matcher = std::move(matcher);
+        _matcherCompiledFrom = regexes;
+        return true;
+    }
+
+    bool AttributedReaction::MatchSubtype(const String& subtype) const {
+        for (const auto& literal : _matcher.literals) {
+            if (subtype == literal) {
+                return true;
+            }
+        }
+
+        for (const auto& prefix : _matcher.prefixes) {
+            if ((subtype.compare(0, prefix.size(), prefix) == 0) && (subtype.find_first_of(LINE_TERMINATORS, prefix.size()) == String::npos)) {
+                return true;
+            }
+        }
+
+        for (const auto& regex : _matcher.regexes) {
+            if (std::regex_match(subtype, regex)) {
+                return true;
             }
         }
 
@@ -59,6 +175,8 @@ namespace FieaGameEngine {
 
         assert(args.Is(AttributedEventArgs::TypeIdClass()));
 
+        // Actions rarely write to their arguments, so the arguments share the event's arrays until one does.
+        Datum::SharingCopies sharing{};
         Scope pushedArguments{};
         static_cast<const AttributedEventArgs&>(args).CForEachAuxiliaryAttribute([&pushedArguments](const key_type& key, const Datum& datum) {
             pushedArguments.Append(key) = datum;
@@ -1,4 +1,6 @@
 #pragma once
+#include <regex>
+#include <vector>
 #include "Reaction.h"
 #include "Stack.h"
 
@@ -19,6 +21,9 @@ namespace FieaGameEngine {
 
         [[nodiscard]] bool IsReactingTo(const IEventArgs&) const override;
 
+        /// <returns>Does any of the subtype regexes match the whole of the given subtype?</returns>
+        [[nodiscard]] bool IsMatchingSubtype(const String& subtype) const;
+
         [[nodiscard]] const Datum& GetReactsToSubtypeRegexes() const;
         [[nodiscard]] const String& GetReactsToSubtypeRegex(size_type index = size_type(0)) const;
 
@@ -34,10 +39,51 @@ namespace FieaGameEngine {
 
         [[nodiscard]] Datum& ReactsToSubtypeRegexes();
 
+        /// <summary>
+        /// Tells the reaction index the matcher may be stale, the first time the reaction changes since it was last compiled.
+        /// </summary>
+        void ContentChanged() override;
+
     private:
+        friend class AttributedReactionIndex;
+
+        /// <summary>
+        /// Subtype regexes as compiled, sorted by how they are matched. Regexes which only match one string are matched by comparing strings,
+        /// and those which only match strings starting with one string, such as `Player\..*`, by comparing the start of the subtype.
+        /// </summary>
+        struct SubtypeMatcher final {
+            Vector<String> literals{};
+            Vector<String> prefixes{};
+            std::vector<std::regex> regexes{};
+        };
+
         Datum* _reactsToSubtypeRegexes{nullptr};
         Stack<const Scope*> _pushedArguments{};
 
+        mutable SubtypeMatcher _matcher{};
+
+        /// <summary>
+        /// Subtype regexes the matcher was compiled from, so it is only compiled again once they change.
+        /// </summary>
+        mutable Datum _matcherCompiledFrom{};
+
+        /// <summary>
+        /// Serial the reaction index registered the reaction under, or zero if it is not registered. Serials increase with each
+        /// registration, so a reaction unregistered and registered again is told apart from the registration it had before.
+        /// </summary>
+        std::size_t _registration{0};
+
+        /// <summary>
+        /// Set once the reaction changed since the reaction index last compiled its matcher, until the index next does.
+        /// </summary>
+        bool _isMatcherStale{false};
+
+        /// <returns>Was the matcher compiled again, as the subtype regexes changed since it last was?</returns>
+        bool CompileMatcher() const;
+
+        /// <returns>Does the matcher, as last compiled, match the subtype?</returns>
+        [[nodiscard]] bool MatchSubtype(const String& subtype) const;
+
     };
 
     FACTORY(AttributedReaction, Scope);
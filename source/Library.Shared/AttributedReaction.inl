@@ -10,11 +10,31 @@ namespace FieaGameEngine {
     }; }
 
     inline AttributedReaction::AttributedReaction() : AttributedReaction{String{}} {}
-    inline AttributedReaction::AttributedReaction(const AttributedReaction& other) : Reaction{other} { _reactsToSubtypeRegexes = &(At(REACTS_TO_SUBTYPE_REGEX_KEY)); }
+    inline AttributedReaction::AttributedReaction(const AttributedReaction& other) : Reaction{other} {
+        _reactsToSubtypeRegexes = &(At(REACTS_TO_SUBTYPE_REGEX_KEY));
+        ObserveContent();
+
+        if (GameplayState::HasSingleton()) {
+            GameplayState::Singleton().ReactionIndex().Register(*this);
+        }
+    }
     inline AttributedReaction::AttributedReaction(AttributedReaction&& other) noexcept : Reaction{std::move(other)} {
         _reactsToSubtypeRegexes = &(At(REACTS_TO_SUBTYPE_REGEX_KEY));
+        ObserveContent();
+
+        if (GameplayState::HasSingleton()) {
+            auto& index = GameplayState::Singleton().ReactionIndex();
+            index.Unregister(other);
+            index.Register(*this);
+        }
+    }
+    inline AttributedReaction::~AttributedReaction() {
+        if (GameplayState::HasSingleton()) {
+            GameplayState::Singleton().ReactionIndex().Unregister(*this);
+        }
+
+        _reactsToSubtypeRegexes = nullptr;
     }
-    inline AttributedReaction::~AttributedReaction() { _reactsToSubtypeRegexes = nullptr; }
 
     inline Datum& AttributedReaction::ReactsToSubtypeRegexes() { assert(_reactsToSubtypeRegexes != nullptr); return *_reactsToSubtypeRegexes; }
     inline const Datum& AttributedReaction::GetReactsToSubtypeRegexes() const { assert(_reactsToSubtypeRegexes != nullptr); return *_reactsToSubtypeRegexes; }
@@ -0,0 +1,145 @@
+#include "pch.h"
+#include "AttributedReactionIndex.h"
+#include <cassert>
+#include "AttributedEventArgs.h"
+#include "AttributedReaction.h"
+#include "Event.h"
+
+using namespace std::literals::string_literals;
+
+namespace FieaGameEngine {
+    AttributedReactionIndex::AttributedReactionIndex()
+        : _subscriber{std::make_shared<EventSubscriber>([this](const IEventArgs& args) {
+            assert(args.Is(AttributedEventArgs::TypeIdClass()));
+            Publish(static_cast<const AttributedEventArgs&>(args));
+        })}
+    {}
+
+    AttributedReactionIndex::~AttributedReactionIndex() {
+        // Reactions may outlive the index, and must not tell it when they change once it is gone.
+        for (AttributedReaction* reaction : _reactions) {
+            reaction->_registration = size_type(0);
+            reaction->_isMatcherStale = false;
+        }
+    }
+
+    bool AttributedReactionIndex::Register(AttributedReaction& reaction) {
+        if (IsRegistered(reaction)) {
+            return false;
+        }
+
+        // Subscribed on the first registration rather than on construction, so the index can be created before the event subscriptions.
+        if (!_isSubscribed) {
+            Event::Subscribe<AttributedEventArgs>(_subscriber);
+            _isSubscribed = true;
+        }
+
+        _reactions.PushBack(&reaction);
+        reaction._registration = ++_lastRegistration;
+        reaction._isMatcherStale = false;
+        reaction.CompileMatcher();
+        Remember(reaction);
+        ++_generation;
+        return true;
+    }
+
+    bool AttributedReactionIndex::Unregister(const AttributedReaction& reaction) {
+        auto& registered = const_cast<AttributedReaction&>(reaction);
+
+        if (!_reactions.Remove(&registered)) {
+            return false;
+        }
+
+        Forget(registered);
+
+        if (registered._isMatcherStale) {
+            _stale.Remove(&registered);
+        }
+
+        registered._registration = size_type(0);
+        registered._isMatcherStale = false;
+        ++_generation;
+        return true;
+    }
+
+    const typename AttributedReactionIndex::ReactionVector& AttributedReactionIndex::Find(const String& subtype) {
+        Refresh();
+
+        auto found = _interested.Find(subtype);
+
+        if (found == _interested.end()) {
+            ReactionVector interested{};
+
+            for (AttributedReaction* reaction : _reactions) {
+                if (reaction->MatchSubtype(subtype)) {
+                    interested.PushBack(reaction);
+                }
+            }
+
+            if (_subtypes.Size() < MAX_SUBTYPE_COUNT) {
+                _subtypes.PushBack(subtype);
+            } else {
+                _interested.Remove(_subtypes[_oldestSubtype]);
+                _subtypes[_oldestSubtype] = subtype;
+                _oldestSubtype = (_oldestSubtype + 1) % MAX_SUBTYPE_COUNT;
+            }
+
+            found = _interested.Insert(std::make_pair(subtype, std::move(interested)));
+        }
+
+        return found->second;
+    }
+
+    void AttributedReactionIndex::Publish(const AttributedEventArgs& args) {
+        // Reactions may create or destroy reactions as they react, so they react from a copy, and once any is, only those still registered react.
+        // A reaction unregistered and registered again, or a new one at the same address, has a later registration, so it does not react either.
+        // Their subtypes were matched once the subtype was first seen, but reactions may still turn down events for other reasons.
+        const ReactionVector interested = Find(args.GetSubtype());
+        const size_type generation = _generation;
+        const size_type lastRegistration = _lastRegistration;
+
+        for (AttributedReaction* reaction : interested) {
+            if (((_generation == generation) || (IsRegistered(*reaction) && (reaction->_registration <= lastRegistration))) && reaction->IsReactingTo(args)) {
+                reaction->React(args);
+            }
+        }
+    }
+
+    void AttributedReactionIndex::MarkStale(AttributedReaction& reaction) {
+        _stale.PushBack(&reaction);
+    }
+
+    void AttributedReactionIndex::Refresh() {
+        for (AttributedReaction* reaction : _stale) {
+            reaction->_isMatcherStale = false;
+
+            if (reaction->CompileMatcher()) {
+                Forget(*reaction);
+                Remember(*reaction);
+            }
+        }
+
+        _stale.Clear();
+    }
+
+    void AttributedReactionIndex::Remember(AttributedReaction& reaction) {
+        for (auto& [subtype, interested] : _interested) {
+            if (!reaction.MatchSubtype(subtype)) {
+                continue;
+            }
+
+            interested.PushBack(&reaction);
+
+            // Only a reaction whose matcher was compiled again can have been registered before others already remembered.
+            for (auto i = interested.Size() - 1; (i > 0) && (interested[i - 1]->_registration > reaction._registration); --i) {
+                std::swap(interested[i - 1], interested[i]);
+            }
+        }
+    }
+
+    void AttributedReactionIndex::Forget(const AttributedReaction& reaction) {
+        for (auto& pair : _interested) {
+            pair.second.Remove(const_cast<AttributedReaction*>(&reaction));
+        }
+    }
+}
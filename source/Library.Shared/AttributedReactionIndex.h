@@ -0,0 +1,105 @@
+#pragma once
+#include <memory>
+#include <string>
+#include "EventSubscriber.h"
+#include "HashMap.h"
+#include "Vector.h"
+
+namespace FieaGameEngine {
+    class AttributedEventArgs;
+    class AttributedReaction;
+
+    /// <summary>
+    /// Dispatches attributed events to the reactions interested in their subtype, in the order the reactions were registered.
+    /// Subscribes to attributed events once, when the first reaction is registered, on behalf of every reaction, and remembers which reactions each subtype reaches,
+    /// so a publish only tests the reactions' subtype regexes the first time a subtype is seen.
+    /// Reactions tell the index when they change, and only those are compiled again before the next publish, updating the remembered subtypes they match.
+    /// </summary>
+    class AttributedReactionIndex final {
+
+    public:
+        using size_type = std::size_t;
+        using String = std::string;
+        using ReactionVector = Vector<AttributedReaction*>;
+
+        /// <summary>
+        /// Number of subtypes remembered at once. Once there are more, the subtype remembered longest ago is forgotten.
+        /// </summary>
+        static constexpr size_type MAX_SUBTYPE_COUNT = size_type(1024);
+
+        AttributedReactionIndex();
+        AttributedReactionIndex(const AttributedReactionIndex&) = delete;
+        AttributedReactionIndex(AttributedReactionIndex&&) noexcept = delete;
+        AttributedReactionIndex& operator=(const AttributedReactionIndex&) = delete;
+        AttributedReactionIndex& operator=(AttributedReactionIndex&&) noexcept = delete;
+        ~AttributedReactionIndex();
+
+        /// <summary>
+        /// Adds the reaction to those events are dispatched to, and subscribes the index to attributed events if this is the first.
+        /// The index is only subscribed once, so it must not outlive the event subscriptions once a reaction is registered.
+        /// </summary>
+        /// <returns>Was the reaction added? False if it was already registered.</returns>
+        bool Register(AttributedReaction& reaction);
+        bool Unregister(const AttributedReaction& reaction);
+
+        [[nodiscard]] size_type Size() const;
+        [[nodiscard]] bool IsRegistered(const AttributedReaction& reaction) const;
+
+        /// <returns>Registered reactions interested in events of the given subtype, in the order they were registered.</returns>
+        [[nodiscard]] const ReactionVector& Find(const String& subtype);
+
+        /// <summary>
+        /// Has every reaction interested in the event's subtype react to it, if it is reacting to the event.
+        /// </summary>
+        void Publish(const AttributedEventArgs& args);
+
+    private:
+        friend class AttributedReaction;
+
+        ReactionVector _reactions{};
+        HashMap<String, ReactionVector> _interested{};
+
+        /// <summary>
+        /// Remembered subtypes in the order they were first seen. Once full, the oldest is overwritten in turn, starting from the given position.
+        /// </summary>
+        Vector<String> _subtypes{};
+        size_type _oldestSubtype{0};
+
+        /// <summary>
+        /// Registered reactions which changed since their matcher was last compiled.
+        /// </summary>
+        ReactionVector _stale{};
+
+        /// <summary>
+        /// Incremented whenever a reaction is registered or unregistered, so a publish can tell if its reactions are still registered.
+        /// </summary>
+        size_type _generation{0};
+
+        /// <summary>
+        /// Serial of the latest registration.
+        /// </summary>
+        size_type _lastRegistration{0};
+
+        std::shared_ptr<EventSubscriber> _subscriber;
+        bool _isSubscribed{false};
+
+        /// <summary>
+        /// Has the matcher of the reaction compiled again before the next publish. Called by reactions as they change.
+        /// </summary>
+        void MarkStale(AttributedReaction& reaction);
+
+        /// <summary>
+        /// Recompiles the subtype matcher of every stale reaction, and moves those whose regexes changed between the remembered subtypes.
+        /// </summary>
+        void Refresh();
+
+        /// <summary>
+        /// Adds the reaction to every remembered subtype its matcher matches, keeping each in the order reactions were registered.
+        /// </summary>
+        void Remember(AttributedReaction& reaction);
+        void Forget(const AttributedReaction& reaction);
+
+    };
+}
+
+#include "AttributedReactionIndex.inl"
@@ -0,0 +1,9 @@
+#pragma once
+#include "AttributedReactionIndex.h"
+
+namespace FieaGameEngine {
+    inline typename AttributedReactionIndex::size_type AttributedReactionIndex::Size() const { return _reactions.Size(); }
+    inline bool AttributedReactionIndex::IsRegistered(const AttributedReaction& reaction) const {
+        return _reactions.CFind(const_cast<AttributedReaction*>(&reaction)) != _reactions.cend();
+    }
+}
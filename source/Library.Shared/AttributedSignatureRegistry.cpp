@@ -65,6 +65,17 @@ namespace FieaGameEngine {
             }
         }
 
+        SignatureLayout layout{signatures.Size()};
+
+        for (const auto& signature : signatures) {
+            layout.EmplaceBack(PrecompiledSignature{
+                signature,
+                Scope::KeyHashCode(signature.Key()),
+                (signature.Type() == Datum::DatumType::Table) ? Datum::DatumType::InternalTable : signature.Type()
+            });
+        }
+
+        _layouts.Insert(std::make_pair(key, std::move(layout)));
         _registered.Insert(std::make_pair(key, std::move(signatures)));
         return true;
     }
@@ -77,6 +88,7 @@ namespace FieaGameEngine {
         }
 
         _registered.Remove(found);
+        _layouts.Remove(key);
         return true;
     }
 }
@@ -4,6 +4,21 @@
 namespace FieaGameEngine {
     using SignatureVector = Vector<Attributed::Signature>;
 
+    /// <summary>
+    /// A signature precompiled by the registry: its key's hash code is computed once at registration, and the datum type
+    /// to use for internal storage is already resolved.
+    /// </summary>
+    struct PrecompiledSignature final {
+        Attributed::Signature signature;
+        Scope::size_type keyHashCode;
+        Datum::DatumType internalType;
+    };
+
+    /// <summary>
+    /// Immutable per-type layout of prescribed attributes, in the order they are appended (parents first).
+    /// </summary>
+    using SignatureLayout = Vector<PrecompiledSignature>;
+
     class AttributedSignatureRegistry final {
 
         friend std::unique_ptr<AttributedSignatureRegistry> std::make_unique();
@@ -17,6 +32,7 @@ namespace FieaGameEngine {
         static std::unique_ptr<AttributedSignatureRegistry> _instance;
 
         HashMap<key_type, SignatureVector> _registered;
+        HashMap<key_type, SignatureLayout> _layouts;
 
         AttributedSignatureRegistry() = default;
 
@@ -24,6 +40,7 @@ namespace FieaGameEngine {
         bool _UnregisterSignatures(const key_type& key);
         const_iterator _FindSignatures(const key_type& key) const;
         bool _IsFound(const const_iterator& itr) const;
+        const SignatureLayout* _FindLayout(const key_type& key) const;
 
     public:
         static bool CreateSingleton();
@@ -39,6 +56,12 @@ namespace FieaGameEngine {
         static const_iterator FindSignatures(const key_type& key);
         static bool IsFound(const const_iterator& iterator);
 
+        /// <summary>
+        /// Finds the precompiled layout for the given type.
+        /// </summary>
+        /// <returns>nullptr if the type has no registered signatures.</returns>
+        static const SignatureLayout* FindLayout(const key_type& key);
+
         AttributedSignatureRegistry(const AttributedSignatureRegistry&) = delete;
         AttributedSignatureRegistry(AttributedSignatureRegistry&&) noexcept = delete; // discuss with Paul
         AttributedSignatureRegistry& operator=(const AttributedSignatureRegistry&) = delete;
@@ -35,6 +35,10 @@ namespace FieaGameEngine {
         assert(_instance); return _instance->_IsFound(iterator);
     }
 
+    inline const SignatureLayout* AttributedSignatureRegistry::FindLayout(const key_type& key) {
+        assert(_instance); return _instance->_FindLayout(key);
+    }
+
     inline typename AttributedSignatureRegistry::const_iterator AttributedSignatureRegistry::_FindSignatures(
         const key_type& key
     ) const { return _registered.CFind(key); }
@@ -42,4 +46,9 @@ namespace FieaGameEngine {
     inline bool AttributedSignatureRegistry::_IsFound(const const_iterator& iterator) const {
         return iterator != _registered.cend();
     }
+
+    inline const SignatureLayout* AttributedSignatureRegistry::_FindLayout(const key_type& key) const {
+        auto found = _layouts.CFind(key);
+        return (found == _layouts.cend()) ? nullptr : &(found->second);
+    }
 }
@@ -21,7 +21,8 @@ namespace FieaGameEngine {
         "pointer"s,
         "table"s,
         "internalTable"s,
-        "externalTable"s
+        "externalTable"s,
+        "handle"s
     };
 
     const typename Datum::size_type Datum::TYPE_SIZES[] = { // Must match the definition of DatumType, in Datum.h
@@ -34,7 +35,8 @@ namespace FieaGameEngine {
         sizeof(Pointer),
         size_type(0), // Table, never actually used within the datum
         sizeof(InternalTablePointer),
-        sizeof(ExternalTablePointer)
+        sizeof(ExternalTablePointer),
+        sizeof(Handle)
     };
 
     Datum::Datum(
@@ -45,10 +47,21 @@ namespace FieaGameEngine {
         _parent = parent;
         scalar->_parent = parent;
         _data.t = new InternalTablePointer{std::forward<InternalTablePointer>(scalar)};
+        IndexTableElements();
+        Scope::InvalidateSearches();
     }
 
     Datum::Datum(const Datum& other) : _size{other._size}, _type{other._type}, _isDataInternal{other._isDataInternal}, _isDataExternalConst{other._isDataExternalConst} {
-        if (other._isDataInternal) {
+        if (other._isDataInternal && _isSharingCopies && other.IsShareable()) {
+            if (other._sharedStorage == nullptr) {
+                other._sharedStorage = new SharedStorage{size_type(1)};
+            }
+
+            ++(other._sharedStorage->references);
+            _sharedStorage = other._sharedStorage;
+            _capacity = _size;
+            _data.vp = other._data.vp;
+        } else if (other._isDataInternal) {
             assert(other.ActualType() != DatumType::ExternalTable);
             Reserve(other._capacity);
 
@@ -78,10 +91,12 @@ namespace FieaGameEngine {
         , _type{other._type}
         , _isDataInternal{other._isDataInternal}
         , _growCapacityFunctor{other._growCapacityFunctor}
+        , _sharedStorage{other._sharedStorage}
     {
         _data.vp = other._data.vp;
         assert(other.ActualType() != DatumType::Table);
         PromulgateParent();
+        other._sharedStorage = nullptr;
         other._data.vp = nullptr;
         other._size = size_type(0);
         other._capacity = size_type(0);
@@ -109,18 +124,22 @@ namespace FieaGameEngine {
             _type = other._type;
             _isDataInternal = other._isDataInternal;
             _isDataExternalConst = other._isDataExternalConst;
+            _sharedStorage = other._sharedStorage;
 
             assert(other.ActualType() != DatumType::Table);
             if (other.ActualType() == DatumType::InternalTable) {
                 PromulgateParent();
             }
 
+            other._sharedStorage = nullptr;
             other._data.vp = nullptr;
             other._size = size_type(0);
             other._capacity = size_type(0);
             other._type = DatumType::Unknown;
             other._isDataInternal = true;
             other._isDataExternalConst = false;
+            MarkContentChanged();
+            other.MarkContentChanged();
         }
 
         return *this;
@@ -128,7 +147,10 @@ namespace FieaGameEngine {
 
     Datum& Datum::operator=(InternalTablePointer scalar) {
         scalar->_parent = _parent;
-        return AssignFromScalarForward(DatumType::InternalTable, std::forward<InternalTablePointer>(scalar));
+        AssignFromScalarForward(DatumType::InternalTable, std::forward<InternalTablePointer>(scalar));
+        IndexTableElements();
+        Scope::InvalidateSearches();
+        return *this;
     }
 
     Datum& Datum::operator=(Table&& scalar) {
@@ -167,6 +189,7 @@ namespace FieaGameEngine {
         _capacity = size_type(1);
         _isDataInternal = true;
         _isDataExternalConst = false;
+        MarkContentChanged();
     }
 
     Datum& Datum::operator=(Pointer scalar) {
@@ -302,18 +325,27 @@ namespace FieaGameEngine {
 
         assert((_type != DatumType::Table) && (_type != DatumType::ExternalTable));
 
+        if (ReleaseSharedStorage()) {
+            MarkContentChanged();
+            return;
+        }
+
         if (_type == DatumType::String) {
             for (auto i = size_type(0); i < _size; ++i) {
                 (_data.s + i)->~basic_string();
             }
-        } else if (_type == DatumType::InternalTable) {
+        } else if ((_type == DatumType::InternalTable) && (_size > size_type(0))) {
             for (auto i = size_type(0); i < _size; ++i) {
                 (*(_data.t + i))->_parent = nullptr;
                 (_data.t + i)->reset();
             }
+
+            // Bindings may point into the destroyed scopes.
+            Scope::InvalidateSearches();
         }
 
         _size = size_type(0);
+        MarkContentChanged();
     }
 
     void Datum::SetType(DatumType type) {
@@ -330,6 +362,7 @@ namespace FieaGameEngine {
         }
 
         _type = type;
+        MarkContentChanged();
     }
 
     void Datum::Resize(size_type size) {
@@ -343,17 +376,21 @@ namespace FieaGameEngine {
 
         assert((_type != DatumType::Table) && (_type != DatumType::ExternalTable));
 
+        Unshare();
+        MarkContentChanged();
         _capacity = size;
 
         if (_type == DatumType::String) {
             for (auto i = _capacity; i < _size; ++i) {
                 (_data.s + i)->~basic_string();
             }
-        } else if (_type == DatumType::InternalTable) {
+        } else if ((_type == DatumType::InternalTable) && (_size > size_type(0))) {
             for (auto i = size_type(0); i < _size; ++i) {
                 (*(_data.t + i))->_parent = nullptr;
                 (_data.t + i)->reset();
             }
+
+            Scope::InvalidateSearches();
         }
 
         if (_capacity == size_type(0)) {
@@ -411,6 +448,12 @@ namespace FieaGameEngine {
             }
             break;
 
+        case DatumType::Handle:
+            for (auto index = _size; index < _capacity; ++index) {
+                new (_data.h + index) Handle{};
+            }
+            break;
+
         }
 
         _size = _capacity;
@@ -423,6 +466,7 @@ namespace FieaGameEngine {
 
         assert((_type != DatumType::Table) && (_type != DatumType::ExternalTable));
 
+        Unshare();
         void* data = std::realloc(_data.vp, TypeSize() * capacity);
         assert(data != nullptr);
         _data.vp = data;
@@ -430,11 +474,12 @@ namespace FieaGameEngine {
     }
 
     void Datum::ShrinkToFit(size_type minCapacity) {
-        if (_size == _capacity) {
+        if ((_size == _capacity) || IsDataShared()) {
             return;
         }
 
         assert(_isDataInternal);
+        Unshare();
 
         _capacity = std::max(std::min(_capacity, minCapacity), _size);
 
@@ -465,6 +510,7 @@ namespace FieaGameEngine {
         _capacity = size;
         _isDataInternal = false;
         _isDataExternalConst = isConst;
+        MarkContentChanged();
     }
 
     bool Datum::IsElementRetrievable(size_type index) const {
@@ -498,6 +544,9 @@ namespace FieaGameEngine {
         if (_size <= index) {
             throw std::out_of_range("Index out of range, cannot set "s + ToStringDatumType(type) + " element."s);
         }
+
+        Unshare();
+        MarkContentChanged();
     }
 
     void Datum::SetElement(const Table& element, size_type index) {
@@ -538,6 +587,7 @@ namespace FieaGameEngine {
         assert((_type != DatumType::Table) && (_type != DatumType::ExternalTable));
 
         if (_size > size_type(0)) {
+            Unshare();
             --_size;
 
             if (_type == DatumType::String) {
@@ -547,7 +597,10 @@ namespace FieaGameEngine {
             if (_type == DatumType::InternalTable) {
                 (*(_data.t + _size))->_parent = nullptr;
                 (_data.t + _size)->reset();
+                Scope::InvalidateSearches();
             }
+
+            MarkContentChanged();
         }
     }
 
@@ -594,6 +647,20 @@ namespace FieaGameEngine {
             for (auto i = size_type(0); i < _size; ++i) {
                 (*(_data.t + i))->_parent = _parent;
             }
+
+            IndexTableElements();
+            Scope::InvalidateSearches();
+        }
+    }
+
+    void Datum::IndexTableElements(size_type first) {
+        if (ActualType() == DatumType::InternalTable) {
+            for (auto i = first; i < _size; ++i) {
+                if (*(_data.t + i)) {
+                    (*(_data.t + i))->_containingDatum = this;
+                    (*(_data.t + i))->_containingIndex = i;
+                }
+            }
         }
     }
 
@@ -605,6 +672,8 @@ namespace FieaGameEngine {
         assert(_data.vp != nullptr);
         assert((_type != DatumType::Unknown) && (_type != DatumType::Table) && (_type != DatumType::ExternalTable));
 
+        Unshare();
+
         if (_type == DatumType::String) {
             (_data.s + index)->~basic_string();
         }
@@ -612,6 +681,7 @@ namespace FieaGameEngine {
         if (_type == DatumType::InternalTable) {
             (*(_data.t + index))->_parent = nullptr;
             (_data.t + index)->reset();
+            Scope::InvalidateSearches();
         }
 
         auto diff = _size - index - 1;
@@ -620,6 +690,13 @@ namespace FieaGameEngine {
         }
 
         --_size;
+
+        if (_type == DatumType::InternalTable) {
+            // Scopes after the removed one have shifted down, so their recorded indices are refreshed.
+            IndexTableElements(index);
+        }
+
+        MarkContentChanged();
         return true;
     }
 
@@ -634,6 +711,8 @@ namespace FieaGameEngine {
             throw std::logic_error("Cannot push back element to datum of type Unknown if conversion from string is required."s);
         }
 
+        Unshare();
+
         if (_size == _capacity) {
             Reserve(std::max(_growCapacityFunctor(_size, _capacity), _capacity + 1));
         }
@@ -651,6 +730,9 @@ namespace FieaGameEngine {
             throw std::out_of_range("Index out of range, cannot make element from string."s);
         }
 
+        Unshare();
+        MarkContentChanged();
+
         switch (_type) {
 
         case FieaGameEngine::Datum::DatumType::Integer:
@@ -765,6 +847,13 @@ namespace FieaGameEngine {
             s = (*(_data.x + index))->ToString();
             break;
 
+        case DatumType::Handle:
+            {
+                const Scope* scope = (_data.h + index)->Resolve();
+                s = (scope != nullptr) ? scope->ToString() : "null"s;
+            }
+            break;
+
         }
 
         return s;
@@ -800,10 +889,70 @@ namespace FieaGameEngine {
         swap(_size, other._size);
         swap(_capacity, other._capacity);
         swap(_isDataInternal, other._isDataInternal);
+        swap(_sharedStorage, other._sharedStorage);
 
         void* vp = _data.vp;
         _data.vp = other._data.vp;
         other._data.vp = vp;
+
+        IndexTableElements();
+        other.IndexTableElements();
+        MarkContentChanged();
+        other.MarkContentChanged();
+    }
+
+    void Datum::MarkContentChanged() {
+        if (_parent != nullptr) {
+            _parent->MarkContentChanged();
+        }
+    }
+
+    bool Datum::IsShareable() const {
+        // Tables are not shared, as each nested scope records the datum which owns it.
+        return _isDataInternal && (_size > size_type(0)) && (_type != DatumType::Unknown) && (_type != DatumType::InternalTable);
+    }
+
+    void Datum::Unshare() {
+        if (_sharedStorage == nullptr) {
+            return;
+        }
+
+        if (--(_sharedStorage->references) == size_type(0)) {
+            delete _sharedStorage;
+            _sharedStorage = nullptr;
+            return;
+        }
+
+        _sharedStorage = nullptr;
+        const DatumValues shared = _data;
+        _data.vp = std::malloc(TypeSize() * _capacity);
+        assert(_data.vp != nullptr);
+
+        if (_type == DatumType::String) {
+            for (auto i = size_type(0); i < _size; ++i) {
+                new (_data.s + i) String{*(shared.s + i)};
+            }
+        } else {
+            std::memcpy(_data.vp, shared.vp, _size * TypeSize());
+        }
+    }
+
+    bool Datum::ReleaseSharedStorage() {
+        if (_sharedStorage == nullptr) {
+            return false;
+        }
+
+        if (--(_sharedStorage->references) == size_type(0)) {
+            delete _sharedStorage;
+            _sharedStorage = nullptr;
+            return false;
+        }
+
+        _sharedStorage = nullptr;
+        _data.vp = nullptr;
+        _size = size_type(0);
+        _capacity = size_type(0);
+        return true;
     }
 
     void Datum::PushBack(InternalTablePointer element) {
@@ -813,6 +962,7 @@ namespace FieaGameEngine {
 
         element->_parent = _parent;
         EmplaceBackTable(std::forward<InternalTablePointer>(element));
+        Scope::InvalidateSearches();
     }
 
     Datum::DatumType StringToDatumType(const Datum::String& str) {
@@ -859,6 +1009,9 @@ namespace FieaGameEngine {
         case DatumType::ExternalTable:
             return (*(_data.x + index)) != nullptr;
 
+        case DatumType::Handle:
+            return (_data.h + index)->IsValid();
+
         }
 
         return true;
@@ -7,6 +7,7 @@
 #include <string>
 #include "DefaultGrowCapacity.h"
 #include "RTTI.h"
+#include "ScopeHandle.h"
 
 namespace FieaGameEngine {
     // Forward declaration.
@@ -24,6 +25,16 @@ namespace FieaGameEngine {
         // so is Attributed. :)
         friend class Attributed;
 
+        // and the archetype store, which hands out views into its columns.
+        friend class AttributedArchetypeStore;
+
+        // and prototypes, which copy recorded elements straight into storage.
+        friend class ScopePrototype;
+
+        // and the binary serializer, which streams elements straight to and from storage.
+        friend class ScopeBinaryWriter;
+        friend class ScopeBinaryReader;
+
         /// <summary>
         /// Integer type.
         /// </summary>
@@ -69,6 +80,11 @@ namespace FieaGameEngine {
         /// </summary>
         using ExternalTablePointer = Table*;
 
+        /// <summary>
+        /// Handle type, a weak reference to a scope which resolves to null once the scope is destroyed.
+        /// </summary>
+        using Handle = ScopeHandle;
+
         /// <summary>
         /// Size type, used for indicies and for storing size and capacity.
         /// </summary>
@@ -88,6 +104,7 @@ namespace FieaGameEngine {
             Table,
             InternalTable,
             ExternalTable,
+            Handle,
             __SIZE
         };
 
@@ -109,6 +126,7 @@ namespace FieaGameEngine {
             Pointer* p;
             InternalTablePointer* t;
             ExternalTablePointer* x;
+            Handle* h;
             std::byte* bp;
             void* vp;
         };
@@ -163,6 +181,24 @@ namespace FieaGameEngine {
         /// </summary>
         GrowCapacityFunctorType _growCapacityFunctor{DefaultGrowCapacity{}};
 
+        /// <summary>
+        /// Number of datums sharing one internal array. The last datum to let go of the array owns it again.
+        /// Not synchronized, so datums sharing an array must not be used from different threads.
+        /// </summary>
+        struct SharedStorage final {
+            size_type references;
+        };
+
+        /// <summary>
+        /// Set while the internal array is shared with copies of this datum. Copies made on the source's behalf, so it is mutable.
+        /// </summary>
+        mutable SharedStorage* _sharedStorage{nullptr};
+
+        /// <summary>
+        /// Set while a `SharingCopies` guard is alive on this thread.
+        /// </summary>
+        inline static thread_local bool _isSharingCopies{false};
+
         /// <summary>
         /// Retrieves the size of the datum's current type.
         /// </summary>
@@ -311,7 +347,51 @@ namespace FieaGameEngine {
         // TODO - comment
         void PromulgateParent();
 
+        /// <summary>
+        /// Records this datum and the element index in each nested scope from the given index onward,
+        /// so that a scope can find its position without searching its parent.
+        /// </summary>
+        void IndexTableElements(size_type first = size_type(0));
+
+        /// <summary>
+        /// Tells the scope which owns this datum, if any, that its content changed. Must be called by every mutating operation.
+        /// </summary>
+        void MarkContentChanged();
+
+        /// <returns>Can the internal array of this datum be shared by copies?</returns>
+        [[nodiscard]] bool IsShareable() const;
+
+        /// <summary>
+        /// Gives this datum an internal array of its own, copying the shared elements if other datums still use them.
+        /// Must be called by every operation which writes to the internal array, before writing.
+        /// </summary>
+        void Unshare();
+
+        /// <summary>
+        /// Lets go of a shared internal array without copying it. If other datums still use the array, this datum is left empty.
+        /// </summary>
+        /// <returns>Was the array left to other datums? If not, this datum owns it again and must destroy it.</returns>
+        bool ReleaseSharedStorage();
+
     public:
+        /// <summary>
+        /// While an instance is alive, datums copied on the same thread share their internal array with the source instead of copying it.
+        /// Whichever datum is written to first copies the elements then, so the copies behave exactly like deep copies.
+        /// Tables are never shared, but the scopes cloned into them share the arrays of their own datums in turn.
+        /// </summary>
+        class SharingCopies final {
+
+        private:
+            bool _wasSharingCopies;
+
+        public:
+            SharingCopies();
+            ~SharingCopies();
+            SharingCopies(const SharingCopies&) = delete;
+            SharingCopies& operator=(const SharingCopies&) = delete;
+
+        };
+
         /// <summary>
         /// String format used to create and parse string representations of Vector types.
         /// </summary>
@@ -419,6 +499,11 @@ namespace FieaGameEngine {
         /// </summary>
         Datum(Pointer scalar, GrowCapacityFunctorType growCapacityFunctor = DefaultGrowCapacity{});
 
+        /// <summary>
+        /// Implicit constructor for assigning the datum to a scalar Handle value. Optionally will accept a capacity growth strategy.
+        /// </summary>
+        Datum(Handle scalar, GrowCapacityFunctorType growCapacityFunctor = DefaultGrowCapacity{});
+
         /// <summary>
         /// Implicit constructor for assigning the datum to a scalar Table value. Optionally will accept a capacity growth strategy.
         /// </summary>
@@ -472,6 +557,11 @@ namespace FieaGameEngine {
         /// </summary>
         explicit Datum(std::initializer_list<Pointer> list);
 
+        /// <summary>
+        /// Explicit constructor for initializing the datum using an initializer list.
+        /// </summary>
+        explicit Datum(std::initializer_list<Handle> list);
+
         /// <summary>
         /// Assigns the datum to a scalar Integer value.
         /// </summary>
@@ -517,6 +607,11 @@ namespace FieaGameEngine {
         /// </summary>
         Datum& operator=(Pointer scalar);
 
+        /// <summary>
+        /// Assigns the datum to a scalar Handle value.
+        /// </summary>
+        Datum& operator=(Handle scalar);
+
         /// <summary>
         /// Assigns the datum to a scalar Table value.
         /// </summary>
@@ -562,6 +657,11 @@ namespace FieaGameEngine {
         /// </summary>
         Datum& operator=(std::initializer_list<Pointer> list);
 
+        /// <summary>
+        /// Assigns the datum using an initializer list.
+        /// </summary>
+        Datum& operator=(std::initializer_list<Handle> list);
+
         /// <summary>
         /// Compares the datum to another datum.
         /// </summary>
@@ -597,6 +697,11 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] bool operator==(const Pointer other) const;
 
+        /// <summary>
+        /// Compares the datum to a Handle.
+        /// </summary>
+        [[nodiscard]] bool operator==(const Handle& other) const;
+
         /// <summary>
         /// Compares the datum to a Table.
         /// </summary>
@@ -642,6 +747,11 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] bool operator!=(const Pointer other) const;
 
+        /// <summary>
+        /// Inverse comparison of a datum to a Handle.
+        /// </summary>
+        [[nodiscard]] bool operator!=(const Handle& other) const;
+
         /// <summary>
         /// Inverse comparison of a datum to a Table.
         /// </summary>
@@ -661,6 +771,9 @@ namespace FieaGameEngine {
         /// <returns>Does the datum NOT have ownership of the memory it represents AND is that memory const?</returns>
         [[nodiscard]] bool IsDataExternalConst() const;
 
+        /// <returns>Is the internal array of this datum currently shared with copies, awaiting the first write?</returns>
+        [[nodiscard]] bool IsDataShared() const;
+
         /// <returns>Does the datum have any elements in it?</returns>
         [[nodiscard]] bool IsEmpty() const;
 
@@ -734,6 +847,11 @@ namespace FieaGameEngine {
         /// </summary>
         void SetPointerStorage(Pointer* array, size_type size, bool isConst = false);
 
+        /// <summary>
+        /// Sets the datum to external storage. After this method completes `IsDataInternal()` will be `false`.
+        /// </summary>
+        void SetStorage(Handle* array, size_type size, bool isConst = false);
+
         /// <summary>
         /// Sets the datum to external storage. After this method completes `IsDataInternal()` will be `false`.
         /// </summary>
@@ -769,6 +887,11 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] Pointer& GetPointerElement(size_type index = size_type(0));
 
+        /// <summary>
+        /// Gets the element at the given index. The type of the element must match the type of the datum.
+        /// </summary>
+        [[nodiscard]] Handle& GetHandleElement(size_type index = size_type(0));
+
         /// <summary>
         /// Gets the element at the given index. The type of the element must match the type of the datum.
         /// </summary>
@@ -804,6 +927,11 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] const Pointer GetPointerElement(size_type index = size_type(0)) const;
 
+        /// <summary>
+        /// Gets the element at the given index. The type of the element must match the type of the datum.
+        /// </summary>
+        [[nodiscard]] const Handle& GetHandleElement(size_type index = size_type(0)) const;
+
         /// <summary>
         /// Gets the element at the given index. The type of the element must match the type of the datum.
         /// </summary>
@@ -839,6 +967,11 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] const Pointer CGetPointerElement(size_type index = size_type(0)) const;
 
+        /// <summary>
+        /// Gets the element at the given index. The type of the element must match the type of the datum.
+        /// </summary>
+        [[nodiscard]] const Handle& CGetHandleElement(size_type index = size_type(0)) const;
+
         /// <summary>
         /// Gets the element at the given index. The type of the element must match the type of the datum.
         /// </summary>
@@ -902,6 +1035,11 @@ namespace FieaGameEngine {
         /// </summary>
         void SetElement(Pointer element, size_type index = size_type(0));
 
+        /// <summary>
+        /// Sets the element at the given index. The type of the element must match the type of the datum.
+        /// </summary>
+        void SetElement(const Handle& element, size_type index = size_type(0));
+
         /// <summary>
         /// Sets the element at the given index. This method only works for internal storage.
         /// </summary>
@@ -971,6 +1109,12 @@ namespace FieaGameEngine {
         /// </summary>
         void PushBack(Pointer element);
 
+        /// <summary>
+        /// Adds the element to the end of the datum. The type of the element must match the type of the datum,
+        /// unless the datum's type is currently Unknown, in which case this will set the type.
+        /// </summary>
+        void PushBack(const Handle& element);
+
         /// <summary>
         /// Adds the element to the end of the datum. The type of the element must match the type of the datum,
         /// unless the datum's type is currently Unknown, in which case this will set the type.
@@ -1048,6 +1192,11 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] Pointer& FrontPointer();
 
+        /// <summary>
+        /// Gets the first element of the datum. The type of the element must match the type of the datum.
+        /// </summary>
+        [[nodiscard]] Handle& FrontHandle();
+
         /// <summary>
         /// Gets the first element of the datum. The type of the element must match the type of the datum.
         /// </summary>
@@ -1083,6 +1232,11 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] Pointer FrontPointer() const;
 
+        /// <summary>
+        /// Gets the first element of the datum. The type of the element must match the type of the datum.
+        /// </summary>
+        [[nodiscard]] const Handle& FrontHandle() const;
+
         /// <summary>
         /// Gets the first element of the datum. The type of the element must match the type of the datum.
         /// </summary>
@@ -1118,6 +1272,11 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] Pointer CFrontPointer() const;
 
+        /// <summary>
+        /// Gets the first element of the datum. The type of the element must match the type of the datum.
+        /// </summary>
+        [[nodiscard]] const Handle& CFrontHandle() const;
+
         /// <summary>
         /// Gets the first element of the datum. The type of the element must match the type of the datum.
         /// </summary>
@@ -1153,6 +1312,11 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] Pointer& BackPointer();
 
+        /// <summary>
+        /// Gets the last element of the datum. The type of the element must match the type of the datum.
+        /// </summary>
+        [[nodiscard]] Handle& BackHandle();
+
         /// <summary>
         /// Gets the last element of the datum. The type of the element must match the type of the datum.
         /// </summary>
@@ -1188,6 +1352,11 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] Pointer BackPointer() const;
 
+        /// <summary>
+        /// Gets the last element of the datum. The type of the element must match the type of the datum.
+        /// </summary>
+        [[nodiscard]] const Handle& BackHandle() const;
+
         /// <summary>
         /// Gets the last element of the datum. The type of the element must match the type of the datum.
         /// </summary>
@@ -1223,6 +1392,11 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] Pointer CBackPointer() const;
 
+        /// <summary>
+        /// Gets the last element of the datum. The type of the element must match the type of the datum.
+        /// </summary>
+        [[nodiscard]] const Handle& CBackHandle() const;
+
         /// <summary>
         /// Gets the last element of the datum. The type of the element must match the type of the datum.
         /// </summary>
@@ -1258,6 +1432,11 @@ namespace FieaGameEngine {
         /// </summary>
         bool Find(Pointer element, size_type& index) const;
 
+        /// <summary>
+        /// Returns true if the given element is in the datum, false otherwise. If the element is found, `index` is populated with that element's index.
+        /// </summary>
+        bool Find(const Handle& element, size_type& index) const;
+
         /// <summary>
         /// Returns true if the given element is in the datum, false otherwise. If the element is found, `index` is populated with that element's index.
         /// </summary>
@@ -1298,6 +1477,11 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] bool IsContaining(Pointer element) const;
 
+        /// <summary>
+        /// Does the datum contain the given element?
+        /// </summary>
+        [[nodiscard]] bool IsContaining(const Handle& element) const;
+
         /// <summary>
         /// Does the datum contain the given element?
         /// </summary>
@@ -1344,6 +1528,12 @@ namespace FieaGameEngine {
         /// <returns>True if an element was removed, false otherwise.</returns>
         bool Remove(Pointer element);
 
+        /// <summary>
+        /// Removes the first occurrence of the given element.
+        /// </summary>
+        /// <returns>True if an element was removed, false otherwise.</returns>
+        bool Remove(const Handle& element);
+
         /// <summary>
         /// Removes the first occurrence of the given element.
         /// </summary>
@@ -1408,7 +1598,7 @@ namespace FieaGameEngine {
         /// A value is considered "truthy" if it would be "true" if converted to a boolean. Values are considered "truthy" in the following conditions:
         /// (1) -> If the value is a number, it is "truthy" if it is not 0. Note that if the value is a float, truthiness can be unreliable.
         /// (2) -> If the value is a string, it is "truthy" unless it is empty or is "false" (case insensitive).
-        /// (3) -> If the value is a pointer, it is "truthy" unless it is nullptr.
+        /// (3) -> If the value is a pointer, it is "truthy" unless it is nullptr. If the value is a handle, it is "truthy" while its scope is alive.
         /// (4) -> If the value is a vector or a matrix, it is always truthy.
         /// </summary>
         /// <returns>Whether the value at the given index is "truthy". If the index is out of bounds, false is returned.</returns>
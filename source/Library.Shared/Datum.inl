@@ -37,6 +37,7 @@ namespace FieaGameEngine {
         _type = type;
         _isDataInternal = true;
         _isDataExternalConst = false;
+        MarkContentChanged();
         Reserve(list.size());
 
         for (const auto& element : list) {
@@ -77,6 +78,11 @@ namespace FieaGameEngine {
             throw std::out_of_range("Index out of range, cannot get "s + ToStringDatumType(type) + " element."s);
         }
 
+        if (isPointerMutable) {
+            Unshare();
+            MarkContentChanged();
+        }
+
         return GetElementPointerNoCheck<T>(index);
     }
 
@@ -106,6 +112,8 @@ namespace FieaGameEngine {
             throw std::logic_error("Cannot modify external data, invalid push back operation."s);
         }
 
+        Unshare();
+
         if (_type == DatumType::Unknown) {
             assert(_size == size_type(0));
             _type = type;
@@ -121,6 +129,7 @@ namespace FieaGameEngine {
 
         size_type index = _size++;
         *GetElementPointerNoCheck<T>(index) = element;
+        MarkContentChanged();
     }
 
     template <typename... Args> inline void Datum::EmplaceBackString(Args&&... args) {
@@ -130,6 +139,8 @@ namespace FieaGameEngine {
             throw std::logic_error("Cannot modify external data, invalid emplace back operation."s);
         }
 
+        Unshare();
+
         if (_type == DatumType::Unknown) {
             assert(_size == size_type(0));
             _type = DatumType::String;
@@ -145,6 +156,7 @@ namespace FieaGameEngine {
 
         size_type index = _size++;
         new (_data.s + index) String{std::forward<Args>(args)...};
+        MarkContentChanged();
     }
 
     template <typename... Args> inline void Datum::EmplaceBackVector(Args&&... args) {
@@ -154,6 +166,8 @@ namespace FieaGameEngine {
             throw std::logic_error("Cannot modify external data, invalid emplace back operation."s);
         }
 
+        Unshare();
+
         if (_type == DatumType::Unknown) {
             assert(_size == size_type(0));
             _type = DatumType::Vector;
@@ -169,6 +183,7 @@ namespace FieaGameEngine {
 
         size_type index = _size++;
         new (_data.v + index) Vector{std::forward<Args>(args)...};
+        MarkContentChanged();
     }
 
     template <typename... Args> inline void Datum::EmplaceBackMatrix(Args&&... args) {
@@ -178,6 +193,8 @@ namespace FieaGameEngine {
             throw std::logic_error("Cannot modify external data, invalid emplace back operation."s);
         }
 
+        Unshare();
+
         if (_type == DatumType::Unknown) {
             assert(_size == size_type(0));
             _type = DatumType::Matrix;
@@ -193,6 +210,7 @@ namespace FieaGameEngine {
 
         size_type index = _size++;
         new (_data.m + index) Matrix{std::forward<Args>(args)...};
+        MarkContentChanged();
     }
 
     template <typename... Args> inline void Datum::EmplaceBackTable(Args&&... args) {
@@ -202,6 +220,8 @@ namespace FieaGameEngine {
             throw std::logic_error("Cannot modify external data, invalid emplace back operation."s);
         }
 
+        Unshare();
+
         if (_type == DatumType::Unknown) {
             assert(_size == size_type(0));
             _type = DatumType::InternalTable;
@@ -217,6 +237,8 @@ namespace FieaGameEngine {
 
         size_type index = _size++;
         new (_data.t + index) InternalTablePointer{std::forward<Args>(args)...};
+        IndexTableElements(index);
+        MarkContentChanged();
     }
 
     template <typename T> inline bool Datum::Find(DatumType type, const T& element, size_type& index) const {
@@ -256,6 +278,7 @@ namespace FieaGameEngine {
     inline Datum::Datum(Vector&& scalar, GrowCapacityFunctorType growCapacityFunctor) : Datum{DatumType::Vector, growCapacityFunctor} { _data.v = new Vector{std::forward<Vector>(scalar)}; }
     inline Datum::Datum(const Matrix& scalar, GrowCapacityFunctorType growCapacityFunctor) : Datum{DatumType::Matrix, growCapacityFunctor} { _data.m = new Matrix{scalar}; }
     inline Datum::Datum(Matrix&& scalar, GrowCapacityFunctorType growCapacityFunctor) : Datum{DatumType::Matrix, growCapacityFunctor} { _data.m = new Matrix{std::forward<Matrix>(scalar)}; }
+    inline Datum::Datum(Handle scalar, GrowCapacityFunctorType growCapacityFunctor) : Datum{DatumType::Handle, growCapacityFunctor} { _data.h = new Handle{scalar}; }
     inline Datum::Datum(InternalTablePointer scalar, GrowCapacityFunctorType growCapacityFunctor) : Datum{std::forward<InternalTablePointer>(scalar), nullptr, growCapacityFunctor} {}
     inline Datum::Datum(const Table& scalar, GrowCapacityFunctorType growCapacityFunctor) : Datum{std::make_unique<Table>(scalar), nullptr, growCapacityFunctor} {}
     inline Datum::Datum(Table&& scalar, GrowCapacityFunctorType growCapacityFunctor) : Datum{std::make_unique<Table>(std::forward<Table>(scalar)), nullptr, growCapacityFunctor} {}
@@ -266,6 +289,7 @@ namespace FieaGameEngine {
     inline Datum::Datum(std::initializer_list<Vector> list) : _type{DatumType::Vector} { InitializeFromList(list); }
     inline Datum::Datum(std::initializer_list<Matrix> list) : _type{DatumType::Matrix} { InitializeFromList(list); }
     inline Datum::Datum(std::initializer_list<Pointer> list) : _type{DatumType::Pointer} { InitializeFromList(list); }
+    inline Datum::Datum(std::initializer_list<Handle> list) : _type{DatumType::Handle} { InitializeFromList(list); }
 
     inline Datum& Datum::operator=(Integer scalar) { return AssignFromScalarCopy(DatumType::Integer, scalar); }
     inline Datum& Datum::operator=(Float scalar) { return AssignFromScalarCopy(DatumType::Float, scalar); }
@@ -275,6 +299,7 @@ namespace FieaGameEngine {
     inline Datum& Datum::operator=(Vector&& scalar) { return AssignFromScalarForward(DatumType::Vector, std::forward<Vector>(scalar)); }
     inline Datum& Datum::operator=(const Matrix& scalar) { return AssignFromScalarReference(DatumType::Matrix, scalar); }
     inline Datum& Datum::operator=(Matrix&& scalar) { return AssignFromScalarForward(DatumType::Matrix, std::forward<Matrix>(scalar)); }
+    inline Datum& Datum::operator=(Handle scalar) { return AssignFromScalarCopy(DatumType::Handle, scalar); }
 
     inline Datum& Datum::operator=(std::initializer_list<Integer> list) { return AssignFromList(DatumType::Integer, list); }
     inline Datum& Datum::operator=(std::initializer_list<Float> list) { return AssignFromList(DatumType::Float, list); }
@@ -282,12 +307,14 @@ namespace FieaGameEngine {
     inline Datum& Datum::operator=(std::initializer_list<Vector> list) { return AssignFromList(DatumType::Vector, list); }
     inline Datum& Datum::operator=(std::initializer_list<Matrix> list) { return AssignFromList(DatumType::Matrix, list); }
     inline Datum& Datum::operator=(std::initializer_list<Pointer> list) { return AssignFromList(DatumType::Pointer, list); }
+    inline Datum& Datum::operator=(std::initializer_list<Handle> list) { return AssignFromList(DatumType::Handle, list); }
 
     inline bool Datum::operator==(Integer other) const { return IsEqualToScalar(DatumType::Integer, other); }
     inline bool Datum::operator==(Float other) const { return IsEqualToScalar(DatumType::Float, other); }
     inline bool Datum::operator==(const String& other) const { return IsEqualToScalar(DatumType::String, other); }
     inline bool Datum::operator==(const Vector& other) const { return IsEqualToScalar(DatumType::Vector, other); }
     inline bool Datum::operator==(const Matrix& other) const { return IsEqualToScalar(DatumType::Matrix, other); }
+    inline bool Datum::operator==(const Handle& other) const { return IsEqualToScalar(DatumType::Handle, other); }
     inline bool Datum::operator!=(const Datum& other) const { return !operator==(other); }
     inline bool Datum::operator!=(Integer other) const { return !operator==(other); }
     inline bool Datum::operator!=(Float other) const { return !operator==(other); }
@@ -295,6 +322,7 @@ namespace FieaGameEngine {
     inline bool Datum::operator!=(const Vector& other) const { return !operator==(other); }
     inline bool Datum::operator!=(const Matrix& other) const { return !operator==(other); }
     inline bool Datum::operator!=(const Pointer other) const { return !operator==(other); }
+    inline bool Datum::operator!=(const Handle& other) const { return !operator==(other); }
     inline bool Datum::operator!=(const InternalTablePointer& other) const { return !operator==(other); }
     inline bool Datum::operator!=(const Table& other) const { return !operator==(other); }
 
@@ -302,6 +330,10 @@ namespace FieaGameEngine {
     inline const typename Datum::ExternalTablePointer Datum::Parent() const { return _parent; }
     inline bool Datum::IsDataInternal() const { return _isDataInternal; }
     inline bool Datum::IsDataExternalConst() const { assert(!(_isDataInternal && _isDataExternalConst)); return _isDataExternalConst; }
+    inline bool Datum::IsDataShared() const { return (_sharedStorage != nullptr) && (_sharedStorage->references > size_type(1)); }
+
+    inline Datum::SharingCopies::SharingCopies() : _wasSharingCopies{_isSharingCopies} { _isSharingCopies = true; }
+    inline Datum::SharingCopies::~SharingCopies() { _isSharingCopies = _wasSharingCopies; }
     inline bool Datum::IsEmpty() const { return _size == size_type(0); }
     inline const typename Datum::size_type& Datum::Size() const { return _size; }
     inline const typename Datum::size_type& Datum::Capacity() const { return _capacity; }
@@ -315,6 +347,7 @@ namespace FieaGameEngine {
     inline void Datum::SetStorage(Vector* array, size_type size, bool isConst) { SetStorage(DatumType::Vector, array, size, isConst); }
     inline void Datum::SetStorage(Matrix* array, size_type size, bool isConst) { SetStorage(DatumType::Matrix, array, size, isConst); }
     inline void Datum::SetPointerStorage(Pointer* array, size_type size, bool isConst) { SetStorage(DatumType::Pointer, array, size, isConst); }
+    inline void Datum::SetStorage(Handle* array, size_type size, bool isConst) { SetStorage(DatumType::Handle, array, size, isConst); }
     inline void Datum::SetTableStorage(ExternalTablePointer* array, size_type size, bool isConst) { SetStorage(DatumType::ExternalTable, array, size, isConst); }
 
     inline typename Datum::Integer& Datum::GetIntegerElement(size_type index) { return GetElementReference<Integer>(DatumType::Integer, index); }
@@ -323,6 +356,7 @@ namespace FieaGameEngine {
     inline typename Datum::Vector& Datum::GetVectorElement(size_type index) { return GetElementReference<Vector>(DatumType::Vector, index); }
     inline typename Datum::Matrix& Datum::GetMatrixElement(size_type index) { return GetElementReference<Matrix>(DatumType::Matrix, index); }
     inline typename Datum::Pointer& Datum::GetPointerElement(size_type index) { return GetElementReference<Pointer>(DatumType::Pointer, index); }
+    inline typename Datum::Handle& Datum::GetHandleElement(size_type index) { return GetElementReference<Handle>(DatumType::Handle, index); }
     inline typename Datum::Table& Datum::GetTableElement(size_type index) {
         assert(_type != DatumType::Table);
         return (_type == DatumType::InternalTable)
@@ -336,6 +370,7 @@ namespace FieaGameEngine {
     inline const typename Datum::Vector& Datum::GetVectorElement(size_type index) const { return CGetVectorElement(index); }
     inline const typename Datum::Matrix& Datum::GetMatrixElement(size_type index) const { return CGetMatrixElement(index); }
     inline const typename Datum::Pointer Datum::GetPointerElement(size_type index) const { return CGetPointerElement(index); }
+    inline const typename Datum::Handle& Datum::GetHandleElement(size_type index) const { return CGetHandleElement(index); }
     inline typename const Datum::Table& Datum::GetTableElement(size_type index) const { return CGetTableElement(index); }
 
     inline typename Datum::Integer Datum::CGetIntegerElement(size_type index) const { return CGetElementCopy<Integer>(DatumType::Integer, index); }
@@ -344,6 +379,7 @@ namespace FieaGameEngine {
     inline const typename Datum::Vector& Datum::CGetVectorElement(size_type index) const { return CGetElementReference<Vector>(DatumType::Vector, index); }
     inline const typename Datum::Matrix& Datum::CGetMatrixElement(size_type index) const { return CGetElementReference<Matrix>(DatumType::Matrix, index); }
     inline const typename Datum::Pointer Datum::CGetPointerElement(size_type index) const { return CGetElementCopy<Pointer>(DatumType::Pointer, index); }
+    inline const typename Datum::Handle& Datum::CGetHandleElement(size_type index) const { return CGetElementReference<Handle>(DatumType::Handle, index); }
     inline const typename Datum::Table& Datum::CGetTableElement(size_type index) const {
         assert(ActualType() != DatumType::Table);
         return (ActualType() == DatumType::InternalTable)
@@ -363,6 +399,7 @@ namespace FieaGameEngine {
     inline void Datum::SetElement(const Matrix& element, size_type index) { SetElementFromReference(DatumType::Matrix, element, index); }
     inline void Datum::SetElement(Matrix&& element, size_type index) { SetElementFromMove(DatumType::Matrix, std::forward<Matrix>(element), index); }
     inline void Datum::SetElement(Pointer element, size_type index) { SetElementFromCopy(DatumType::Pointer, element, index); }
+    inline void Datum::SetElement(const Handle& element, size_type index) { SetElementFromReference(DatumType::Handle, element, index); }
 
     inline void Datum::PushBack(Integer element) { PushBackCopy(DatumType::Integer, element); }
     inline void Datum::PushBack(Float element) { PushBackCopy(DatumType::Float, element); }
@@ -373,6 +410,7 @@ namespace FieaGameEngine {
     inline void Datum::PushBack(const Matrix& element) { EmplaceBackMatrix(element); }
     inline void Datum::PushBack(Matrix&& element) { EmplaceBackMatrix(std::forward<Matrix>(element)); }
     inline void Datum::PushBack(Pointer element) { PushBackCopy(DatumType::Pointer, element); }
+    inline void Datum::PushBack(const Handle& element) { PushBackCopy(DatumType::Handle, element); }
 
     inline typename Datum::Integer& Datum::FrontInteger() { return GetIntegerElement(size_type(0)); }
     inline typename Datum::Float& Datum::FrontFloat() { return GetFloatElement(size_type(0)); }
@@ -380,6 +418,7 @@ namespace FieaGameEngine {
     inline typename Datum::Vector& Datum::FrontVector() { return GetVectorElement(size_type(0)); }
     inline typename Datum::Matrix& Datum::FrontMatrix() { return GetMatrixElement(size_type(0)); }
     inline typename Datum::Pointer& Datum::FrontPointer() { return GetPointerElement(size_type(0)); }
+    inline typename Datum::Handle& Datum::FrontHandle() { return GetHandleElement(size_type(0)); }
     inline typename Datum::Table& Datum::FrontTable() { return GetTableElement(size_type(0)); }
     inline typename Datum::Integer Datum::FrontInteger() const { return CFrontInteger(); }
     inline typename Datum::Float Datum::FrontFloat() const { return CFrontFloat(); }
@@ -387,6 +426,7 @@ namespace FieaGameEngine {
     inline const typename Datum::Vector& Datum::FrontVector() const { return CFrontVector(); }
     inline const typename Datum::Matrix& Datum::FrontMatrix() const { return CFrontMatrix(); }
     inline typename Datum::Pointer Datum::FrontPointer() const { return CFrontPointer(); }
+    inline const typename Datum::Handle& Datum::FrontHandle() const { return CFrontHandle(); }
     inline const typename Datum::Table& Datum::FrontTable() const { return CFrontTable(); }
     inline typename Datum::Integer Datum::CFrontInteger() const { return CGetIntegerElement(size_type(0)); }
     inline typename Datum::Float Datum::CFrontFloat() const { return CGetFloatElement(size_type(0)); }
@@ -394,6 +434,7 @@ namespace FieaGameEngine {
     inline const typename Datum::Vector& Datum::CFrontVector() const { return CGetVectorElement(size_type(0)); }
     inline const typename Datum::Matrix& Datum::CFrontMatrix() const { return CGetMatrixElement(size_type(0)); }
     inline typename Datum::Pointer Datum::CFrontPointer() const { return CGetPointerElement(size_type(0)); }
+    inline const typename Datum::Handle& Datum::CFrontHandle() const { return CGetHandleElement(size_type(0)); }
     inline const typename Datum::Table& Datum::CFrontTable() const { return CGetTableElement(size_type(0)); }
     inline typename Datum::Integer& Datum::BackInteger() { return GetIntegerElement(_size - size_type(1)); }
     inline typename Datum::Float& Datum::BackFloat() { return GetFloatElement(_size - size_type(1)); }
@@ -401,6 +442,7 @@ namespace FieaGameEngine {
     inline typename Datum::Vector& Datum::BackVector() { return GetVectorElement(_size - size_type(1)); }
     inline typename Datum::Matrix& Datum::BackMatrix() { return GetMatrixElement(_size - size_type(1)); }
     inline typename Datum::Pointer& Datum::BackPointer() { return GetPointerElement(_size - size_type(1)); }
+    inline typename Datum::Handle& Datum::BackHandle() { return GetHandleElement(_size - size_type(1)); }
     inline typename Datum::Table& Datum::BackTable() { return GetTableElement(_size - size_type(1)); }
     inline typename Datum::Integer Datum::BackInteger() const { return CBackInteger(); }
     inline typename Datum::Float Datum::BackFloat() const { return CBackFloat(); }
@@ -408,6 +450,7 @@ namespace FieaGameEngine {
     inline const typename Datum::Vector& Datum::BackVector() const { return CBackVector(); }
     inline const typename Datum::Matrix& Datum::BackMatrix() const { return CBackMatrix(); }
     inline typename Datum::Pointer Datum::BackPointer() const { return CBackPointer(); }
+    inline const typename Datum::Handle& Datum::BackHandle() const { return CBackHandle(); }
     inline const typename Datum::Table& Datum::BackTable() const { return CBackTable(); }
     inline typename Datum::Integer Datum::CBackInteger() const { return CGetIntegerElement(_size - size_type(1)); }
     inline typename Datum::Float Datum::CBackFloat() const { return CGetFloatElement(_size - size_type(1)); }
@@ -415,6 +458,7 @@ namespace FieaGameEngine {
     inline const typename Datum::Vector& Datum::CBackVector() const { return CGetVectorElement(_size - size_type(1)); }
     inline const typename Datum::Matrix& Datum::CBackMatrix() const { return CGetMatrixElement(_size - size_type(1)); }
     inline typename Datum::Pointer Datum::CBackPointer() const { return CGetPointerElement(_size - size_type(1)); }
+    inline const typename Datum::Handle& Datum::CBackHandle() const { return CGetHandleElement(_size - size_type(1)); }
     inline const typename Datum::Table& Datum::CBackTable() const { return CGetTableElement(_size - size_type(1)); }
 
     inline bool Datum::Find(Integer element, size_type& index) const { return Find(DatumType::Integer, element, index); }
@@ -422,6 +466,7 @@ namespace FieaGameEngine {
     inline bool Datum::Find(const String& element, size_type& index) const { return Find(DatumType::String, element, index); }
     inline bool Datum::Find(const Vector& element, size_type& index) const { return Find(DatumType::Vector, element, index); }
     inline bool Datum::Find(const Matrix& element, size_type& index) const { return Find(DatumType::Matrix, element, index); }
+    inline bool Datum::Find(const Handle& element, size_type& index) const { return Find(DatumType::Handle, element, index); }
 
     inline bool Datum::IsContaining(Integer element) const { size_type _; return Find(element, _); }
     inline bool Datum::IsContaining(Float element) const { size_type _; return Find(element, _); }
@@ -429,6 +474,7 @@ namespace FieaGameEngine {
     inline bool Datum::IsContaining(const Vector& element) const { size_type _; return Find(element, _); }
     inline bool Datum::IsContaining(const Matrix& element) const { size_type _; return Find(element, _); }
     inline bool Datum::IsContaining(Pointer element) const { size_type _; return Find(element, _); }
+    inline bool Datum::IsContaining(const Handle& element) const { size_type _; return Find(element, _); }
 
     inline bool Datum::Remove(Integer element) { size_type index; Find(element, index); return RemoveAt(index); }
     inline bool Datum::Remove(Float element) { size_type index; Find(element, index); return RemoveAt(index); }
@@ -436,6 +482,7 @@ namespace FieaGameEngine {
     inline bool Datum::Remove(const Vector& element) { size_type index; Find(element, index); return RemoveAt(index); }
     inline bool Datum::Remove(const Matrix& element) { size_type index; Find(element, index); return RemoveAt(index); }
     inline bool Datum::Remove(Pointer element) { size_type index; Find(element, index); return RemoveAt(index); }
+    inline bool Datum::Remove(const Handle& element) { size_type index; Find(element, index); return RemoveAt(index); }
 
     inline typename Datum::String Datum::ToString(size_type index) const { return ElementToString(index); }
 
@@ -0,0 +1,133 @@
+#include "pch.h"
+#include "ExpressionLexer.h"
+#include <charconv>
+#include "Scope.h"
+
+using namespace std::literals::string_literals;
+
+namespace FieaGameEngine {
+    namespace {
+        /// <returns>Is the given character whitespace, as it separates tokens?</returns>
+        bool IsSpace(char c) {
+            return std::isspace(static_cast<unsigned char>(c)) != 0;
+        }
+
+        /// <returns>Opening of the literal written by the given string format, such as "vector&lt;".</returns>
+        std::string_view LiteralOpening(const std::string& format, const std::string& prefix) {
+            return std::string_view{format}.substr(0, prefix.size() + 1);
+        }
+    }
+
+    ExpressionLexer::ExpressionLexer(std::string_view input, std::initializer_list<std::string_view> delimiters) : _input{input} {
+        for (const auto& delimiter : delimiters) {
+            if (delimiter.empty()) {
+                continue;
+            }
+
+            if (_delimiterCount == MAX_DELIMITERS) {
+                throw std::invalid_argument("Cannot tokenize with more than "s + std::to_string(MAX_DELIMITERS) + " delimiters!"s);
+            }
+
+            _delimiters[_delimiterCount++] = delimiter;
+        }
+    }
+
+    bool ExpressionLexer::Next(Token& token) {
+        while ((_position < _input.size()) && IsSpace(_input[_position])) {
+            ++_position;
+        }
+
+        if (_position == _input.size()) {
+            return false;
+        }
+
+        const std::size_t begin = _position;
+
+        if (const auto delimiterSize = DelimiterSizeAt(begin); delimiterSize > std::size_t(0)) {
+            _position += delimiterSize;
+            token = Token{_input.substr(begin, delimiterSize), TokenType::Delimiter};
+            return true;
+        }
+
+        if (const auto end = LiteralEndAt(LiteralOpening(Datum::VECTOR_STRING_FORMAT, Datum::VECTOR_STRING_FORMAT_PREFIX), Datum::VECTOR_STRING_FORMAT.back()); end > std::size_t(0)) {
+            _position = end;
+            token = Token{_input.substr(begin, end - begin), TokenType::Vector};
+            return true;
+        }
+
+        if (const auto end = LiteralEndAt(LiteralOpening(Datum::MATRIX_STRING_FORMAT, Datum::MATRIX_STRING_FORMAT_PREFIX), Datum::MATRIX_STRING_FORMAT.back()); end > std::size_t(0)) {
+            _position = end;
+            token = Token{_input.substr(begin, end - begin), TokenType::Matrix};
+            return true;
+        }
+
+        while ((_position < _input.size()) && !IsSpace(_input[_position]) && (DelimiterSizeAt(_position) == std::size_t(0))) {
+            ++_position;
+        }
+
+        const std::string_view text = _input.substr(begin, _position - begin);
+        token = Token{text, IsInteger(text) ? TokenType::Integer : (IsFloat(text) ? TokenType::Float : TokenType::Word)};
+        return true;
+    }
+
+    bool ExpressionLexer::NextPathStep(std::string_view& path, std::string_view& name, std::size_t& index) {
+        const auto dot = path.find('.');
+
+        if ((dot == std::string_view::npos) || (dot == std::size_t(0)) || ((dot + 1) == path.size())) {
+            return false;
+        }
+
+        std::string_view segment = path.substr(0, dot);
+        path.remove_prefix(dot + 1);
+        index = std::size_t(0);
+
+        const auto open = segment.rfind('[');
+
+        if ((open != std::string_view::npos) && (open > std::size_t(0)) && (segment.back() == ']')) {
+            const std::string_view digits = segment.substr(open + 1, segment.size() - open - 2);
+
+            if (IsInteger(digits)) {
+                if (std::from_chars(digits.data(), digits.data() + digits.size(), index).ec != std::errc{}) {
+                    throw std::out_of_range("Index of "s + std::string{segment} + " is out of range!"s);
+                }
+
+                segment = segment.substr(0, open);
+            }
+        }
+
+        name = segment;
+        return true;
+    }
+
+    std::size_t ExpressionLexer::DelimiterSizeAt(std::size_t position) const {
+        const std::string_view rest = _input.substr(position);
+
+        for (auto i = std::size_t(0); i < _delimiterCount; ++i) {
+            if (rest.substr(0, _delimiters[i].size()) == _delimiters[i]) {
+                return _delimiters[i].size();
+            }
+        }
+
+        return std::size_t(0);
+    }
+
+    std::size_t ExpressionLexer::LiteralEndAt(std::string_view opening, char closing) const {
+        if (_input.substr(_position, opening.size()) != opening) {
+            return std::size_t(0);
+        }
+
+        // Literals never contain whitespace, so one missing its closing cannot swallow the tokens after it.
+        for (auto position = _position + opening.size(); (position < _input.size()) && !IsSpace(_input[position]); ++position) {
+            if (_input[position] == closing) {
+                return position + 1;
+            }
+        }
+
+        std::size_t end = _position;
+        while ((end < _input.size()) && !IsSpace(_input[end])) {
+            ++end;
+        }
+
+        throw std::invalid_argument("Literal "s + std::string{_input.substr(_position, end - _position)} + " is missing its closing "s + closing + "!"s);
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <array>
+#include <initializer_list>
+#include <string_view>
+
+namespace FieaGameEngine {
+    /// <summary>
+    /// Splits an expression into whitespace separated tokens in a single pass, without allocating.
+    /// Tokens are views into the input, so the input must outlive them.
+    /// Delimiters, such as parentheses, become tokens of their own even when they are not surrounded by whitespace.
+    /// </summary>
+    class ExpressionLexer final {
+
+    public:
+        enum class TokenType : uint8_t {
+            Word,
+            Integer,
+            Float,
+            Vector,
+            Matrix,
+            Delimiter
+        };
+
+        struct Token final {
+            std::string_view text;
+            TokenType type;
+        };
+
+        static constexpr std::size_t MAX_DELIMITERS = std::size_t(4);
+
+        /// <summary>
+        /// Constructor. Throws an exception if given more than MAX_DELIMITERS delimiters. Empty delimiters are ignored.
+        /// </summary>
+        /// <param name="input">Expression to tokenize, which is not copied.</param>
+        /// <param name="delimiters">Strings split into tokens of their own, checked in order. They are not copied either.</param>
+        explicit ExpressionLexer(std::string_view input, std::initializer_list<std::string_view> delimiters = {});
+
+        /// <summary>
+        /// Reads the next token. Vector and matrix literals are read whole, up to their closing bracket, even if they contain delimiters.
+        /// Throws an exception if a literal is opened but not closed before the next whitespace.
+        /// </summary>
+        /// <returns>Was a token read? If so, it is assigned to the output parameter. False once the input is exhausted.</returns>
+        [[nodiscard]] bool Next(Token& token);
+
+        /// <returns>Is the text made only of decimal digits?</returns>
+        [[nodiscard]] static bool IsInteger(std::string_view text);
+
+        /// <returns>Is the text decimal digits, a point, then decimal digits?</returns>
+        [[nodiscard]] static bool IsFloat(std::string_view text);
+
+        /// <summary>
+        /// Splits the first scope off a dotted path, such as "Outer[1].Inner.Key". Scopes may be indexed as "name[index]", otherwise their index is 0.
+        /// Throws an exception if an index does not fit.
+        /// </summary>
+        /// <returns>Was a scope split off? If so, its name and index are assigned to the output parameters and the path is advanced past it. If not, the path is the final key.</returns>
+        [[nodiscard]] static bool NextPathStep(std::string_view& path, std::string_view& name, std::size_t& index);
+
+    private:
+        std::string_view _input;
+        std::size_t _position{0};
+        std::array<std::string_view, MAX_DELIMITERS> _delimiters{};
+        std::size_t _delimiterCount{0};
+
+        /// <returns>Size of the delimiter starting at the given position, or 0 if there is none.</returns>
+        [[nodiscard]] std::size_t DelimiterSizeAt(std::size_t position) const;
+
+        /// <returns>Position just past the literal starting at the current position, or 0 if no literal with the given opening starts there.
+        /// Throws an exception if the literal is not closed before the next whitespace.</returns>
+        [[nodiscard]] std::size_t LiteralEndAt(std::string_view opening, char closing) const;
+
+    };
+}
+
+#include "ExpressionLexer.inl"
@@ -0,0 +1,15 @@
+#pragma once
+#include "ExpressionLexer.h"
+#include <algorithm>
+#include <cctype>
+
+namespace FieaGameEngine {
+    inline bool ExpressionLexer::IsInteger(std::string_view text) {
+        return !text.empty() && std::all_of(text.begin(), text.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; });
+    }
+
+    inline bool ExpressionLexer::IsFloat(std::string_view text) {
+        const auto point = text.find('.');
+        return (point != std::string_view::npos) && IsInteger(text.substr(0, point)) && IsInteger(text.substr(point + 1));
+    }
+}
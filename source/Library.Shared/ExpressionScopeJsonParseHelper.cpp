@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ExpressionScopeJsonParseHelper.h"
+#include "ActionExpression.h"
 #include <regex>
 
 using namespace std::literals::string_literals;
@@ -64,6 +65,11 @@ namespace FieaGameEngine::ScopeJsonParse {
                 appended.PushBack(scopeWrapper->GetShuntingYardParser().Parse(extractedExpression));
             }
 
+            // Typed now that the action is attached to its parent, so type errors surface while loading.
+            if (auto* action = frame->_scope->As<Actions::ActionExpression>(); !!action) {
+                action->Compile();
+            }
+
             return true;
         }
 
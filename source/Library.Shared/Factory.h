@@ -1,7 +1,10 @@
 #pragma once
+#include <limits>
 #include <memory>
 #include <string>
 #include "HashMap.h"
+#include "Vector.h"
+#include "ObjectPool.h"
 
 namespace FieaGameEngine {
     /// <summary>
@@ -11,6 +14,19 @@ namespace FieaGameEngine {
     class Factory {
 
     public:
+        /// <summary>
+        /// Id of a registered class, assigned when its factory is added. Ids stay valid until the factory is removed, and are
+        /// never reissued: an id kept after its factory is removed finds nothing, even once another factory reuses its entry.
+        /// </summary>
+        enum class ClassId : std::size_t {};
+
+        /// <summary>
+        /// Function which creates a heap-allocated instance of a class without going through its factory.
+        /// </summary>
+        using Constructor = std::unique_ptr<T>(*)();
+
+        static constexpr ClassId INVALID_CLASS_ID = ClassId(std::numeric_limits<std::size_t>::max());
+
         virtual ~Factory() = default;
 
         /// <returns>The name of the class this factory creates instances of.</returns>
@@ -19,6 +35,12 @@ namespace FieaGameEngine {
         /// <returns>A heap-allocated instance of T.</returns>
         [[nodiscard]] virtual std::unique_ptr<T> Create() const = 0;
 
+        /// <summary>
+        /// Creates the given number of instances and appends them to the output vector.
+        /// Factories defined with the FACTORY macro construct them contiguously through ObjectPool; otherwise they are created one at a time.
+        /// </summary>
+        virtual void CreateMany(std::size_t count, Vector<std::unique_ptr<T>>& created) const;
+
         /// <summary>
         /// Finds a factory associated with this base class which creates instances of the class that has the given name.
         /// </summary>
@@ -32,17 +54,39 @@ namespace FieaGameEngine {
         /// <returns>True if the factory was found, false otherwise.</returns>
         [[nodiscard]] static bool TryFind(const std::string& createdClassName, Factory*& found);
 
+        /// <returns>nullptr if no factory is registered with the given id, otherwise a pointer to the appropriate factory.</returns>
+        [[nodiscard]] static Factory* Find(ClassId createdClassId);
+
+        /// <summary>
+        /// Resolves the name of a class to its id, so that repeated creation can skip the name lookup.
+        /// </summary>
+        /// <returns>INVALID_CLASS_ID if no such factory exists, otherwise the id of the class.</returns>
+        [[nodiscard]] static ClassId FindClassId(const std::string& createdClassName);
+
         /// <summary>
         /// Finds the appropriate factory, then creates a heap-allocated instance of the class.
         /// </summary>
         /// <returns>An empty pointer if no such factory is associated with this base class, otherwise a heap-allocated instance of T.</returns>
         [[nodiscard]] static std::unique_ptr<T> StaticCreate(const std::string& nameOfClassToCreate);
 
+        /// <summary>
+        /// Creates a heap-allocated instance of the class with the given id, through its constructor table entry.
+        /// </summary>
+        /// <returns>An empty pointer if no factory is registered with the given id, otherwise a heap-allocated instance of T.</returns>
+        [[nodiscard]] static std::unique_ptr<T> StaticCreate(ClassId idOfClassToCreate);
+
+        /// <summary>
+        /// Finds the factory with the given id, then creates the given number of instances and appends them to the output vector.
+        /// </summary>
+        /// <returns>False if no factory is registered with the given id, in which case nothing is created.</returns>
+        static bool StaticCreateMany(ClassId idOfClassToCreate, std::size_t count, Vector<std::unique_ptr<T>>& created);
+
     protected:
         /// <summary>
         /// Associates the given factory to this base class. After adding, the factory can be retrieved publicly using `Find` and `TryFind`, or used indirectly through `StaticCreate`.
+        /// If a constructor is given, creation by id calls it directly rather than calling the factory's `Create`.
         /// </summary>
-        static void Add(std::unique_ptr<Factory>);
+        static void Add(std::unique_ptr<Factory>, Constructor constructor = nullptr);
 
         /// <summary>
         /// Removes the association from this factory.
@@ -50,23 +94,71 @@ namespace FieaGameEngine {
         static void Remove(const std::string& factoryCreatedClassName);
 
     private:
-        inline static HashMap<std::string, std::unique_ptr<Factory>> _factories{};
+        /// <summary>
+        /// Number of classes the tables hold before growing.
+        /// </summary>
+        static constexpr std::size_t DEFAULT_CLASS_CAPACITY = 64;
+
+        /// <summary>
+        /// Class ids hold the index of their entry in the low bits, and the generation of the entry in the high bits.
+        /// </summary>
+        static constexpr std::size_t INDEX_BITS = std::numeric_limits<std::size_t>::digits / 2;
+        static constexpr std::size_t INDEX_MASK = (std::size_t(1) << INDEX_BITS) - 1;
+        static constexpr std::size_t NO_INDEX = std::numeric_limits<std::size_t>::max();
+
+        inline static HashMap<std::string, ClassId> _classIds{};
+
+        /// <summary>
+        /// Factories, indexed by entry. Removed factories leave an empty entry, which is reused by the next factory added.
+        /// </summary>
+        inline static Vector<std::unique_ptr<Factory>> _factories{DEFAULT_CLASS_CAPACITY};
+
+        /// <summary>
+        /// Constructors, indexed by entry, or nullptr when the factory has no constructor.
+        /// </summary>
+        inline static Vector<Constructor> _constructors{DEFAULT_CLASS_CAPACITY};
+
+        /// <summary>
+        /// Generation of each entry, advanced whenever its factory is removed so that ids issued before no longer match.
+        /// </summary>
+        inline static Vector<std::size_t> _generations = Vector<std::size_t>(DEFAULT_CLASS_CAPACITY);
+
+        /// <summary>
+        /// Empty entries, reused before the tables grow.
+        /// </summary>
+        inline static Vector<std::size_t> _freeEntries = Vector<std::size_t>(DEFAULT_CLASS_CAPACITY);
+
+        /// <returns>Index of the entry the given id was issued for, or NO_INDEX if the id is invalid or stale.</returns>
+        [[nodiscard]] static std::size_t EntryOf(ClassId classId);
 
     };
 }
 
-#define FACTORY(ConcreteCreatedClass, AbstractCreatedClass, ...)                                                                                    \
-    class ConcreteCreatedClass ## Factory final : public FieaGameEngine::Factory<AbstractCreatedClass> {                                            \
-    public:                                                                                                                                         \
-        inline static void Register() { FieaGameEngine::Factory<AbstractCreatedClass>::Add(std::make_unique<ConcreteCreatedClass ## Factory>()); }  \
-        inline static void Unregister() { FieaGameEngine::Factory<AbstractCreatedClass>::Remove(#ConcreteCreatedClass); }                           \
-        [[nodiscard]] inline std::string CreatedClassName() const override { return #ConcreteCreatedClass; }                                        \
-        [[nodiscard]] inline std::unique_ptr<AbstractCreatedClass> Create() const override {                                                        \
-            return Create##ConcreteCreatedClass(__VA_ARGS__);                                                                                       \
-        }                                                                                                                                           \
-        template <typename... Args> [[nodiscard]] inline std::unique_ptr<ConcreteCreatedClass> Create##ConcreteCreatedClass(Args&&... args) const { \
-            return std::make_unique<ConcreteCreatedClass>(std::forward<Args>(args)...);                                                             \
-        }                                                                                                                                           \
+#define FACTORY(ConcreteCreatedClass, AbstractCreatedClass, ...)                                                                                     \
+    class ConcreteCreatedClass ## Factory final : public FieaGameEngine::Factory<AbstractCreatedClass> {                                             \
+    public:                                                                                                                                          \
+        inline static void Register() {                                                                                                              \
+            FieaGameEngine::Factory<AbstractCreatedClass>::Add(std::make_unique<ConcreteCreatedClass ## Factory>(), &ConcreteCreatedClass ## Factory::Construct); \
+        }                                                                                                                                            \
+        inline static void Unregister() { FieaGameEngine::Factory<AbstractCreatedClass>::Remove(#ConcreteCreatedClass); }                            \
+        [[nodiscard]] inline std::string CreatedClassName() const override { return #ConcreteCreatedClass; }                                         \
+        [[nodiscard]] inline std::unique_ptr<AbstractCreatedClass> Create() const override {                                                         \
+            return Create##ConcreteCreatedClass(__VA_ARGS__);                                                                                        \
+        }                                                                                                                                            \
+        inline void CreateMany(std::size_t count, FieaGameEngine::Vector<std::unique_ptr<AbstractCreatedClass>>& created) const override {           \
+            FieaGameEngine::ObjectPool::CreateMany<ConcreteCreatedClass>(                                                                            \
+                count,                                                                                                                               \
+                created,                                                                                                                             \
+                [](void* place) { return new (place) ConcreteCreatedClass(__VA_ARGS__); },                                                           \
+                &ConcreteCreatedClass ## Factory::Construct                                                                                          \
+            );                                                                                                                                       \
+        }                                                                                                                                            \
+        template <typename... Args> [[nodiscard]] inline std::unique_ptr<ConcreteCreatedClass> Create##ConcreteCreatedClass(Args&&... args) const {  \
+            return std::make_unique<ConcreteCreatedClass>(std::forward<Args>(args)...);                                                              \
+        }                                                                                                                                            \
+        [[nodiscard]] inline static std::unique_ptr<AbstractCreatedClass> Construct() {                                                              \
+            return std::make_unique<ConcreteCreatedClass>(__VA_ARGS__);                                                                              \
+        }                                                                                                                                            \
     }
 
 #include "Factory.inl"
@@ -3,8 +3,7 @@
 
 namespace FieaGameEngine {
     template <typename T> inline Factory<T>* Factory<T>::Find(const std::string& createdClassName) {
-        auto found = _factories.Find(createdClassName);
-        return (found == _factories.end()) ? nullptr : found->second.get();
+        return Find(FindClassId(createdClassName));
     }
 
     template <typename T> inline bool Factory<T>::TryFind(const std::string& createdClassName, Factory*& found) {
@@ -12,19 +11,101 @@ namespace FieaGameEngine {
         return found != nullptr;
     }
 
+    template <typename T> inline std::size_t Factory<T>::EntryOf(ClassId classId) {
+        const auto index = static_cast<std::size_t>(classId) & INDEX_MASK;
+        const auto generation = static_cast<std::size_t>(classId) >> INDEX_BITS;
+        return ((index < _generations.Size()) && (_generations[index] == generation)) ? index : NO_INDEX;
+    }
+
+    template <typename T> inline Factory<T>* Factory<T>::Find(ClassId createdClassId) {
+        const auto index = EntryOf(createdClassId);
+        return (index == NO_INDEX) ? nullptr : _factories[index].get();
+    }
+
+    template <typename T> inline typename Factory<T>::ClassId Factory<T>::FindClassId(const std::string& createdClassName) {
+        auto found = _classIds.Find(createdClassName);
+        return (found == _classIds.end()) ? INVALID_CLASS_ID : found->second;
+    }
+
     template <typename T> inline std::unique_ptr<T> Factory<T>::StaticCreate(const std::string& nameOfClassToCreate) {
-        Factory* factory = Find(nameOfClassToCreate);
+        return StaticCreate(FindClassId(nameOfClassToCreate));
+    }
+
+    template <typename T> inline std::unique_ptr<T> Factory<T>::StaticCreate(ClassId idOfClassToCreate) {
+        const auto index = EntryOf(idOfClassToCreate);
+
+        if (index == NO_INDEX) {
+            return std::unique_ptr<T>{};
+        }
+
+        if (Constructor constructor = _constructors[index]; constructor != nullptr) {
+            return constructor();
+        }
+
+        Factory* factory = _factories[index].get();
         return (factory == nullptr) ? std::unique_ptr<T>{} : factory->Create();
     }
 
-    template <typename T> inline void Factory<T>::Add(std::unique_ptr<Factory> factory) {
+    template <typename T> inline void Factory<T>::CreateMany(std::size_t count, Vector<std::unique_ptr<T>>& created) const {
+        created.Reserve(created.Size() + count);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            created.PushBack(Create());
+        }
+    }
+
+    template <typename T> inline bool Factory<T>::StaticCreateMany(ClassId idOfClassToCreate, std::size_t count, Vector<std::unique_ptr<T>>& created) {
+        Factory* factory = Find(idOfClassToCreate);
+
+        if (factory == nullptr) {
+            return false;
+        }
+
+        factory->CreateMany(count, created);
+        return true;
+    }
+
+    template <typename T> inline void Factory<T>::Add(std::unique_ptr<Factory> factory, Constructor constructor) {
         if (factory) {
             std::string createdClassName = factory->CreatedClassName();
-            _factories.Insert(std::make_pair(createdClassName, std::move(factory)));
+
+            if (_classIds.Find(createdClassName) != _classIds.end()) {
+                return;
+            }
+
+            std::size_t index;
+
+            if (_freeEntries.IsEmpty()) {
+                index = _factories.Size();
+                _factories.PushBack(std::move(factory));
+                _constructors.PushBack(constructor);
+                _generations.PushBack(std::size_t(0));
+            } else {
+                index = _freeEntries.Back();
+                _freeEntries.PopBack();
+                _factories[index] = std::move(factory);
+                _constructors[index] = constructor;
+            }
+
+            _classIds.Insert(std::make_pair(std::move(createdClassName), ClassId((_generations[index] << INDEX_BITS) | index)));
         }
     }
 
     template <typename T> inline void Factory<T>::Remove(const std::string& factoryCreatedClassName) {
-        _factories.Remove(factoryCreatedClassName);
+        auto found = _classIds.Find(factoryCreatedClassName);
+
+        if (found == _classIds.end()) {
+            return;
+        }
+
+        const auto index = EntryOf(found->second);
+        _classIds.Remove(factoryCreatedClassName);
+        _factories[index].reset();
+        _constructors[index] = nullptr;
+
+        // Entries are reused rather than released, so the tables only grow with the number of classes registered at once.
+        // Advancing the generation keeps ids issued for the removed factory from matching whichever factory reuses the entry.
+        _generations[index] = (_generations[index] + 1) & INDEX_MASK;
+        _freeEntries.PushBack(index);
     }
 }
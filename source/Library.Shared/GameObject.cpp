@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "GameObject.h"
 #include <sstream>
+#include "ActionProfiler.h"
 
 using namespace std::literals::string_literals;
 
@@ -56,21 +57,49 @@ namespace FieaGameEngine {
     }
 
     void GameObject::UpdateChildren(const GameTime& gameTime) {
-        auto& children = Children();
-        for (auto i = size_type(0); i < children.Size(); ++i) {
-            ChildRef(i).Update(gameTime);
+        // Updates the whole hierarchy depth first from an explicit stack, holding the index of the next child at each depth
+        // so that children added or removed during an update are handled as they were when updating recursively.
+        struct Frame final {
+            GameObject* object;
+            size_type nextChild;
+        };
+
+        Vector<Frame> frames{};
+        frames.EmplaceBack(Frame{this, size_type(0)});
+
+        while (!frames.IsEmpty()) {
+            GameObject& object = *(frames.Back().object);
+            const size_type index = frames.Back().nextChild;
+
+            if (index < object.Children().Size()) {
+                ++(frames.Back().nextChild);
+
+                GameObject& child = object.ChildRef(index);
+                child.UpdateSelf(gameTime);
+                child.UpdateActions(gameTime);
+                frames.EmplaceBack(Frame{&child, size_type(0)});
+            } else {
+                frames.PopBack();
+            }
         }
     }
 
     void GameObject::UpdateActions(const GameTime& gameTime) {
         auto& actions = Actions();
+
         for (auto i = size_type(0); i < actions.Size(); ++i) {
-            ActionRef(i).Update(gameTime);
+            Action& action = ActionRef(i);
+            ActionProfiler::Sample sample{action};
+            action.Update(gameTime);
         }
     }
 
     GameObject& GameObject::CreateChild(const String& classname, const String& instname) {
-        auto child = Factory<Scope>::StaticCreate(classname);
+        return CreateChild(Factory<Scope>::FindClassId(classname), instname);
+    }
+
+    GameObject& GameObject::CreateChild(Factory<Scope>::ClassId classId, const String& instname) {
+        auto child = Factory<Scope>::StaticCreate(classId);
 
         if (!(child->Is(GameObject::TypeIdClass()))) {
             throw std::invalid_argument("Cannot create non-GameObject child of GameObject!"s);
@@ -82,7 +111,11 @@ namespace FieaGameEngine {
     }
 
     Action& GameObject::CreateAction(const String& classname, const String& instname) {
-        auto action = Factory<Scope>::StaticCreate(classname);
+        return CreateAction(Factory<Scope>::FindClassId(classname), instname);
+    }
+
+    Action& GameObject::CreateAction(Factory<Scope>::ClassId classId, const String& instname) {
+        auto action = Factory<Scope>::StaticCreate(classId);
 
         if (!(action->Is(Action::TypeIdClass()))) {
             throw std::invalid_argument("Cannot create non-Action action of GameObject!");
@@ -32,7 +32,9 @@ namespace FieaGameEngine {
 
         GameObject& CreateChild(const String& instname);
         GameObject& CreateChild(const String& classname, const String& instname);
+        GameObject& CreateChild(Factory<Scope>::ClassId classId, const String& instname);
         Action& CreateAction(const String& classname, const String& instname);
+        Action& CreateAction(Factory<Scope>::ClassId classId, const String& instname);
         void LocalTranslate(const Transform::vec4& translation);
 
         virtual void UpdateSelf(const GameTime& gameTime);
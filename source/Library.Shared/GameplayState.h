@@ -1,4 +1,6 @@
 #pragma once
+#include "ActionProfiler.h"
+#include "AttributedReactionIndex.h"
 #include "EventQueue.h"
 #include "GameClock.h"
 #include "GameTime.h"
@@ -15,6 +17,7 @@ namespace FieaGameEngine {
         static bool CreateSingleton();
         static bool DestroySingleton();
         static GameplayState& Singleton();
+        [[nodiscard]] static bool HasSingleton();
 
         GameplayState(const GameplayState&) = delete;
         GameplayState(GameplayState&&) noexcept = delete;
@@ -32,6 +35,8 @@ namespace FieaGameEngine {
         [[nodiscard]] const GameTime& GetTime() const;
 
         const ReversePolishEvaluator& RpnEvaluator() const;
+        ActionProfiler& Profiler();
+        AttributedReactionIndex& ReactionIndex();
 
     private:
         static std::unique_ptr<GameplayState> _singleton;
@@ -43,6 +48,8 @@ namespace FieaGameEngine {
         GameClock _clock{};
         GameTime _time{};
         ReversePolishEvaluator _rpnEval{};
+        ActionProfiler _profiler{};
+        AttributedReactionIndex _reactionIndex{};
 
     };
 }
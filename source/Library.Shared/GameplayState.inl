@@ -3,6 +3,7 @@
 
 namespace FieaGameEngine {
     inline bool GameplayState::DestroySingleton() { bool isDestroyed = !!_singleton; _singleton.reset(); return isDestroyed; }
+    inline bool GameplayState::HasSingleton() { return !!_singleton; }
 
     inline GameplayState::GameplayState() { _clock.UpdateGameTime(_time); }
 
@@ -15,4 +16,6 @@ namespace FieaGameEngine {
     inline const GameTime& GameplayState::ResetTime() { _clock.Reset(); _clock.UpdateGameTime(_time); return _time; }
 
     inline const ReversePolishEvaluator& GameplayState::RpnEvaluator() const { return _rpnEval; }
+    inline ActionProfiler& GameplayState::Profiler() { return _profiler; }
+    inline AttributedReactionIndex& GameplayState::ReactionIndex() { return _reactionIndex; }
 }
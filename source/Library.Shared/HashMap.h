@@ -192,6 +192,11 @@ namespace FieaGameEngine {
         /// <param name="hash"> - reference parameter used to pass along the hash calculated in this method.</param>
         [[nodiscard]] const_iterator CFind(const key_type& key, size_type& hash) const;
 
+        /// <summary>
+        /// Finds an element with the given key within the indicated chain, or returns `end()` if no such element exists.
+        /// </summary>
+        [[nodiscard]] iterator FindInChain(const key_type& key, size_type chainIndex);
+
     public:
         /// <summary>
         /// Constructor allowing easy setting of the emplace default functor.
@@ -265,6 +270,18 @@ namespace FieaGameEngine {
         /// </summary>
         iterator Insert(rvalue_reference);
 
+        /// <summary>
+        /// Inserts the pair into the map using a hash code previously returned by `HashCode`, skipping the hash function.
+        /// If an element with the given key already exists, does nothing.
+        /// </summary>
+        iterator InsertWithHashCode(const_reference, size_type hashCode);
+
+        /// <summary>
+        /// Inserts the pair into the map using a hash code previously returned by `HashCode`, skipping the hash function.
+        /// If an element with the given key already exists, does nothing.
+        /// </summary>
+        iterator InsertWithHashCode(rvalue_reference, size_type hashCode);
+
         /// <summary>
         /// Inserts the pair into the map. If an element with the given key already exists, the previous value will be overriden.
         /// </summary>
@@ -384,6 +401,22 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] const_iterator CFind(const key_type&) const;
 
+        /// <summary>
+        /// Finds the given element using a hash code previously returned by `HashCode`, skipping the hash function.
+        /// </summary>
+        [[nodiscard]] iterator FindWithHashCode(const key_type&, size_type hashCode);
+
+        /// <summary>
+        /// Finds the given element using a hash code previously returned by `HashCode`, skipping the hash function.
+        /// </summary>
+        [[nodiscard]] const_iterator CFindWithHashCode(const key_type&, size_type hashCode) const;
+
+        /// <summary>
+        /// Hashes the key without reducing it to a chain index. The result does not depend on the map's max hash value,
+        /// so it can be computed once and cached for use with `FindWithHashCode` and `InsertWithHashCode`.
+        /// </summary>
+        [[nodiscard]] size_type HashCode(const key_type&) const;
+
         /// <summary>
         /// Creates a nonconst forward iterator at the beginning of this hash map. Order of elements is not guaranteed
         /// and should effectively be considered random. This operation is worst-case O(n). (linear-time)
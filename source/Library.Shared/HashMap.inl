@@ -249,6 +249,20 @@ namespace FieaGameEngine {
         return (found == end()) ? PushBack(hash, std::move(pair)) : found;
     }
 
+    template <typename TKey, typename TData>
+    inline typename HashMap<TKey, TData>::iterator HashMap<TKey, TData>::InsertWithHashCode(const_reference pair, size_type hashCode) {
+        auto chainIndex = hashCode % MaxHashValue();
+        auto found = FindInChain(pair.first, chainIndex);
+        return (found == end()) ? PushBack(chainIndex, pair) : found;
+    }
+
+    template <typename TKey, typename TData>
+    inline typename HashMap<TKey, TData>::iterator HashMap<TKey, TData>::InsertWithHashCode(rvalue_reference pair, size_type hashCode) {
+        auto chainIndex = hashCode % MaxHashValue();
+        auto found = FindInChain(pair.first, chainIndex);
+        return (found == end()) ? PushBack(chainIndex, std::move(pair)) : found;
+    }
+
     template <typename TKey, typename TData>
     inline typename HashMap<TKey, TData>::iterator HashMap<TKey, TData>::InsertOrAssign(const_reference pair) {
         size_type hash;
@@ -428,8 +442,27 @@ namespace FieaGameEngine {
     template <typename TKey, typename TData>
     inline typename HashMap<TKey, TData>::iterator HashMap<TKey, TData>::Find(const key_type& key, size_type& hash) {
         hash = _hashFunctor(key) % MaxHashValue();
+        return FindInChain(key, hash);
+    }
+
+    template <typename TKey, typename TData>
+    inline typename HashMap<TKey, TData>::iterator HashMap<TKey, TData>::FindWithHashCode(const key_type& key, size_type hashCode) {
+        return FindInChain(key, hashCode % MaxHashValue());
+    }
+
+    template <typename TKey, typename TData>
+    inline typename HashMap<TKey, TData>::const_iterator HashMap<TKey, TData>::CFindWithHashCode(const key_type& key, size_type hashCode) const {
+        auto itr = (const_cast<HashMap*>(this))->FindWithHashCode(key, hashCode);
+        return const_iterator{*(const_cast<HashMap*>(this)), itr._arrayItr, itr._chainItr};
+    }
+
+    template <typename TKey, typename TData>
+    inline typename HashMap<TKey, TData>::size_type HashMap<TKey, TData>::HashCode(const key_type& key) const { return _hashFunctor(key); }
+
+    template <typename TKey, typename TData>
+    inline typename HashMap<TKey, TData>::iterator HashMap<TKey, TData>::FindInChain(const key_type& key, size_type chainIndex) {
         auto arrayItr = _chains.begin();
-        auto& chain = arrayItr[hash];
+        auto& chain = arrayItr[chainIndex];
 
         for (auto chainItr = chain.begin(); chainItr != chain.end(); ++chainItr) {
             if (_keyCompareFunctor(key, chainItr->first)) {
@@ -7,6 +7,7 @@
 #include <JsonParseCoordinator.h>
 #include <ScopeJsonKeyTokenTransmuter.h>
 #include <AllScopeJsonParseHelper.h>
+#include <ScopeBinaryWriter.h>
 #include "ClockEventArgs.h"
 #include "ScoreIncrementEventArgs.h"
 #include "Level.h"
@@ -55,12 +56,40 @@ namespace FieaGameEngine {
 		CubeOccupantFactory::Register();
 	}
 
+	//Converts the JSON content the game loads into the binary scope format, writing each .scb next to its .json
+	inline void ConvertContentToBinary()
+	{
+		using namespace std::literals::string_literals;
+
+		const std::pair<std::string, std::string> content[] = {
+			{ R"(Files\GameData)"s, Player::TypeNameClass() },
+			{ R"(Files\Level1)"s, Level::TypeNameClass() },
+			{ R"(Files\Level2)"s, Level::TypeNameClass() },
+			{ R"(Files\Level3)"s, Level::TypeNameClass() }
+		};
+
+		for (const auto& [file, rootClass] : content)
+		{
+			std::shared_ptr<Scope> root = Factory<Scope>::StaticCreate(rootClass);
+			auto wrapper = std::make_shared<ScopeParseWrapper>(root);
+			auto coordinator = JsonParseCoordinator(wrapper);
+
+			coordinator.PushBackHelper(std::make_unique<ScopeJsonParse::AllScopeJsonParseHelper>());
+			coordinator.PushBackTransmuter(std::make_unique<ScopeJsonParse::ScopeJsonKeyTokenTransmuter>());
+			coordinator.DeserializeIntoWrapperFromFile(file + ".json"s);
+
+			std::ofstream binary{ file + ".scb"s, std::ios::binary };
+			ScopeBinaryWriter{ binary }.Write(*root);
+		}
+	}
+
 	void EventSubscribeInitialize(Player& CurrentPlayer, EventQueue& Queue)
 	{
 		CurrentPlayer.EventListener = std::make_shared<EventSubscriber>([&CurrentPlayer](const IEventArgs& args) {
 			const LibraryDesktopTests::ScoreIncrementEventArgs* converted = args.As<LibraryDesktopTests::ScoreIncrementEventArgs>();
 			if (converted != nullptr) {
-				CurrentPlayer.At("Score").SetElement(CurrentPlayer.At("Score").GetIntegerElement() + static_cast<int>(converted->Increment));
+				Datum& score = Player::SCORE_HANDLE(CurrentPlayer);
+				score.SetElement(score.GetIntegerElement() + static_cast<int>(converted->Increment));
 			}
 			else {
 				const FieaGameEngine::ClockEventArgs* timerArgs = args.As<FieaGameEngine::ClockEventArgs>();
@@ -11,22 +11,23 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Level);
 
+	const AttributeHandle<Level> Level::CUBES_HANDLE{ "Cubes"s };
+	const AttributeHandle<Level> Level::PLAYER_HANDLE{ "Player"s };
+
 	Level::Level() : Level("Level"s) {}
 
 	Level::Level(String name) :
-		Attributed{Level::TypeIdClass()},
-		_cubesDatum{ &(At("Cubes"s)) },
-		_playerDatum{&(At("Player"s))}
+		Attributed{Level::TypeIdClass()}
 	{}
 
 	void Level::Initialize(Game& game, std::shared_ptr<Camera> camera, Vector<BaseDrawableGameobject*>& drawVector)
 	{
 
-		_cubes = &_cubesDatum->GetTableElement();
-		assert(_cubes != nullptr);
-		for (Datum::size_type i = 0; i < _cubes->Size(); ++i)
+		Scope& cubes = CUBES_HANDLE(*this).GetTableElement();
+		_cubes = cubes.Handle();
+		for (Datum::size_type i = 0; i < cubes.Size(); ++i)
 		{
-			Datum::Table& cubeScope = _cubes->At(i).GetTableElement();
+			Datum::Table& cubeScope = cubes.At(i).GetTableElement();
 			assert(cubeScope.Is(Cube::TypeIdClass()));
 			Cube& cube = reinterpret_cast<Cube&>(cubeScope);
 
@@ -40,26 +41,27 @@ namespace FieaGameEngine
 			drawVector.EmplaceBack(&cube.GetModel());
 		}
 
-		Scope* playerScope = &_playerDatum->GetTableElement();
+		Scope* playerScope = &PLAYER_HANDLE(*this).GetTableElement();
 		assert(playerScope != nullptr && playerScope->Is(Player::TypeIdClass()));
-		_player = reinterpret_cast<Player*>(playerScope);
+		_player = playerScope->Handle();
+		Player& player = static_cast<Player&>(*playerScope);
 		
-		_player->Initialize(game, camera);
+		player.Initialize(game, camera);
 
 
-		int startingCubeID = _player->GetStartingCube();
+		int startingCubeID = player.GetStartingCube();
 		std::string id = std::to_string(startingCubeID);
-		auto it = _cubes->Find(id);
+		auto it = cubes.Find(id);
 
-		assert(it != _cubes->end());
+		assert(it != cubes.end());
 		Scope& cubeScope = it->second.GetTableElement();
 		assert(cubeScope.Is(Cube::TypeIdClass()));
 		Cube& startingCube = reinterpret_cast<Cube&>(cubeScope);
 
 		const glm::vec4& cubePosition = startingCube.GetTransform().GetLocalPosition();
-		_player->SetCoordinate(IntVector3D{ static_cast<int>(cubePosition.x), static_cast<int>(cubePosition.y), static_cast<int>(cubePosition.z) });
+		player.SetCoordinate(IntVector3D{ static_cast<int>(cubePosition.x), static_cast<int>(cubePosition.y), static_cast<int>(cubePosition.z) });
 		
-		switch (_player->GetStartingFace())
+		switch (player.GetStartingFace())
 		{
 		case Direction3D::Up:
 			break;
@@ -94,7 +96,7 @@ namespace FieaGameEngine
 			break;
 		}
 
-		for (std::size_t i{ 0 }; i < GetAmountToRotate(_player->GetStartingFace(), _player->GetStartingDirection()); ++i)
+		for (std::size_t i{ 0 }; i < GetAmountToRotate(player.GetStartingFace(), player.GetStartingDirection()); ++i)
 		{
 			RotateRight(camera.get());
 		}
@@ -102,11 +104,11 @@ namespace FieaGameEngine
 		XMMATRIX rotationMat = XMMatrixRotationAxis(camera->UpVector(), XM_PIDIV2);
 		camera->ApplyRotation(rotationMat, camera->Direction(), camera->Up());
 		
-		auto verticalOffset = Direction3DInfo::Direction3DToFloatVector4D(_player->GetStartingFace()) * ((ONE_CUBE_UNIT / 2) + Player::GetPlayerScale());
+		auto verticalOffset = Direction3DInfo::Direction3DToFloatVector4D(player.GetStartingFace()) * ((ONE_CUBE_UNIT / 2) + Player::GetPlayerScale());
 		auto sum = cubePosition * ONE_CUBE_UNIT;
 		sum += verticalOffset;
-		_player->SetPosition(sum.x, sum.y, sum.z);
-		drawVector.EmplaceBack(&_player->GetModel());
+		player.SetPosition(sum.x, sum.y, sum.z);
+		drawVector.EmplaceBack(&player.GetModel());
 	}
 
 	Cube* Level::GetCube(const IntVector3D v)
@@ -122,13 +124,14 @@ namespace FieaGameEngine
 	Cube* Level::GetCube(int x, int y, int z)
 	{
 		Cube* cubeToReturn = nullptr;
-		assert(_cubes != nullptr);
+		Scope* cubes = _cubes.Resolve();
+		assert(cubes != nullptr);
 		
 		int uniqueId = z + (y * _mapZExtent) + (x * _mapZExtent * _mapYExtent);
 		std::string test = std::to_string(uniqueId);
-		auto it = _cubes->Find(test);
+		auto it = cubes->Find(test);
 
-		if (it != _cubes->end())
+		if (it != cubes->end())
 		{
 			Scope* cube = &(it->second.GetTableElement());
 			assert(cube->Is(Cube::TypeIdClass()));
@@ -139,8 +142,9 @@ namespace FieaGameEngine
 
 	Player& Level::GetPlayer()
 	{
-		assert(_player != nullptr);
-		return *_player;
+		Player* player = _player.Resolve<Player>();
+		assert(player != nullptr);
+		return *player;
 	}
 
 	SignatureVector Level::Signatures() { return SignatureVector{
@@ -159,27 +163,31 @@ namespace FieaGameEngine
 	}
 	void Level::RotateRight(Camera* camera)
 	{
-		auto rotationMatrix = XMMatrixRotationY(0.f) * XMMatrixRotationAxis(_player->UpVector(), -XM_PIDIV2);
-		_player->ApplyRotation(rotationMatrix, _player->Direction(), _player->Up());
-		camera->ApplyRotation(rotationMatrix, _player->Direction(), _player->Up());
+		Player& player = GetPlayer();
+		auto rotationMatrix = XMMatrixRotationY(0.f) * XMMatrixRotationAxis(player.UpVector(), -XM_PIDIV2);
+		player.ApplyRotation(rotationMatrix, player.Direction(), player.Up());
+		camera->ApplyRotation(rotationMatrix, player.Direction(), player.Up());
 	}
 	void Level::RotateLeft(Camera* camera)
 	{
-		auto rotationMatrix = XMMatrixRotationY(0.f) * XMMatrixRotationAxis(_player->UpVector(), XM_PIDIV2);
-		_player->ApplyRotation(rotationMatrix, _player->Direction(), _player->Up());
-		camera->ApplyRotation(rotationMatrix, _player->Direction(), _player->Up());
+		Player& player = GetPlayer();
+		auto rotationMatrix = XMMatrixRotationY(0.f) * XMMatrixRotationAxis(player.UpVector(), XM_PIDIV2);
+		player.ApplyRotation(rotationMatrix, player.Direction(), player.Up());
+		camera->ApplyRotation(rotationMatrix, player.Direction(), player.Up());
 	}
 	void Level::RotateDown(Camera* camera)
 	{
-		auto rotationMatrix = XMMatrixRotationY(0.f) * XMMatrixRotationAxis(_player->RightVector(), -XM_PIDIV2);
-		_player->ApplyRotation(rotationMatrix, _player->Direction(), _player->Up());
-		camera->ApplyRotation(rotationMatrix, _player->Direction(), _player->Up());
+		Player& player = GetPlayer();
+		auto rotationMatrix = XMMatrixRotationY(0.f) * XMMatrixRotationAxis(player.RightVector(), -XM_PIDIV2);
+		player.ApplyRotation(rotationMatrix, player.Direction(), player.Up());
+		camera->ApplyRotation(rotationMatrix, player.Direction(), player.Up());
 	}
 	void Level::CameraFixup(Camera* camera)
 	{
-		auto directionVec = _player->DirectionVector();
-		auto upVec = _player->UpVector();
-		auto position = _player->PositionVector();
+		Player& player = GetPlayer();
+		auto directionVec = player.DirectionVector();
+		auto upVec = player.UpVector();
+		auto position = player.PositionVector();
 		upVec *= 2.f;
 		directionVec *= -7.5f;
 		camera->SetPosition(position + directionVec + upVec);
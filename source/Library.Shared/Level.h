@@ -1,5 +1,6 @@
 #pragma once
 #include "Attributed.h"
+#include "AttributeHandle.h"
 #include "ProxyModel.h"
 #include "Cube.h"
 #include "Player.h"
@@ -27,6 +28,10 @@ namespace FieaGameEngine
 
 		static SignatureVector Signatures();
 
+		// Number of cubes constructed together while a level loads. Levels hold a few dozen cubes, and up to one batch less one
+		// cube is constructed and destroyed unused at the end of each level, so batches are kept small
+		static constexpr std::size_t CUBE_BATCH_SIZE = 8;
+
 		[[nodiscard]] virtual ScopeUniquePointer Clone() const override;
 		static float GetCubeSideLength();
 
@@ -39,10 +44,12 @@ namespace FieaGameEngine
 
 		std::size_t GetAmountToRotate(Direction3D face, Direction3D targetForward);
 
-		Datum* _cubesDatum;
-		Scope* _cubes;
-		Datum* _playerDatum;
-		Player* _player;
+		// Slots of the level's own tables, which stay correct for copies of the level, unlike pointers to its datums
+		static const AttributeHandle<Level> CUBES_HANDLE;
+		static const AttributeHandle<Level> PLAYER_HANDLE;
+
+		ScopeHandle _cubes;
+		ScopeHandle _player;
 		int _mapXExtent;
 		int _mapYExtent;
 		int _mapZExtent;
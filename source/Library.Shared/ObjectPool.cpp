@@ -0,0 +1,80 @@
+#include "pch.h"
+#include "ObjectPool.h"
+
+namespace FieaGameEngine {
+    bool ObjectPool::Release(void* object) {
+        const std::size_t index = FindSlab(static_cast<std::byte*>(object));
+
+        if (index == _slabs.Size()) {
+            return false;
+        }
+
+        if (--_slabs[index].liveCount == std::size_t(0)) {
+            FreeSlab(index);
+        }
+
+        return true;
+    }
+
+    std::size_t ObjectPool::FindSlab(const std::byte* address) {
+        // Finds the last slab starting at or before the address, which is the only one that can hold it.
+        std::size_t low = 0;
+        std::size_t high = _slabs.Size();
+
+        while (low < high) {
+            const std::size_t middle = low + ((high - low) / 2);
+
+            if (_slabs[middle].begin <= address) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+
+        if ((low > std::size_t(0)) && (address < _slabs[low - 1].end)) {
+            return low - 1;
+        }
+
+        return _slabs.Size();
+    }
+
+    std::byte* ObjectPool::AllocateSlab(std::size_t objectSize, std::size_t alignment, std::size_t count) {
+        const std::size_t size = objectSize * count;
+        std::byte* begin = static_cast<std::byte*>(::operator new(size, std::align_val_t{alignment}));
+
+        try {
+            _slabs.PushBack(Slab{begin, begin + size, count, std::align_val_t{alignment}});
+        } catch (...) {
+            ::operator delete(begin, std::align_val_t{alignment});
+            throw;
+        }
+
+        // Moved down to its place in address order.
+        for (std::size_t i = _slabs.Size() - 1; (i > std::size_t(0)) && (_slabs[i - 1].begin > begin); --i) {
+            std::swap(_slabs[i - 1], _slabs[i]);
+        }
+
+        return begin;
+    }
+
+    void ObjectPool::ReleaseFrom(std::byte* begin, std::size_t count) {
+        const std::size_t index = FindSlab(begin);
+        assert((index < _slabs.Size()) && (_slabs[index].begin == begin));
+        Slab& slab = _slabs[index];
+        slab.liveCount -= count;
+
+        if (slab.liveCount == std::size_t(0)) {
+            FreeSlab(index);
+        }
+    }
+
+    void ObjectPool::FreeSlab(std::size_t index) {
+        const Slab slab = _slabs[index];
+        _slabs.RemoveAt(index);
+        ::operator delete(slab.begin, slab.alignment);
+
+        if (_slabs.IsEmpty()) {
+            _slabs.ShrinkToFit();
+        }
+    }
+}
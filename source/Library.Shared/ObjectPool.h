@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "Vector.h"
+
+namespace FieaGameEngine {
+    /// <summary>
+    /// Slabs of storage which hold objects constructed together, so that spawning many objects costs one allocation.
+    /// A slab is released once every object in it has been destroyed. Pooled objects are owned by ordinary unique_ptrs,
+    /// so their class must route deallocation through `Release` with a class-specific operator delete, as Scope does.
+    /// Each object constructed in a slab is tagged with `MarkPooled`, so that the class only calls `Release` for tagged objects.
+    /// The pool is not synchronized, so pooled objects must be created and destroyed on a single thread.
+    /// </summary>
+    class ObjectPool final {
+
+    public:
+        ObjectPool() = delete;
+
+        /// <summary>
+        /// Does the given class hand its memory back through `Release`, and can it be tagged? Only such classes are constructed in slabs.
+        /// </summary>
+        template <typename T, typename = void> struct IsPoolAware : std::false_type {};
+        template <typename T> struct IsPoolAware<T, std::void_t<
+            decltype(T::operator delete(std::declval<void*>(), std::declval<std::size_t>())),
+            decltype(std::declval<T&>().MarkPooled())
+        >> : std::true_type {};
+
+        /// <summary>
+        /// Constructs the given number of objects contiguously in a single slab, and appends them to the output vector.
+        /// If the class is not pool-aware, the objects are created one at a time with the given constructor instead.
+        /// </summary>
+        /// <param name="emplace"> - Constructs one object at the given address and returns it.</param>
+        /// <param name="construct"> - Creates one heap-allocated object, used when the class is not pool-aware.</param>
+        template <typename TConcrete, typename TAbstract, typename TEmplace, typename TConstruct>
+        static void CreateMany(std::size_t count, Vector<std::unique_ptr<TAbstract>>& created, TEmplace emplace, TConstruct construct);
+
+        /// <summary>
+        /// Returns the memory of a destroyed object to its slab. To be called from a class-specific operator delete.
+        /// </summary>
+        /// <returns>False if the object was not pooled, in which case the caller must deallocate it.</returns>
+        static bool Release(void* object);
+
+        /// <returns>Number of slabs which still hold live objects.</returns>
+        [[nodiscard]] static std::size_t SlabCount();
+
+    private:
+        struct Slab final {
+            std::byte* begin;
+            std::byte* end;
+            std::size_t liveCount;
+            std::align_val_t alignment;
+        };
+
+        /// <summary>
+        /// Live slabs, in order of address, so that the slab holding an object is found by binary search.
+        /// </summary>
+        inline static Vector<Slab> _slabs{};
+
+        /// <returns>Index of the slab holding the given address, or the number of slabs if none does.</returns>
+        [[nodiscard]] static std::size_t FindSlab(const std::byte* address);
+
+        /// <returns>Storage for the given number of objects of the given size and alignment.</returns>
+        static std::byte* AllocateSlab(std::size_t objectSize, std::size_t alignment, std::size_t count);
+
+        /// <summary>
+        /// Counts the given number of objects of the slab starting at the given address as destroyed.
+        /// </summary>
+        static void ReleaseFrom(std::byte* begin, std::size_t count);
+
+        /// <summary>
+        /// Deallocates the slab at the given index.
+        /// </summary>
+        static void FreeSlab(std::size_t index);
+
+    };
+}
+
+#include "ObjectPool.inl"
@@ -0,0 +1,38 @@
+#pragma once
+#include "ObjectPool.h"
+
+namespace FieaGameEngine {
+    template <typename TConcrete, typename TAbstract, typename TEmplace, typename TConstruct>
+    inline void ObjectPool::CreateMany(std::size_t count, Vector<std::unique_ptr<TAbstract>>& created, TEmplace emplace, TConstruct construct) {
+        if (count == std::size_t(0)) {
+            return;
+        }
+
+        created.Reserve(created.Size() + count);
+
+        if constexpr (!IsPoolAware<TConcrete>::value) {
+            for (std::size_t i = 0; i < count; ++i) {
+                created.PushBack(construct());
+            }
+        } else {
+            std::byte* slab = AllocateSlab(sizeof(TConcrete), alignof(TConcrete), count);
+            std::size_t constructed = 0;
+
+            try {
+                for (; constructed < count; ++constructed) {
+                    TConcrete* object = emplace(slab + (constructed * sizeof(TConcrete)));
+                    object->MarkPooled();
+                    created.PushBack(std::unique_ptr<TAbstract>{object});
+                }
+            } catch (...) {
+                // Objects already constructed are owned by the output vector, and release the slab as they are destroyed.
+                ReleaseFrom(slab, count - constructed);
+                throw;
+            }
+        }
+    }
+
+    inline std::size_t ObjectPool::SlabCount() {
+        return _slabs.Size();
+    }
+}
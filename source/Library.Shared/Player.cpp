@@ -12,6 +12,9 @@ using namespace DirectX;
 #define PLAYER_SCALE 1.f
 namespace FieaGameEngine {
     RTTI_DEFINITIONS(Player);
+
+    const AttributeHandle<Player> Player::SCORE_HANDLE{ "Score"s };
+
     Player::Player() : Player{ "Player"s } {}
     
     SignatureVector Player::Signatures() { return SignatureVector{ 
@@ -32,7 +35,8 @@ namespace FieaGameEngine {
 
     void Player::UpdateSelf(const GameTime&)
     {
-        At("Score"s).SetElement(At("Score"s).GetIntegerElement() + 1);
+        Datum& score = SCORE_HANDLE(*this);
+        score.SetElement(score.GetIntegerElement() + 1);
     }
 
     float Player::GetPlayerScale()
@@ -1,4 +1,5 @@
 #pragma once
+#include "AttributeHandle.h"
 #include "EventSubscriber.h"
 #include "GameObject.h"
 #include "ProxyModel.h"
@@ -15,6 +16,7 @@ namespace FieaGameEngine
 		RTTI_DECLARATIONS(Player, FieaGameEngine::GameObject);
 	public:
 		Datum::Integer Score = 0;
+		static const AttributeHandle<Player> SCORE_HANDLE;
 		Player();
 		inline explicit Player(String name) : GameObject{ Player::TypeIdClass(), name } {}
 
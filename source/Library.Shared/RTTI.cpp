@@ -3,6 +3,29 @@
 
 namespace FieaGameEngine
 {
+	RTTI::TypeDisplay::TypeDisplay(const TypeDisplay& parent, IdType id) :
+		depth(parent.depth + 1)
+	{
+		if (depth > MAX_TYPE_DEPTH)
+		{
+			using namespace std::string_literals;
+			throw std::length_error("Inheritance chain is too deep for RTTI."s);
+		}
+
+		for (std::size_t i = 0; i < parent.depth; ++i)
+		{
+			ids[i] = parent.ids[i];
+		}
+
+		ids[parent.depth] = id;
+	}
+
+	const RTTI::TypeDisplay& RTTI::TypeDisplayClass()
+	{
+		static const TypeDisplay display{};
+		return display;
+	}
+
 	std::string RTTI::ToString() const
 	{
 		using namespace std::string_literals;
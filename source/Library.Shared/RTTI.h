@@ -1,6 +1,7 @@
 #pragma once
 #include <cstddef>
 #include <string>
+#include <stdexcept>
 
 namespace FieaGameEngine
 {
@@ -9,6 +10,47 @@ namespace FieaGameEngine
 	public:
 		using IdType = std::size_t;
 
+		/// <summary>
+		/// Deepest inheritance chain below RTTI that a class may have.
+		/// </summary>
+		static constexpr std::size_t MAX_TYPE_DEPTH = 16;
+
+		/// <summary>
+		/// Ancestry of a class, as the ids of every class from the root of its hierarchy down to the class itself.
+		/// A class is a descendant of another exactly when the other's id is stored at the other's depth, so checks are a single compare.
+		/// </summary>
+		struct TypeDisplay
+		{
+			/// <summary>
+			/// Number of classes in the chain, not counting RTTI itself.
+			/// </summary>
+			std::size_t depth{0};
+
+			/// <summary>
+			/// Ids of the classes in the chain, ordered from the root down. Only the first depth entries are used.
+			/// </summary>
+			IdType ids[MAX_TYPE_DEPTH]{};
+
+			TypeDisplay() = default;
+
+			/// <summary>
+			/// Extends the given parent's chain with the given class.
+			/// </summary>
+			TypeDisplay(const TypeDisplay& parent, IdType id);
+
+			/// <returns>Is the given class within the chain? Bounded by the depth, and does not recurse.</returns>
+			[[nodiscard]] bool Contains(IdType id) const;
+
+			/// <returns>Is the given class's chain a prefix of this one? Always a single compare.</returns>
+			[[nodiscard]] bool Contains(const TypeDisplay& type) const;
+		};
+
+		/// <returns>Ancestry of RTTI itself, which is empty.</returns>
+		static const TypeDisplay& TypeDisplayClass();
+
+		/// <returns>Depth of RTTI itself, which is zero.</returns>
+		static constexpr std::size_t TypeDepthClass() { return 0; }
+
 		RTTI() = default;
 		RTTI(const RTTI&) = default;
 		RTTI& operator=(const RTTI&) = default;
@@ -18,7 +60,12 @@ namespace FieaGameEngine
 
 		virtual IdType TypeIdInstance() const = 0;
 		virtual std::string TypeNameInstance() const = 0;
-		virtual bool Is(IdType) const;
+		virtual const TypeDisplay& TypeDisplayInstance() const = 0;
+		virtual bool Is(IdType id) const;
+		virtual bool Is(const TypeDisplay& type) const;
+
+		template <typename T>
+		bool Is() const;
 
 		template <typename T>
 		T* As();
@@ -35,9 +82,16 @@ namespace FieaGameEngine
 	public:																													\
 		static FieaGameEngine::RTTI::IdType TypeIdClass() { return _typeId; }												\
 		static std::string TypeNameClass() { return #Type; }																\
+		static constexpr std::size_t TypeDepthClass() { return ParentType::TypeDepthClass() + 1; }							\
+		static const FieaGameEngine::RTTI::TypeDisplay& TypeDisplayClass()													\
+		{																													\
+			static_assert(TypeDepthClass() <= FieaGameEngine::RTTI::MAX_TYPE_DEPTH, "Inheritance chain is too deep for RTTI.");	\
+			static const FieaGameEngine::RTTI::TypeDisplay display{ParentType::TypeDisplayClass(), reinterpret_cast<FieaGameEngine::RTTI::IdType>(&_typeId)};	\
+			return display;																									\
+		}																													\
 		FieaGameEngine::RTTI::IdType TypeIdInstance() const override { return TypeIdClass(); }								\
 		std::string TypeNameInstance() const override { return TypeNameClass(); }											\
-		bool Is(FieaGameEngine::RTTI::IdType id) const override { return (id == _typeId ? true : ParentType::Is(id)); }		\
+		const FieaGameEngine::RTTI::TypeDisplay& TypeDisplayInstance() const override { return TypeDisplayClass(); }		\
 	private:																												\
 		static const FieaGameEngine::RTTI::IdType _typeId;
 
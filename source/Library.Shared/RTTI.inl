@@ -2,20 +2,49 @@
 
 namespace FieaGameEngine
 {
-	inline bool RTTI::Is(IdType) const
+	inline bool RTTI::TypeDisplay::Contains(IdType id) const
 	{
+		for (std::size_t i = 0; i < depth; ++i)
+		{
+			if (ids[i] == id)
+			{
+				return true;
+			}
+		}
+
 		return false;
 	}
 
+	inline bool RTTI::TypeDisplay::Contains(const TypeDisplay& type) const
+	{
+		return (type.depth == 0) || ((type.depth <= depth) && (ids[type.depth - 1] == type.ids[type.depth - 1]));
+	}
+
+	inline bool RTTI::Is(IdType id) const
+	{
+		return TypeDisplayInstance().Contains(id);
+	}
+
+	inline bool RTTI::Is(const TypeDisplay& type) const
+	{
+		return TypeDisplayInstance().Contains(type);
+	}
+
+	template <typename T>
+	inline bool RTTI::Is() const
+	{
+		return Is(T::TypeDisplayClass());
+	}
+
 	template <typename T>
 	inline const T* RTTI::As() const
 	{
-		return (Is(T::TypeIdClass()) ? reinterpret_cast<const T*>(this) : nullptr);
+		return (Is<T>() ? reinterpret_cast<const T*>(this) : nullptr);
 	}
 
 	template <typename T>
 	inline T* RTTI::As()
 	{
-		return (Is(T::TypeIdClass()) ? reinterpret_cast<T*>(const_cast<RTTI*>(this)) : nullptr);
+		return (Is<T>() ? reinterpret_cast<T*>(const_cast<RTTI*>(this)) : nullptr);
 	}
 }
\ No newline at end of file
@@ -32,6 +32,11 @@ namespace FieaGameEngine {
         virtual void ReactBeforeActionList(const IEventArgs&);
         virtual void ReactAfterActionList(const IEventArgs&);
 
+        /// <summary>
+        /// Updates the actions of this reaction in response to the event, whether or not it is reacting to it.
+        /// </summary>
+        void React(const IEventArgs&);
+
     private:
         std::shared_ptr<EventSubscriber> _subscriber;
 
@@ -24,14 +24,17 @@ namespace FieaGameEngine {
     inline bool Reaction::IsReactingTo(const IEventArgs&) const { return true; }
     inline void Reaction::ReactBeforeActionList(const IEventArgs&) {}
     inline void Reaction::ReactAfterActionList(const IEventArgs&) {}
+    inline void Reaction::React(const IEventArgs& args) {
+        ReactBeforeActionList(args);
+        Update(GameplayState::Singleton().GetTime());
+        ReactAfterActionList(args);
+    }
 
     inline std::shared_ptr<EventSubscriber> Reaction::CreateSubscriber() const {
         auto* ptr = const_cast<Reaction*>(this);
         return std::make_shared<EventSubscriber>([ptr](const IEventArgs& args) {
             if (ptr->IsReactingTo(args)) {
-                ptr->ReactBeforeActionList(args);
-                ptr->Update(GameplayState::Singleton().GetTime());
-                ptr->ReactAfterActionList(args);
+                ptr->React(args);
             }
         });
     }
@@ -1,13 +1,111 @@
 #include "pch.h"
 #include "ReversePolishEvaluator.h"
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <string>
+#include "AttributedSignatureRegistry.h"
+#include "ExpressionLexer.h"
 #include "Scope.h"
-#include "Stack.h"
 
 using namespace std::literals::string_literals;
 
+// Labels as values let each handler jump straight to the next one. Other compilers dispatch through a switch.
+#if defined(__GNUC__) || defined(__clang__)
+#define __REVERSEPOLISHEVALUATOR_THREADED_DISPATCH
+#endif
+
 namespace FieaGameEngine {
+    namespace {
+        /// <returns>Would dividing the given datums be integer division that is undefined, by zero or overflowing, for some element?</returns>
+        bool IsIntegerDivisionUndefined(const Datum& lhs, const Datum& rhs) {
+            if ((lhs.ActualType() != Datum::DatumType::Integer) || (rhs.ActualType() != Datum::DatumType::Integer)) {
+                return false;
+            }
+
+            bool isLhsMinimum = false;
+
+            for (Datum::size_type i = 0; i < lhs.Size(); ++i) {
+                isLhsMinimum = isLhsMinimum || (lhs.CGetIntegerElement(i) == std::numeric_limits<Datum::Integer>::min());
+            }
+
+            for (Datum::size_type i = 0; i < rhs.Size(); ++i) {
+                const Datum::Integer divisor = rhs.CGetIntegerElement(i);
+
+                if ((divisor == 0) || (isLhsMinimum && (divisor == -1))) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /// <returns>First of the given number of lanes, growing the lanes if there are fewer.</returns>
+        template <typename T> T* Lanes(Vector<T>& lanes, std::size_t count) {
+            while (lanes.Size() < count) {
+                lanes.EmplaceBack();
+            }
+
+            return &lanes.Front();
+        }
+
+        /// <summary>
+        /// Applies the operation lane by lane. Kept to one plain loop over contiguous lanes, so the compiler can vectorize it.
+        /// </summary>
+        template <typename TResult, typename TLhs, typename TRhs, typename TOperation>
+        void ForEachLane(TResult* result, const TLhs* lhs, const TRhs* rhs, std::size_t count, TOperation operation) {
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                result[lane] = operation(lhs[lane], rhs[lane]);
+            }
+        }
+
+        template <typename TResult, typename TInput, typename TOperation>
+        void ForEachLane(TResult* result, const TInput* input, std::size_t count, TOperation operation) {
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                result[lane] = operation(input[lane]);
+            }
+        }
+
+        /// <summary>
+        /// Stands in for an operand whose value is only known once evaluated. Holds ones, so operations like division are safe to try on it.
+        /// </summary>
+        /// <returns>Datum of the given type and size, or an empty datum of unknown type if the type has no sample.</returns>
+        Datum Sample(Datum::DatumType type, Datum::size_type size) {
+            Datum sample{};
+
+            for (auto i = Datum::size_type(0); i < size; ++i) {
+                switch (type) {
+
+                case Datum::DatumType::Integer:
+                    sample.PushBack(Datum::Integer(1));
+                    break;
+
+                case Datum::DatumType::Float:
+                    sample.PushBack(Datum::Float(1.f));
+                    break;
+
+                case Datum::DatumType::Vector:
+                    sample.PushBack(Datum::Vector(1.f));
+                    break;
+
+                case Datum::DatumType::Matrix:
+                    sample.PushBack(Datum::Matrix(1.f));
+                    break;
+
+                case Datum::DatumType::String:
+                    sample.PushBack(std::string{});
+                    break;
+
+                default:
+                    return Datum{};
+
+                }
+            }
+
+            return sample;
+        }
+    }
+
     const std::string ReversePolishEvaluator::DEFAULT_ABS = "abs"s;
     const std::string ReversePolishEvaluator::DEFAULT_ADDITION = "+"s;
     const std::string ReversePolishEvaluator::DEFAULT_AND = "&&"s;
@@ -56,6 +154,56 @@ namespace FieaGameEngine {
         "tangent"s
     };
 
+    const typename ReversePolishEvaluator::UnaryOperation ReversePolishEvaluator::UNARY_OPERATIONS[] = { // Must match the definition of OperationID, defined in ReversePolishEvaluator.h
+        &ReversePolishEvaluator::AbsoluteValue,
+        nullptr,
+        nullptr,
+        nullptr,
+        &ReversePolishEvaluator::Cosine,
+        &ReversePolishEvaluator::Decrement,
+        &ReversePolishEvaluator::DegToRad,
+        nullptr,
+        nullptr,
+        &ReversePolishEvaluator::Increment,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        &ReversePolishEvaluator::Negate,
+        nullptr,
+        &ReversePolishEvaluator::RadToDeg,
+        &ReversePolishEvaluator::Sine,
+        nullptr,
+        &ReversePolishEvaluator::Tangent
+    };
+
+    const typename ReversePolishEvaluator::BinaryOperation ReversePolishEvaluator::BINARY_OPERATIONS[] = { // Must match the definition of OperationID, defined in ReversePolishEvaluator.h
+        nullptr,
+        &ReversePolishEvaluator::Addition,
+        &ReversePolishEvaluator::And,
+        &ReversePolishEvaluator::Assign,
+        nullptr,
+        nullptr,
+        nullptr,
+        &ReversePolishEvaluator::Division,
+        &ReversePolishEvaluator::Exponent,
+        nullptr,
+        &ReversePolishEvaluator::IsCongruent,
+        &ReversePolishEvaluator::IsEquivalent,
+        &ReversePolishEvaluator::IsGreater,
+        &ReversePolishEvaluator::IsLess,
+        &ReversePolishEvaluator::Modulus,
+        &ReversePolishEvaluator::Multiplication,
+        nullptr,
+        &ReversePolishEvaluator::Or,
+        nullptr,
+        nullptr,
+        &ReversePolishEvaluator::Subtraction,
+        nullptr
+    };
+
     ReversePolishEvaluator::ReversePolishEvaluator(std::initializer_list<std::pair<OperationID, std::string>> operatorOverrides)
         : _unaryOperators{}
         , _binaryOperators{}
@@ -84,153 +232,1376 @@ namespace FieaGameEngine {
         operators[static_cast<uint8_t>(OperationID::SUBTRACTION)] = DEFAULT_SUBTRACTION;
         operators[static_cast<uint8_t>(OperationID::TANGENT)] = DEFAULT_TANGENT;
 
-        for (const auto& pair : operatorOverrides) {
-            operators[static_cast<uint8_t>(pair.first)] = pair.second;
+        for (const auto& pair : operatorOverrides) {
+            operators[static_cast<uint8_t>(pair.first)] = pair.second;
+        }
+
+        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::ABS)], OperationID::ABS));
+        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::COSINE)], OperationID::COSINE));
+        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::DECREMENT)], OperationID::DECREMENT));
+        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::DEGTORAD)], OperationID::DEGTORAD));
+        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::INCREMENT)], OperationID::INCREMENT));
+        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::NEGATE)], OperationID::NEGATE));
+        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::RADTODEG)], OperationID::RADTODEG));
+        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::SINE)], OperationID::SINE));
+        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::TANGENT)], OperationID::TANGENT));
+
+        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::ADDITION)], OperationID::ADDITION));
+        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::AND)], OperationID::AND));
+        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::ASSIGN)], OperationID::ASSIGN));
+        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::DIVISION)], OperationID::DIVISION));
+        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::EXPONENT)], OperationID::EXPONENT));
+        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::IS_CONGRUENT)], OperationID::IS_CONGRUENT));
+        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::IS_EQUIVALENT)], OperationID::IS_EQUIVALENT));
+        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::IS_GREATER)], OperationID::IS_GREATER));
+        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::IS_LESS)], OperationID::IS_LESS));
+        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::MULTIPLICATION)], OperationID::MULTIPLICATION));
+        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::OR)], OperationID::OR));
+        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::SUBTRACTION)], OperationID::SUBTRACTION));
+    }
+
+    typename ReversePolishEvaluator::CompiledExpression ReversePolishEvaluator::Compile(const std::string& expression, bool isOptimizing) const {
+        using size_type = CompiledExpression::size_type;
+        constexpr auto NOT_A_VARIABLE = std::numeric_limits<size_type>::max();
+
+        CompiledExpression compiled{};
+        auto depth = size_type(0);
+
+        // Each operand on the stack records the variable it was read from, the instruction which pushed it, and how many writes had been compiled by then.
+        struct Operand final {
+            size_type variable;
+            size_type push;
+            size_type writes;
+        };
+
+        Vector<Operand> operands{};
+        Vector<bool> isAssignmentUnread{};
+        auto writes = size_type(0);
+        compiled._isOptimized = isOptimizing;
+
+        const auto pushOperand = [&compiled, &depth, &operands, &writes](CompiledExpression::Opcode opcode, size_type operand, size_type variable) {
+            compiled._instructions.PushBack(CompiledExpression::Instruction{opcode, OperationID::__OperationID_Count, static_cast<std::uint32_t>(operand)});
+            compiled._maxDepth = std::max(compiled._maxDepth, ++depth);
+            operands.PushBack(Operand{variable, compiled._instructions.Size() - 1, writes});
+        };
+
+        const auto pushConstant = [&compiled, &pushOperand](Datum&& constant) {
+            compiled._constants.PushBack(std::move(constant));
+            pushOperand(CompiledExpression::Opcode::PushConstant, compiled._constants.Size() - 1, NOT_A_VARIABLE);
+        };
+
+        // A variable which nothing could have written to since it was pushed can be loaded by value as it is pushed.
+        const auto read = [&compiled, &isAssignmentUnread, &writes, isOptimizing](const Operand& operand, bool isLoadable) {
+            if (operand.variable == NOT_A_VARIABLE) {
+                return;
+            }
+
+            isAssignmentUnread[operand.variable] = false;
+
+            if (isOptimizing && isLoadable && (operand.writes == writes)) {
+                compiled._instructions[operand.push].opcode = CompiledExpression::Opcode::PushValue;
+            }
+        };
+
+        ExpressionLexer lexer{expression};
+        ExpressionLexer::Token lexed{};
+
+        while (lexer.Next(lexed)) {
+            const std::string token{lexed.text};
+
+            auto binaryOperator = _binaryOperators.Find(token);
+
+            if (binaryOperator != _binaryOperators.end()) {
+                if (depth < CompiledExpression::size_type(2)) {
+                    throw std::invalid_argument("Bad expression, operator \""s + token + "\" is missing operands!"s);
+                }
+
+                --depth;
+                const Operand rhs = operands.Back();
+                operands.PopBack();
+                Operand& lhs = operands.Back();
+                read(rhs, true);
+
+                if (binaryOperator->second != OperationID::ASSIGN) {
+                    read(lhs, true);
+                } else if (lhs.variable != NOT_A_VARIABLE) {
+                    if (isAssignmentUnread[lhs.variable]) {
+                        compiled._deadAssignments.PushBack(compiled._paths[lhs.variable].token.CFrontString());
+                    }
+
+                    isAssignmentUnread[lhs.variable] = true;
+                }
+
+                if (binaryOperator->second == OperationID::ASSIGN) {
+                    ++writes;
+                }
+
+                lhs = Operand{NOT_A_VARIABLE, NOT_A_VARIABLE, writes};
+
+                if (!isOptimizing || !TryFoldConstants(compiled, CompiledExpression::Opcode::ApplyBinary, binaryOperator->second)) {
+                    compiled._instructions.PushBack(CompiledExpression::Instruction{CompiledExpression::Opcode::ApplyBinary, binaryOperator->second, std::uint32_t(0)});
+                }
+
+                continue;
+            }
+
+            auto unaryOperator = _unaryOperators.Find(token);
+
+            if (unaryOperator != _unaryOperators.end()) {
+                if (depth < CompiledExpression::size_type(1)) {
+                    throw std::invalid_argument("Bad expression, operator \""s + token + "\" is missing operands!"s);
+                }
+
+                // Stepping writes through to its operand, so the operand is left as a reference.
+                const bool isStepping = (unaryOperator->second == OperationID::INCREMENT) || (unaryOperator->second == OperationID::DECREMENT);
+                read(operands.Back(), !isStepping);
+
+                if (isStepping) {
+                    ++writes;
+                }
+
+                operands.Back() = Operand{NOT_A_VARIABLE, NOT_A_VARIABLE, writes};
+
+                if (!isOptimizing || !TryFoldConstants(compiled, CompiledExpression::Opcode::ApplyUnary, unaryOperator->second)) {
+                    compiled._instructions.PushBack(CompiledExpression::Instruction{CompiledExpression::Opcode::ApplyUnary, unaryOperator->second, std::uint32_t(0)});
+                }
+
+                continue;
+            }
+
+            switch (lexed.type) {
+
+            case ExpressionLexer::TokenType::Integer:
+                pushConstant(Datum{std::stoi(token)});
+                break;
+
+            case ExpressionLexer::TokenType::Float:
+                pushConstant(Datum{std::stof(token)});
+                break;
+
+            case ExpressionLexer::TokenType::Vector:
+            case ExpressionLexer::TokenType::Matrix: {
+                Datum constant{};
+                constant.SetType((lexed.type == ExpressionLexer::TokenType::Vector) ? DatumType::Vector : DatumType::Matrix);
+                constant.PushBackFromString(token);
+                pushConstant(std::move(constant));
+                break;
+            }
+
+            default: {
+                auto variable = size_type(0);
+                while ((variable < compiled._paths.Size()) && (compiled._paths[variable].token.CFrontString() != token)) {
+                    ++variable;
+                }
+
+                // Repeated reads of a variable share its path, so it is only resolved once per evaluation.
+                if (isOptimizing && (variable < compiled._paths.Size())) {
+                    pushOperand(CompiledExpression::Opcode::PushPath, variable, variable);
+                    break;
+                }
+
+                compiled._paths.PushBack(CompilePath(token));
+                isAssignmentUnread.PushBack(false);
+                pushOperand(CompiledExpression::Opcode::PushPath, compiled._paths.Size() - 1, std::min(variable, compiled._paths.Size() - 1));
+                break;
+            }
+
+            }
+        }
+
+        if (depth != CompiledExpression::size_type(1)) {
+            throw std::invalid_argument("Bad expression, ambiguous result!"s);
+        }
+
+        compiled._isWriting = (writes > size_type(0));
+        return compiled;
+    }
+
+    bool ReversePolishEvaluator::TryFoldConstants(CompiledExpression& compiled, CompiledExpression::Opcode opcode, OperationID operationID) const {
+        using size_type = CompiledExpression::size_type;
+
+        const auto operandCount = (opcode == CompiledExpression::Opcode::ApplyBinary) ? size_type(2) : size_type(1);
+        auto& instructions = compiled._instructions;
+        auto& constants = compiled._constants;
+
+        // Operands are pushed by the instructions just before the operation, and constants are pooled in the order they are pushed.
+        for (auto i = size_type(0); i < operandCount; ++i) {
+            if ((i >= instructions.Size()) || (instructions[instructions.Size() - 1 - i].opcode != CompiledExpression::Opcode::PushConstant)) {
+                return false;
+            }
+        }
+
+        // Undefined integer division traps rather than throws, so it is left until it is evaluated too.
+        if (((operationID == OperationID::DIVISION) || (operationID == OperationID::MODULUS))
+            && IsIntegerDivisionUndefined(constants[constants.Size() - 2], constants.Back())
+        ) {
+            return false;
+        }
+
+        Datum folded{};
+
+        try {
+            // Copied, since operations like increment modify their input.
+            Datum input{constants[constants.Size() - operandCount]};
+            folded = (opcode == CompiledExpression::Opcode::ApplyBinary)
+                ? (this->*(BINARY_OPERATIONS[static_cast<uint8_t>(operationID)]))(input, constants.Back())
+                : (this->*(UNARY_OPERATIONS[static_cast<uint8_t>(operationID)]))(input);
+        } catch (const std::exception&) {
+            return false;
+        }
+
+        for (auto i = size_type(0); i < operandCount; ++i) {
+            instructions.PopBack();
+            constants.PopBack();
+        }
+
+        constants.PushBack(std::move(folded));
+        instructions.PushBack(CompiledExpression::Instruction{CompiledExpression::Opcode::PushConstant, OperationID::__OperationID_Count, static_cast<std::uint32_t>(constants.Size() - 1)});
+        return true;
+    }
+
+    void ReversePolishEvaluator::InferTypes(CompiledExpression& expression, RTTI::IdType contextType) const {
+        using Opcode = CompiledExpression::Opcode;
+
+        const SignatureLayout* layout = AttributedSignatureRegistry::FindLayout(contextType);
+
+        // A sample of each operand on the stack, with an unknown type where the type is only known once evaluated.
+        Vector<Datum> operands{};
+        operands.Reserve(expression._maxDepth);
+
+        for (auto& instruction : expression._instructions) {
+            switch (instruction.opcode) {
+
+            case Opcode::PushConstant: {
+                const Datum& constant = expression._constants[instruction.operand];
+                operands.PushBack(Sample(constant.ActualType(), constant.Size()));
+                break;
+            }
+
+            case Opcode::PushPath:
+            case Opcode::PushValue: {
+                const auto& path = expression._paths[instruction.operand];
+                const Attributed::Signature* prescribed = nullptr;
+
+                if ((layout != nullptr) && path.steps.IsEmpty()) {
+                    for (const auto& precompiled : *layout) {
+                        if (precompiled.signature.IsStorageExternal() && (precompiled.signature.Key() == path.key)) {
+                            prescribed = &precompiled.signature;
+                            break;
+                        }
+                    }
+                }
+
+                operands.PushBack((prescribed != nullptr) ? Sample(prescribed->Type(), prescribed->Count()) : Datum{});
+                break;
+            }
+
+            case Opcode::ApplyUnary: {
+                Datum& operand = operands.Back();
+
+                if (operand.ActualType() != DatumType::Unknown) {
+                    operand = (this->*(UNARY_OPERATIONS[static_cast<uint8_t>(instruction.operation)]))(operand);
+                }
+
+                break;
+            }
+
+            default: {
+                Datum rhs = std::move(operands.Back());
+                operands.PopBack();
+                Datum& lhs = operands.Back();
+
+                // Assigning needs the datum assigned to, so it only passes on the type assigned.
+                if (instruction.operation == OperationID::ASSIGN) {
+                    lhs = std::move(rhs);
+                } else if ((lhs.ActualType() == DatumType::Unknown) || (rhs.ActualType() == DatumType::Unknown)) {
+                    lhs = Datum{};
+                } else {
+                    if (expression._isOptimized && (lhs.Size() == Datum::size_type(1)) && (rhs.Size() == Datum::size_type(1))) {
+                        instruction.opcode = SpecializeBinary(instruction.operation, lhs.ActualType(), rhs.ActualType());
+                    }
+
+                    lhs = (this->*(BINARY_OPERATIONS[static_cast<uint8_t>(instruction.operation)]))(lhs, rhs);
+                }
+
+                break;
+            }
+
+            }
+        }
+
+        if (operands.IsEmpty()) {
+            throw std::invalid_argument("Bad expression, ambiguous result!"s);
+        }
+
+        expression._resultType = operands.Front().ActualType();
+    }
+
+    void ReversePolishEvaluator::Evaluate(const CompiledExpression& expression, Scope& scope, Datum& result) const {
+        using Opcode = CompiledExpression::Opcode;
+        using Value = CompiledExpression::Value;
+
+        if (expression.IsEmpty()) {
+            throw std::invalid_argument("Bad expression, ambiguous result!"s);
+        }
+
+        auto& stack = expression._stack;
+        auto& scratch = expression._scratch;
+
+        while (stack.Size() < expression._maxDepth) {
+            stack.PushBack(Value{});
+        }
+
+        scratch.Clear();
+
+        // Next free slot on the stack.
+        Value* top = &stack.Front();
+        CompiledExpression::Instruction* instruction = &expression._instructions.Front();
+        CompiledExpression::Instruction* const end = instruction + expression._instructions.Size();
+
+        const auto resolve = [this, &expression, &scope, &scratch](std::uint32_t operand) {
+            const auto& path = expression._paths[operand];
+            Datum* extracted = TryExtractDatum(path, scope, path.binding);
+
+            if (extracted == nullptr) {
+                scratch.PushBack(path.token);
+                extracted = &scratch.Back();
+            }
+
+            return extracted;
+        };
+
+#ifdef __REVERSEPOLISHEVALUATOR_THREADED_DISPATCH
+        // One label per opcode, in the order they are declared.
+        static void* const HANDLERS[] = {
+            &&HandlePushConstant, &&HandlePushPath, &&HandlePushValue, &&HandleApplyUnary, &&HandleApplyBinary,
+            &&HandleAddIntegers, &&HandleAddFloats, &&HandleAddVectors,
+            &&HandleSubtractIntegers, &&HandleSubtractFloats, &&HandleSubtractVectors,
+            &&HandleMultiplyIntegers, &&HandleMultiplyFloats, &&HandleDivideFloats,
+            &&HandleIsLessIntegers, &&HandleIsLessFloats, &&HandleIsGreaterIntegers, &&HandleIsGreaterFloats,
+            &&HandleIsEquivalentIntegers, &&HandleAndIntegers, &&HandleOrIntegers
+        };
+        static_assert(std::size(HANDLERS) == static_cast<std::size_t>(Opcode::__Opcode_Count), "Every opcode needs a handler!");
+
+#define __REVERSEPOLISHEVALUATOR_HANDLER(_Opcode) Handle ## _Opcode:
+#define __REVERSEPOLISHEVALUATOR_DISPATCH()                                     \
+        if (++instruction == end) {                                             \
+            goto Done;                                                          \
+        }                                                                       \
+        goto *HANDLERS[static_cast<std::uint8_t>(instruction->opcode)]
+
+        goto *HANDLERS[static_cast<std::uint8_t>(instruction->opcode)];
+        {
+#else
+#define __REVERSEPOLISHEVALUATOR_HANDLER(_Opcode) case Opcode::_Opcode:
+#define __REVERSEPOLISHEVALUATOR_DISPATCH()                                     \
+        ++instruction;                                                          \
+        continue
+
+        while (instruction != end) {
+            switch (instruction->opcode) {
+#endif
+
+// Falls back to the generic operation, and so to its validation, whenever the operands are not the inline types the opcode was specialized to.
+#define __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(_Opcode, _OperandType, _OperandMember, _ResultType, _ResultMember, _Operation)                 \
+        __REVERSEPOLISHEVALUATOR_HANDLER(_Opcode) {                                                                                             \
+            --top;                                                                                                                              \
+            Value& lhs = top[-1];                                                                                                               \
+            Value& rhs = *top;                                                                                                                  \
+                                                                                                                                                \
+            if ((lhs.datum == nullptr) && (rhs.datum == nullptr) && (lhs.type == DatumType::_OperandType) && (rhs.type == DatumType::_OperandType)) { \
+                lhs._ResultMember = (lhs._OperandMember _Operation rhs._OperandMember);                                                          \
+                lhs.type = DatumType::_ResultType;                                                                                              \
+            } else {                                                                                                                            \
+                instruction->opcode = Opcode::ApplyBinary;                                                                                      \
+                ApplyBinary(instruction->operation, lhs, rhs, scratch);                                                                         \
+            }                                                                                                                                   \
+                                                                                                                                                \
+            __REVERSEPOLISHEVALUATOR_DISPATCH();                                                                                                \
+        }
+
+        __REVERSEPOLISHEVALUATOR_HANDLER(PushConstant) {
+            const Datum& constant = expression._constants[instruction->operand];
+
+            if (!TryLoadInline(constant, *top)) {
+                // Copied, since operations like increment modify their input.
+                scratch.PushBack(constant);
+                top->datum = &scratch.Back();
+            }
+
+            ++top;
+            __REVERSEPOLISHEVALUATOR_DISPATCH();
+        }
+
+        __REVERSEPOLISHEVALUATOR_HANDLER(PushPath) {
+            top->datum = resolve(instruction->operand);
+            ++top;
+            __REVERSEPOLISHEVALUATOR_DISPATCH();
+        }
+
+        __REVERSEPOLISHEVALUATOR_HANDLER(PushValue) {
+            Datum* extracted = resolve(instruction->operand);
+
+            if (!TryLoadInline(*extracted, *top)) {
+                top->datum = extracted;
+            }
+
+            ++top;
+            __REVERSEPOLISHEVALUATOR_DISPATCH();
+        }
+
+        __REVERSEPOLISHEVALUATOR_HANDLER(ApplyUnary) {
+            ApplyUnary(instruction->operation, top[-1], scratch);
+            __REVERSEPOLISHEVALUATOR_DISPATCH();
+        }
+
+        __REVERSEPOLISHEVALUATOR_HANDLER(ApplyBinary) {
+            --top;
+
+            // Operand types are only known once seen, so optimized expressions specialize the instruction to the first inline types it is applied to.
+            if (expression._isOptimized && (top[-1].datum == nullptr) && (top->datum == nullptr)) {
+                instruction->opcode = SpecializeBinary(instruction->operation, top[-1].type, top->type);
+            }
+
+            ApplyBinary(instruction->operation, top[-1], *top, scratch);
+            __REVERSEPOLISHEVALUATOR_DISPATCH();
+        }
+
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(AddIntegers, Integer, i, Integer, i, +)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(AddFloats, Float, f, Float, f, +)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(AddVectors, Vector, v, Vector, v, +)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(SubtractIntegers, Integer, i, Integer, i, -)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(SubtractFloats, Float, f, Float, f, -)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(SubtractVectors, Vector, v, Vector, v, -)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(MultiplyIntegers, Integer, i, Integer, i, *)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(MultiplyFloats, Float, f, Float, f, *)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(DivideFloats, Float, f, Float, f, /)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(IsLessIntegers, Integer, i, Integer, i, <)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(IsLessFloats, Float, f, Integer, i, <)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(IsGreaterIntegers, Integer, i, Integer, i, >)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(IsGreaterFloats, Float, f, Integer, i, >)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(IsEquivalentIntegers, Integer, i, Integer, i, ==)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(AndIntegers, Integer, i, Integer, i, &&)
+        __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER(OrIntegers, Integer, i, Integer, i, ||)
+
+#ifdef __REVERSEPOLISHEVALUATOR_THREADED_DISPATCH
+        }
+
+    Done:
+#else
+            default:
+                throw std::runtime_error("Bad expression, unknown opcode!"s);
+            }
+        }
+#endif
+
+#undef __REVERSEPOLISHEVALUATOR_SPECIALIZED_HANDLER
+#undef __REVERSEPOLISHEVALUATOR_DISPATCH
+#undef __REVERSEPOLISHEVALUATOR_HANDLER
+
+        StoreResult(stack[0], result);
+    }
+
+    void ReversePolishEvaluator::Evaluate(const CompiledExpression& expression, gsl::span<Scope* const> contexts, gsl::span<Datum> results) const {
+        using Column = CompiledExpression::Column;
+
+        if (expression.IsEmpty()) {
+            throw std::invalid_argument("Bad expression, ambiguous result!"s);
+        }
+
+        if (results.size() != contexts.size()) {
+            throw std::invalid_argument("Cannot evaluate a batch without one result for each context!"s);
+        }
+
+        const std::size_t count = contexts.size();
+
+        if (count == std::size_t(0)) {
+            return;
+        }
+
+        auto& columns = expression._columns;
+        auto& bindings = expression._batchBindings;
+        auto& scratch = expression._scratch;
+
+        while (columns.Size() < expression._maxDepth) {
+            columns.EmplaceBack();
+        }
+
+        if (bindings.Size() != (expression._paths.Size() * count)) {
+            bindings.Clear();
+            Lanes(bindings, expression._paths.Size() * count);
+        }
+
+        // Instructions run across every context before the next, so a datum one context writes and another uses would only be seen before the write.
+        if (expression._isWriting && IsAnyDatumShared(expression, contexts)) {
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                Evaluate(expression, *contexts[lane], results[lane]);
+            }
+
+            return;
+        }
+
+        scratch.Clear();
+        auto depth = CompiledExpression::size_type(0);
+
+        for (const auto& instruction : expression._instructions) {
+            switch (instruction.opcode) {
+
+            case CompiledExpression::Opcode::PushConstant: {
+                const Datum& constant = expression._constants[instruction.operand];
+                Column& pushed = columns[depth++];
+                CompiledExpression::Value loaded{};
+                const bool isInline = TryLoadInline(constant, loaded);
+
+                if (isInline && (loaded.type == DatumType::Integer)) {
+                    pushed.kind = Column::Kind::Integer;
+                    std::fill_n(Lanes(pushed.integers, count), count, loaded.i);
+                } else if (isInline && (loaded.type == DatumType::Float)) {
+                    pushed.kind = Column::Kind::Float;
+                    std::fill_n(Lanes(pushed.floats, count), count, loaded.f);
+                } else {
+                    pushed.kind = Column::Kind::Value;
+                    auto* values = Lanes(pushed.values, count);
+
+                    for (std::size_t lane = 0; lane < count; ++lane) {
+                        if (!TryLoadInline(constant, values[lane])) {
+                            scratch.PushBack(constant);
+                            values[lane].datum = &scratch.Back();
+                        }
+                    }
+                }
+
+                break;
+            }
+
+            // Each lane reads the path by reference, and the lanes are gathered by value when an operation needs them.
+            case CompiledExpression::Opcode::PushPath:
+            case CompiledExpression::Opcode::PushValue: {
+                const auto& path = expression._paths[instruction.operand];
+                Scope::Binding* pathBindings = &bindings[instruction.operand * count];
+                Column& pushed = columns[depth++];
+                pushed.kind = Column::Kind::Value;
+                auto* values = Lanes(pushed.values, count);
+
+                for (std::size_t lane = 0; lane < count; ++lane) {
+                    Datum* extracted = TryExtractDatum(path, *contexts[lane], pathBindings[lane]);
+
+                    if (extracted == nullptr) {
+                        scratch.PushBack(path.token);
+                        extracted = &scratch.Back();
+                    }
+
+                    values[lane].datum = extracted;
+                }
+
+                break;
+            }
+
+            case CompiledExpression::Opcode::ApplyUnary: {
+                Column& operand = columns[depth - 1];
+
+                if (!TryApplyUnaryColumn(instruction.operation, operand, count)) {
+                    ScatterValues(operand, count);
+                    auto* values = &operand.values.Front();
+
+                    for (std::size_t lane = 0; lane < count; ++lane) {
+                        ApplyUnary(instruction.operation, values[lane], scratch);
+                    }
+                }
+
+                break;
+            }
+
+            // Specialized opcodes carry their operation, and are applied to whole columns like any other binary operation.
+            case CompiledExpression::Opcode::ApplyBinary:
+            default: {
+                --depth;
+                Column& lhs = columns[depth - 1];
+                Column& rhs = columns[depth];
+
+                // Assignments write to each context's own datum, so they are always done context by context.
+                if ((instruction.operation == OperationID::ASSIGN) || !TryApplyBinaryColumns(instruction.operation, lhs, rhs, count)) {
+                    ScatterValues(lhs, count);
+                    ScatterValues(rhs, count);
+                    auto* lhsValues = &lhs.values.Front();
+                    auto* rhsValues = &rhs.values.Front();
+
+                    for (std::size_t lane = 0; lane < count; ++lane) {
+                        ApplyBinary(instruction.operation, lhsValues[lane], rhsValues[lane], scratch);
+                    }
+                }
+
+                break;
+            }
+
+            }
+        }
+
+        Column& result = columns[0];
+        ScatterValues(result, count);
+        const auto* values = &result.values.Front();
+
+        for (std::size_t lane = 0; lane < count; ++lane) {
+            StoreResult(values[lane], results[lane]);
+        }
+    }
+
+    bool ReversePolishEvaluator::IsAnyDatumShared(const CompiledExpression& expression, gsl::span<Scope* const> contexts) const {
+        const std::size_t count = contexts.size();
+        auto& targets = expression._batchTargets;
+        targets.Clear();
+
+        for (CompiledExpression::size_type variable = 0; variable < expression._paths.Size(); ++variable) {
+            Scope::Binding* pathBindings = &expression._batchBindings[variable * count];
+
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                const Datum* extracted = TryExtractDatum(expression._paths[variable], *contexts[lane], pathBindings[lane]);
+
+                if (extracted != nullptr) {
+                    targets.PushBack(std::make_pair(extracted, lane));
+                }
+            }
+        }
+
+        if (targets.IsEmpty()) {
+            return false;
+        }
+
+        // Sorted by datum, so the contexts sharing one are adjacent. A context using one datum through two paths shares it with nobody.
+        auto* first = &targets.Front();
+        auto* last = first + targets.Size();
+        std::sort(first, last);
+
+        return std::adjacent_find(first, last, [](const auto& lhs, const auto& rhs) {
+            return (lhs.first == rhs.first) && (lhs.second != rhs.second);
+        }) != last;
+    }
+
+    bool ReversePolishEvaluator::TryGatherNumbers(CompiledExpression::Column& column, std::size_t count) {
+        using Kind = CompiledExpression::Column::Kind;
+
+        if (column.kind != Kind::Value) {
+            return true;
+        }
+
+        const auto* values = &column.values.Front();
+        auto type = DatumType::Unknown;
+
+        for (std::size_t lane = 0; lane < count; ++lane) {
+            const auto& value = values[lane];
+
+            if ((value.datum != nullptr) && (value.datum->Size() != Datum::size_type(1))) {
+                return false;
+            }
+
+            const DatumType laneType = (value.datum != nullptr) ? value.datum->ActualType() : value.type;
+
+            if (((laneType != DatumType::Integer) && (laneType != DatumType::Float)) || ((lane > 0) && (laneType != type))) {
+                return false;
+            }
+
+            type = laneType;
+        }
+
+        if (type == DatumType::Integer) {
+            auto* integers = Lanes(column.integers, count);
+
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                integers[lane] = (values[lane].datum != nullptr) ? values[lane].datum->CFrontInteger() : values[lane].i;
+            }
+
+            column.kind = Kind::Integer;
+        } else {
+            auto* floats = Lanes(column.floats, count);
+
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                floats[lane] = (values[lane].datum != nullptr) ? values[lane].datum->CFrontFloat() : values[lane].f;
+            }
+
+            column.kind = Kind::Float;
         }
 
-        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::ABS)], &ReversePolishEvaluator::AbsoluteValue));
-        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::COSINE)], &ReversePolishEvaluator::Cosine));
-        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::DECREMENT)], &ReversePolishEvaluator::Decrement));
-        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::DEGTORAD)], &ReversePolishEvaluator::DegToRad));
-        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::INCREMENT)], &ReversePolishEvaluator::Increment));
-        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::NEGATE)], &ReversePolishEvaluator::Negate));
-        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::RADTODEG)], &ReversePolishEvaluator::RadToDeg));
-        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::SINE)], &ReversePolishEvaluator::Sine));
-        _unaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::TANGENT)], &ReversePolishEvaluator::Tangent));
-
-        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::ADDITION)], &ReversePolishEvaluator::Addition));
-        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::AND)], &ReversePolishEvaluator::And));
-        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::ASSIGN)], &ReversePolishEvaluator::Assign));
-        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::DIVISION)], &ReversePolishEvaluator::Division));
-        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::EXPONENT)], &ReversePolishEvaluator::Exponent));
-        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::IS_CONGRUENT)], &ReversePolishEvaluator::IsCongruent));
-        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::IS_EQUIVALENT)], &ReversePolishEvaluator::IsEquivalent));
-        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::IS_GREATER)], &ReversePolishEvaluator::IsGreater));
-        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::IS_LESS)], &ReversePolishEvaluator::IsLess));
-        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::MULTIPLICATION)], &ReversePolishEvaluator::Multiplication));
-        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::OR)], &ReversePolishEvaluator::Or));
-        _binaryOperators.Insert(std::make_pair(operators[static_cast<uint8_t>(OperationID::SUBTRACTION)], &ReversePolishEvaluator::Subtraction));
-    }
-
-    Datum ReversePolishEvaluator::Evaluate(std::string expression, Scope& scope) const {
-        auto anons = Vector<std::unique_ptr<Datum>>{expression.size() / std::size_t(2)};
-        auto stack = Stack<std::reference_wrapper<Datum>>{};
-
-        std::regex extractTokens{"\\s*([^\\s]+)(.*)"};
-        std::regex extractInteger{"^\\d+$"};
-        std::regex extractFloat{"^\\d+\\.\\d+$"};
-
-        std::smatch stringMatches{};
-
-        while (std::regex_match(expression, stringMatches, extractTokens)) {
-            std::string token = stringMatches[1].str();
-            expression = stringMatches[2].str();
+        return true;
+    }
 
-            auto binaryOperator = _binaryOperators.Find(token);
+    void ReversePolishEvaluator::ScatterValues(CompiledExpression::Column& column, std::size_t count) {
+        using Kind = CompiledExpression::Column::Kind;
 
-            if (binaryOperator != _binaryOperators.end()) {
-                const Datum& rhs = *(stack.Top());
-                stack.Pop();
-                Datum& lhs = *(stack.Top());
-                stack.Pop();
-                anons.EmplaceBack(std::make_unique<Datum>((this->*(binaryOperator->second))(lhs, rhs)));
-                stack.Push(std::ref(*(anons.Back())));
-                continue;
+        if (column.kind == Kind::Value) {
+            return;
+        }
+
+        auto* values = Lanes(column.values, count);
+
+        for (std::size_t lane = 0; lane < count; ++lane) {
+            values[lane].datum = nullptr;
+
+            if (column.kind == Kind::Integer) {
+                values[lane].type = DatumType::Integer;
+                values[lane].i = column.integers[lane];
+            } else {
+                values[lane].type = DatumType::Float;
+                values[lane].f = column.floats[lane];
             }
+        }
 
-            auto unaryOperator = _unaryOperators.Find(token);
+        column.kind = Kind::Value;
+    }
 
-            if (unaryOperator != _unaryOperators.end()) {
-                Datum& input = *(stack.Top());
-                stack.Pop();
-                anons.EmplaceBack(std::make_unique<Datum>((this->*(unaryOperator->second))(input)));
-                stack.Push(std::ref(*(anons.Back())));
-                continue;
+    bool ReversePolishEvaluator::TryApplyUnaryColumn(OperationID operationID, CompiledExpression::Column& operand, std::size_t count) {
+        using Kind = CompiledExpression::Column::Kind;
+
+        // Stepping a variable writes through to it, so only lanes already holding copies are stepped here.
+        if ((operationID == OperationID::INCREMENT) || (operationID == OperationID::DECREMENT)) {
+            if (operand.kind != Kind::Integer) {
+                return false;
             }
 
-            if (std::regex_match(token, extractInteger)) {
-                anons.EmplaceBack(std::make_unique<Datum>(std::stoi(token)));
-                stack.Push(std::ref(*(anons.Back())));
-                continue;
+            Datum::Integer* integers = &operand.integers.Front();
+            const Datum::Integer step = (operationID == OperationID::INCREMENT) ? 1 : -1;
+            ForEachLane(integers, integers, count, [step](Datum::Integer i) { return i + step; });
+            return true;
+        }
+
+        if (!TryGatherNumbers(operand, count)) {
+            return false;
+        }
+
+        Datum::Integer* integers = (operand.kind == Kind::Integer) ? &operand.integers.Front() : nullptr;
+        Datum::Float* floats = (operand.kind == Kind::Float) ? &operand.floats.Front() : nullptr;
+
+        switch (operationID) {
+
+        case OperationID::ABS:
+            (integers != nullptr)
+                ? ForEachLane(integers, integers, count, [](Datum::Integer i) { return std::abs(i); })
+                : ForEachLane(floats, floats, count, [](Datum::Float f) { return std::abs(f); });
+            return true;
+
+        case OperationID::NEGATE:
+            (integers != nullptr)
+                ? ForEachLane(integers, integers, count, [](Datum::Integer i) { return (i != 0) ? 0 : 1; })
+                : ForEachLane(floats, floats, count, [](Datum::Float f) { return -f; });
+            return true;
+
+        case OperationID::DEGTORAD:
+            if (integers != nullptr) {
+                ForEachLane(Lanes(operand.floats, count), integers, count, [](Datum::Integer i) { return i * FLOAT_PI / 180.f; });
+                operand.kind = Kind::Float;
+            } else {
+                ForEachLane(floats, floats, count, [](Datum::Float f) { return f * FLOAT_PI / 180.f; });
             }
 
-            if (std::regex_match(token, extractFloat)) {
-                anons.EmplaceBack(std::make_unique<Datum>(std::stof(token)));
-                stack.Push(std::ref(*(anons.Back())));
-                continue;
+            return true;
+
+        case OperationID::RADTODEG:
+        case OperationID::COSINE:
+        case OperationID::SINE:
+        case OperationID::TANGENT:
+            if (floats == nullptr) {
+                return false;
             }
 
-            if (token.substr(0, 1 + Datum::VECTOR_STRING_FORMAT_PREFIX.size()) == Datum::VECTOR_STRING_FORMAT.substr(0, 1 + Datum::VECTOR_STRING_FORMAT_PREFIX.size())) {
-                anons.EmplaceBack(std::make_unique<Datum>());
-                auto* anon = anons.Back().get();
-                anon->SetType(DatumType::Vector);
-                anon->PushBackFromString(token);
-                stack.Push(std::ref(*anon));
-                continue;
+            if (operationID == OperationID::RADTODEG) {
+                ForEachLane(floats, floats, count, [](Datum::Float f) { return f * 180.f / FLOAT_PI; });
+            } else if (operationID == OperationID::COSINE) {
+                ForEachLane(floats, floats, count, [](Datum::Float f) { return std::cosf(f); });
+            } else if (operationID == OperationID::SINE) {
+                ForEachLane(floats, floats, count, [](Datum::Float f) { return std::sinf(f); });
+            } else {
+                ForEachLane(floats, floats, count, [](Datum::Float f) { return std::tanf(f); });
             }
 
-            if (token.substr(0, 1 + Datum::MATRIX_STRING_FORMAT_PREFIX.size()) == Datum::MATRIX_STRING_FORMAT.substr(0, 1 + Datum::MATRIX_STRING_FORMAT_PREFIX.size())) {
-                anons.EmplaceBack(std::make_unique<Datum>());
-                auto* anon = anons.Back().get();
-                anon->SetType(DatumType::Matrix);
-                anon->PushBackFromString(token);
-                stack.Push(std::ref(*anon));
-                continue;
+            return true;
+
+        }
+
+        return false;
+    }
+
+    bool ReversePolishEvaluator::TryApplyBinaryColumns(OperationID operationID, CompiledExpression::Column& lhs, CompiledExpression::Column& rhs, std::size_t count) {
+        using Kind = CompiledExpression::Column::Kind;
+        using Integer = Datum::Integer;
+        using Float = Datum::Float;
+
+        if (!TryGatherNumbers(lhs, count) || !TryGatherNumbers(rhs, count)) {
+            return false;
+        }
+
+        const bool isIntegral = (lhs.kind == Kind::Integer) && (rhs.kind == Kind::Integer);
+
+        // Integers meet floats as floats, just as they do when the operation is done on datums.
+        const auto promote = [count](CompiledExpression::Column& column) {
+            if (column.kind == Kind::Integer) {
+                ForEachLane(Lanes(column.floats, count), &column.integers.Front(), count, [](Integer i) { return static_cast<Float>(i); });
+                column.kind = Kind::Float;
+            }
+        };
+
+        const auto truth = [count](CompiledExpression::Column& column) {
+            if (column.kind == Kind::Float) {
+                ForEachLane(Lanes(column.integers, count), &column.floats.Front(), count, [](Float f) { return (std::fabsf(f) > std::numeric_limits<Float>::epsilon()) ? 1 : 0; });
+                column.kind = Kind::Integer;
+            } else {
+                ForEachLane(&column.integers.Front(), &column.integers.Front(), count, [](Integer i) { return (i != 0) ? 1 : 0; });
+            }
+        };
+
+        switch (operationID) {
+
+        case OperationID::ADDITION:
+        case OperationID::SUBTRACTION:
+        case OperationID::MULTIPLICATION:
+        case OperationID::DIVISION:
+            if (isIntegral) {
+                Integer* l = &lhs.integers.Front();
+                const Integer* r = &rhs.integers.Front();
+
+                switch (operationID) {
+                case OperationID::ADDITION: ForEachLane(l, l, r, count, [](Integer a, Integer b) { return a + b; }); break;
+                case OperationID::SUBTRACTION: ForEachLane(l, l, r, count, [](Integer a, Integer b) { return a - b; }); break;
+                case OperationID::MULTIPLICATION: ForEachLane(l, l, r, count, [](Integer a, Integer b) { return a * b; }); break;
+                default: ForEachLane(l, l, r, count, [](Integer a, Integer b) { return a / b; }); break;
+                }
+            } else {
+                promote(lhs);
+                promote(rhs);
+                Float* l = &lhs.floats.Front();
+                const Float* r = &rhs.floats.Front();
+
+                switch (operationID) {
+                case OperationID::ADDITION: ForEachLane(l, l, r, count, [](Float a, Float b) { return a + b; }); break;
+                case OperationID::SUBTRACTION: ForEachLane(l, l, r, count, [](Float a, Float b) { return a - b; }); break;
+                case OperationID::MULTIPLICATION: ForEachLane(l, l, r, count, [](Float a, Float b) { return a * b; }); break;
+                default: ForEachLane(l, l, r, count, [](Float a, Float b) { return a / b; }); break;
+                }
+            }
+
+            return true;
+
+        case OperationID::MODULUS:
+            if (!isIntegral) {
+                return false;
             }
 
-            Datum* extracted = TryExtractDatum(token, scope);
+            ForEachLane(&lhs.integers.Front(), &lhs.integers.Front(), &rhs.integers.Front(), count, [](Integer a, Integer b) { return a % b; });
+            return true;
 
-            if (extracted != nullptr) {
-                stack.Push(std::ref(*extracted));
+        case OperationID::EXPONENT:
+            if ((lhs.kind != Kind::Float) || (rhs.kind != Kind::Float)) {
+                return false;
+            }
+
+            ForEachLane(&lhs.floats.Front(), &lhs.floats.Front(), &rhs.floats.Front(), count, [](Float a, Float b) { return std::powf(a, b); });
+            return true;
+
+        case OperationID::IS_GREATER:
+        case OperationID::IS_LESS:
+        case OperationID::IS_EQUIVALENT: {
+            if (lhs.kind != rhs.kind) {
+                return false;
+            }
+
+            Integer* result = Lanes(lhs.integers, count);
+
+            if (isIntegral) {
+                const Integer* l = &lhs.integers.Front();
+                const Integer* r = &rhs.integers.Front();
+
+                switch (operationID) {
+                case OperationID::IS_GREATER: ForEachLane(result, l, r, count, [](Integer a, Integer b) { return (a > b) ? 1 : 0; }); break;
+                case OperationID::IS_LESS: ForEachLane(result, l, r, count, [](Integer a, Integer b) { return (a < b) ? 1 : 0; }); break;
+                default: ForEachLane(result, l, r, count, [](Integer a, Integer b) { return (a == b) ? 1 : 0; }); break;
+                }
             } else {
-                anons.EmplaceBack(std::make_unique<Datum>(token));
-                stack.Push(std::ref(*(anons.Back())));
+                const Float* l = &lhs.floats.Front();
+                const Float* r = &rhs.floats.Front();
+
+                switch (operationID) {
+                case OperationID::IS_GREATER: ForEachLane(result, l, r, count, [](Float a, Float b) { return (a > b) ? 1 : 0; }); break;
+                case OperationID::IS_LESS: ForEachLane(result, l, r, count, [](Float a, Float b) { return (a < b) ? 1 : 0; }); break;
+                default: ForEachLane(result, l, r, count, [](Float a, Float b) { return (a == b) ? 1 : 0; }); break;
+                }
             }
+
+            lhs.kind = Kind::Integer;
+            return true;
         }
 
-        if (stack.Size() != decltype(stack)::size_type(1)) {
-            throw std::invalid_argument("Bad expression, ambiguous result!"s);
+        case OperationID::AND:
+        case OperationID::OR:
+            truth(lhs);
+            truth(rhs);
+
+            (operationID == OperationID::AND)
+                ? ForEachLane(&lhs.integers.Front(), &lhs.integers.Front(), &rhs.integers.Front(), count, [](Integer a, Integer b) { return a & b; })
+                : ForEachLane(&lhs.integers.Front(), &lhs.integers.Front(), &rhs.integers.Front(), count, [](Integer a, Integer b) { return a | b; });
+            return true;
+
         }
 
-        return *(stack.Top());
+        return false;
     }
 
-    Datum* ReversePolishEvaluator::TryExtractDatum(std::string path, Scope& scope) const {
-        auto thisKeyIndexEnd = 1 + Scope::THIS_KEY.size();
-        if (path.substr(0, thisKeyIndexEnd) == (Scope::THIS_KEY + "."s)) {
-            return scope.Search(path.substr(thisKeyIndexEnd));
+    bool ReversePolishEvaluator::TryLoadInline(const Datum& datum, CompiledExpression::Value& value) {
+        if (datum.Size() != Datum::size_type(1)) {
+            return false;
         }
 
-        Scope* context = &scope;
-        std::regex extractScopes{"([^\\.]+)\\.(.+)"};
-        std::regex extractIndex{"([^\\.]+)\\[(\\d+)\\]\\.(.+)"};
-        std::smatch stringMatches{};
+        switch (datum.ActualType()) {
+
+        case DatumType::Integer:
+            value.i = datum.CFrontInteger();
+            break;
+
+        case DatumType::Float:
+            value.f = datum.CFrontFloat();
+            break;
+
+        case DatumType::Vector:
+            value.v = datum.CFrontVector();
+            break;
+
+        case DatumType::Matrix:
+            value.m = datum.CFrontMatrix();
+            break;
+
+        default:
+            return false;
+
+        }
+
+        value.datum = nullptr;
+        value.type = datum.ActualType();
+        return true;
+    }
+
+    Datum& ReversePolishEvaluator::Materialize(CompiledExpression::Value& value, SList<Datum>& scratch) {
+        if (value.datum != nullptr) {
+            return *value.datum;
+        }
+
+        scratch.EmplaceBack();
+        Datum& boxed = scratch.Back();
+
+        switch (value.type) {
+
+        case DatumType::Integer:
+            boxed = value.i;
+            break;
+
+        case DatumType::Float:
+            boxed = value.f;
+            break;
+
+        case DatumType::Vector:
+            boxed = value.v;
+            break;
+
+        case DatumType::Matrix:
+            boxed = value.m;
+            break;
+
+        }
+
+        value.datum = &boxed;
+        return boxed;
+    }
+
+    void ReversePolishEvaluator::StoreResult(const CompiledExpression::Value& value, Datum& result) {
+        if (value.datum != nullptr) {
+            if (value.datum != &result) {
+                result = *value.datum;
+            }
+
+            return;
+        }
+
+        // Overwritten in place when possible, since assigning a scalar always reallocates.
+        const bool isReusable = result.IsDataInternal() && (result.Size() == Datum::size_type(1)) && (result.ActualType() == value.type);
+
+        switch (value.type) {
+
+        case DatumType::Integer:
+            isReusable ? result.SetElement(value.i, Datum::size_type(0)) : static_cast<void>(result = value.i);
+            break;
+
+        case DatumType::Float:
+            isReusable ? result.SetElement(value.f, Datum::size_type(0)) : static_cast<void>(result = value.f);
+            break;
+
+        case DatumType::Vector:
+            isReusable ? result.SetElement(value.v, Datum::size_type(0)) : static_cast<void>(result = value.v);
+            break;
+
+        case DatumType::Matrix:
+            isReusable ? result.SetElement(value.m, Datum::size_type(0)) : static_cast<void>(result = value.m);
+            break;
 
-        while (std::regex_match(path, stringMatches, extractScopes)) {
-            std::string name{};
-            int index = 0;
+        }
+    }
+
+    void ReversePolishEvaluator::ApplyUnary(OperationID operationID, CompiledExpression::Value& operand, SList<Datum>& scratch) const {
+        CompiledExpression::Value loaded = operand;
+
+        if ((operand.datum == nullptr) || TryLoadInline(*operand.datum, loaded)) {
+            const bool isStepping = (operationID == OperationID::INCREMENT) || (operationID == OperationID::DECREMENT);
+
+            if (isStepping && (operand.datum != nullptr)) {
+                // Stepping a variable writes through to it.
+                if (loaded.type == DatumType::Integer) {
+                    Datum::Integer& element = operand.datum->GetIntegerElement();
+                    loaded.i = (operationID == OperationID::INCREMENT) ? ++element : --element;
+                    operand = loaded;
+                    return;
+                }
+            } else if (TryApplyUnaryInline(operationID, loaded)) {
+                operand = loaded;
+                return;
+            }
+        }
+
+        Datum result = (this->*(UNARY_OPERATIONS[static_cast<uint8_t>(operationID)]))(Materialize(operand, scratch));
+
+        if (!TryLoadInline(result, operand)) {
+            scratch.PushBack(std::move(result));
+            operand.datum = &scratch.Back();
+        }
+    }
+
+    void ReversePolishEvaluator::ApplyBinary(OperationID operationID, CompiledExpression::Value& lhs, CompiledExpression::Value& rhs, SList<Datum>& scratch) const {
+        CompiledExpression::Value loadedRhs = rhs;
+        const bool isRhsInline = (rhs.datum == nullptr) || TryLoadInline(*rhs.datum, loadedRhs);
+
+        if (operationID == OperationID::ASSIGN) {
+            // Assigning to a single internal element of the same type only overwrites it. Anything else replaces the datum's storage.
+            Datum* target = lhs.datum;
+
+            if (isRhsInline && (target != nullptr) && (target->Parent() != nullptr) && target->IsDataInternal()
+                && (target->Size() == Datum::size_type(1)) && (target->ActualType() == loadedRhs.type)) {
+                StoreResult(loadedRhs, *target);
+                lhs = loadedRhs;
+                return;
+            }
+        } else {
+            CompiledExpression::Value loadedLhs = lhs;
+
+            if (isRhsInline && ((lhs.datum == nullptr) || TryLoadInline(*lhs.datum, loadedLhs)) && TryApplyBinaryInline(operationID, loadedLhs, loadedRhs)) {
+                lhs = loadedLhs;
+                return;
+            }
+        }
+
+        Datum& lhsDatum = Materialize(lhs, scratch);
+        Datum result = (this->*(BINARY_OPERATIONS[static_cast<uint8_t>(operationID)]))(lhsDatum, Materialize(rhs, scratch));
+
+        if (!TryLoadInline(result, lhs)) {
+            scratch.PushBack(std::move(result));
+            lhs.datum = &scratch.Back();
+        }
+    }
+
+    typename ReversePolishEvaluator::CompiledExpression::Opcode ReversePolishEvaluator::SpecializeBinary(OperationID operationID, DatumType lhsType, DatumType rhsType) {
+        using Opcode = CompiledExpression::Opcode;
+
+        if (lhsType != rhsType) {
+            return Opcode::ApplyBinary;
+        }
+
+        const bool isInteger = (lhsType == DatumType::Integer);
+        const bool isFloat = (lhsType == DatumType::Float);
+        const bool isVector = (lhsType == DatumType::Vector);
+
+        switch (operationID) {
+
+        case OperationID::ADDITION:
+            return isInteger ? Opcode::AddIntegers : (isFloat ? Opcode::AddFloats : (isVector ? Opcode::AddVectors : Opcode::ApplyBinary));
+
+        case OperationID::SUBTRACTION:
+            return isInteger ? Opcode::SubtractIntegers : (isFloat ? Opcode::SubtractFloats : (isVector ? Opcode::SubtractVectors : Opcode::ApplyBinary));
+
+        case OperationID::MULTIPLICATION:
+            return isInteger ? Opcode::MultiplyIntegers : (isFloat ? Opcode::MultiplyFloats : Opcode::ApplyBinary);
+
+        case OperationID::DIVISION:
+            return isFloat ? Opcode::DivideFloats : Opcode::ApplyBinary;
+
+        case OperationID::IS_LESS:
+            return isInteger ? Opcode::IsLessIntegers : (isFloat ? Opcode::IsLessFloats : Opcode::ApplyBinary);
+
+        case OperationID::IS_GREATER:
+            return isInteger ? Opcode::IsGreaterIntegers : (isFloat ? Opcode::IsGreaterFloats : Opcode::ApplyBinary);
+
+        case OperationID::IS_EQUIVALENT:
+            return isInteger ? Opcode::IsEquivalentIntegers : Opcode::ApplyBinary;
+
+        case OperationID::AND:
+            return isInteger ? Opcode::AndIntegers : Opcode::ApplyBinary;
+
+        case OperationID::OR:
+            return isInteger ? Opcode::OrIntegers : Opcode::ApplyBinary;
+
+        }
+
+        return Opcode::ApplyBinary;
+    }
+
+    bool ReversePolishEvaluator::TryApplyUnaryInline(OperationID operationID, CompiledExpression::Value& operand) {
+        switch (operationID) {
+
+        case OperationID::ABS:
+            if (operand.type == DatumType::Integer) {
+                operand.i = std::abs(operand.i);
+                return true;
+            }
+
+            if (operand.type == DatumType::Float) {
+                operand.f = std::abs(operand.f);
+                return true;
+            }
+
+            return false;
+
+        case OperationID::COSINE:
+        case OperationID::SINE:
+        case OperationID::TANGENT:
+        case OperationID::RADTODEG:
+            if (operand.type != DatumType::Float) {
+                return false;
+            }
+
+            operand.f = (operationID == OperationID::COSINE) ? std::cosf(operand.f)
+                : ((operationID == OperationID::SINE) ? std::sinf(operand.f)
+                : ((operationID == OperationID::TANGENT) ? std::tanf(operand.f)
+                : (operand.f * 180.f / FLOAT_PI)));
+            return true;
+
+        case OperationID::DEGTORAD:
+            if (operand.type == DatumType::Float) {
+                operand.f = operand.f * FLOAT_PI / 180.f;
+                return true;
+            }
+
+            if (operand.type == DatumType::Integer) {
+                operand.f = operand.i * FLOAT_PI / 180.f;
+                operand.type = DatumType::Float;
+                return true;
+            }
+
+            return false;
+
+        case OperationID::INCREMENT:
+        case OperationID::DECREMENT:
+            if (operand.type != DatumType::Integer) {
+                return false;
+            }
+
+            (operationID == OperationID::INCREMENT) ? ++operand.i : --operand.i;
+            return true;
+
+        case OperationID::NEGATE:
+            switch (operand.type) {
+
+            case DatumType::Integer:
+                operand.i = (operand.i != 0) ? 0 : 1;
+                return true;
+
+            case DatumType::Float:
+                operand.f = -operand.f;
+                return true;
+
+            case DatumType::Vector:
+                operand.v = -operand.v;
+                return true;
+
+            case DatumType::Matrix:
+                operand.m = glm::inverse(operand.m);
+                return true;
+
+            }
+
+            return false;
+
+        }
+
+        return false;
+    }
+
+    bool ReversePolishEvaluator::TryApplyBinaryInline(OperationID operationID, CompiledExpression::Value& lhs, const CompiledExpression::Value& rhs) {
+        const DatumType lhsType = lhs.type;
+        const DatumType rhsType = rhs.type;
+        const bool isLhsNumber = (lhsType == DatumType::Integer) || (lhsType == DatumType::Float);
+        const bool isRhsNumber = (rhsType == DatumType::Integer) || (rhsType == DatumType::Float);
+
+        // Integers meet floats and vectors as floats, just as they do when the operation is done on datums.
+        const Datum::Float lhsNumber = (lhsType == DatumType::Integer) ? static_cast<Datum::Float>(lhs.i) : (isLhsNumber ? lhs.f : 0.f);
+        const Datum::Float rhsNumber = (rhsType == DatumType::Integer) ? static_cast<Datum::Float>(rhs.i) : (isRhsNumber ? rhs.f : 0.f);
+        const bool isIntegral = (lhsType == DatumType::Integer) && (rhsType == DatumType::Integer);
+
+        const auto setInteger = [&lhs](Datum::Integer value) { lhs.i = value; lhs.type = DatumType::Integer; };
+        const auto setFloat = [&lhs](Datum::Float value) { lhs.f = value; lhs.type = DatumType::Float; };
+        const auto setVector = [&lhs](const Datum::Vector& value) { lhs.v = value; lhs.type = DatumType::Vector; };
+        const auto setMatrix = [&lhs](const Datum::Matrix& value) { lhs.m = value; lhs.type = DatumType::Matrix; };
+
+        const auto isTruthy = [](const CompiledExpression::Value& value) {
+            return (value.type == DatumType::Integer) ? (value.i != 0)
+                : ((value.type == DatumType::Float) ? (std::fabsf(value.f) > std::numeric_limits<Datum::Float>::epsilon()) : true);
+        };
+
+        switch (operationID) {
 
-            std::smatch stringIndexMatches{};
+        case OperationID::ADDITION:
+        case OperationID::SUBTRACTION: {
+            const bool isAddition = (operationID == OperationID::ADDITION);
 
-            if (std::regex_match(path, stringIndexMatches, extractIndex)) {
-                name = stringIndexMatches[1].str();
-                index = std::stoi(stringIndexMatches[2].str());
-                path = stringIndexMatches[3].str();
+            if (isLhsNumber && isRhsNumber) {
+                isIntegral ? setInteger(isAddition ? (lhs.i + rhs.i) : (lhs.i - rhs.i)) : setFloat(isAddition ? (lhsNumber + rhsNumber) : (lhsNumber - rhsNumber));
+            } else if ((lhsType == DatumType::Vector) && (rhsType == DatumType::Vector)) {
+                setVector(isAddition ? (lhs.v + rhs.v) : (lhs.v - rhs.v));
+            } else if ((lhsType == DatumType::Matrix) && (rhsType == DatumType::Matrix)) {
+                setMatrix(isAddition ? (lhs.m + rhs.m) : (lhs.m - rhs.m));
             } else {
-                name = stringMatches[1].str();
-                path = stringMatches[2].str();
+                return false;
+            }
+
+            return true;
+        }
+
+        case OperationID::MULTIPLICATION:
+            if (isLhsNumber && isRhsNumber) {
+                isIntegral ? setInteger(lhs.i * rhs.i) : setFloat(lhsNumber * rhsNumber);
+            } else if (isLhsNumber) {
+                (rhsType == DatumType::Vector) ? setVector(lhsNumber * rhs.v) : setMatrix(lhsNumber * rhs.m);
+            } else if (lhsType == DatumType::Vector) {
+                isRhsNumber ? setVector(lhs.v * rhsNumber) : ((rhsType == DatumType::Vector) ? setVector(lhs.v * rhs.v) : setVector(lhs.v * rhs.m));
+            } else if (rhsType == DatumType::Vector) {
+                return false;
+            } else {
+                isRhsNumber ? setMatrix(lhs.m * rhsNumber) : setMatrix(lhs.m * rhs.m);
+            }
+
+            return true;
+
+        case OperationID::DIVISION:
+            if (isLhsNumber && isRhsNumber) {
+                isIntegral ? setInteger(lhs.i / rhs.i) : setFloat(lhsNumber / rhsNumber);
+            } else if ((lhsType == DatumType::Vector) && isRhsNumber) {
+                setVector(lhs.v / rhsNumber);
+            } else if ((lhsType == DatumType::Matrix) && isRhsNumber) {
+                setMatrix(lhs.m / rhsNumber);
+            } else if ((lhsType == DatumType::Matrix) && (rhsType == DatumType::Matrix)) {
+                setMatrix(lhs.m / rhs.m);
+            } else {
+                return false;
+            }
+
+            return true;
+
+        case OperationID::EXPONENT:
+            if ((lhsType != DatumType::Float) || (rhsType != DatumType::Float)) {
+                return false;
+            }
+
+            setFloat(std::powf(lhs.f, rhs.f));
+            return true;
+
+        case OperationID::MODULUS:
+            if (!isIntegral) {
+                return false;
+            }
+
+            setInteger(lhs.i % rhs.i);
+            return true;
+
+        case OperationID::IS_GREATER:
+        case OperationID::IS_LESS:
+            if (!isLhsNumber || (lhsType != rhsType)) {
+                return false;
+            }
+
+            setInteger((operationID == OperationID::IS_GREATER)
+                ? ((isIntegral ? (lhs.i > rhs.i) : (lhs.f > rhs.f)) ? 1 : 0)
+                : ((isIntegral ? (lhs.i < rhs.i) : (lhs.f < rhs.f)) ? 1 : 0));
+            return true;
+
+        case OperationID::IS_EQUIVALENT:
+            if (lhsType != rhsType) {
+                return false;
             }
 
-            auto found = context->Find(name);
+            setInteger(((lhsType == DatumType::Integer) ? (lhs.i == rhs.i)
+                : ((lhsType == DatumType::Float) ? (lhs.f == rhs.f)
+                : ((lhsType == DatumType::Vector) ? (lhs.v == rhs.v) : (lhs.m == rhs.m)))) ? 1 : 0);
+            return true;
+
+        case OperationID::AND:
+            setInteger((isTruthy(lhs) && isTruthy(rhs)) ? 1 : 0);
+            return true;
+
+        case OperationID::OR:
+            setInteger((isTruthy(lhs) || isTruthy(rhs)) ? 1 : 0);
+            return true;
+
+        }
+
+        return false;
+    }
+
+    typename ReversePolishEvaluator::CompiledExpression::Path ReversePolishEvaluator::CompilePath(const std::string& token) {
+        CompiledExpression::Path path{false, Vector<CompiledExpression::PathStep>{}, std::string{}, Datum{token}};
+
+        const auto thisKeyIndexEnd = 1 + Scope::THIS_KEY.size();
+        if (token.substr(0, thisKeyIndexEnd) == (Scope::THIS_KEY + "."s)) {
+            path.isSearchingFromThis = true;
+            path.key = token.substr(thisKeyIndexEnd);
+            return path;
+        }
+
+        std::string_view rest = token;
+        std::string_view name{};
+        std::size_t index = 0;
+
+        while (ExpressionLexer::NextPathStep(rest, name, index)) {
+            path.steps.PushBack(CompiledExpression::PathStep{std::string{name}, index});
+        }
+
+        path.key = std::string{rest};
+        return path;
+    }
+
+    Datum* ReversePolishEvaluator::TryExtractDatum(const CompiledExpression::Path& path, Scope& scope, Scope::Binding& binding) const {
+        if (path.isSearchingFromThis) {
+            return scope.Search(path.key, binding);
+        }
+
+        if (binding.IsCurrent(scope)) {
+            return binding.Get();
+        }
+
+        Scope* context = &scope;
+        Datum* found = nullptr;
+
+        for (const auto& step : path.steps) {
+            auto nested = context->Find(step.name);
 
-            if (found == context->end()) {
-                return nullptr;
+            if (nested == context->end()) {
+                context = nullptr;
+                break;
             }
 
-            context = &(found->second.GetTableElement(index));
+            context = &(nested->second.GetTableElement(step.index));
+        }
+
+        if (context != nullptr) {
+            found = context->Search(path.key);
+
+            if (!context->IsSearchBindable()) {
+                return found;
+            }
         }
 
-        return context->Search(path);
+        binding.Bind(scope, found);
+        return found;
     }
 
     typename ReversePolishEvaluator::DatumType ReversePolishEvaluator::ValidateUnaryInputType(
@@ -579,6 +1950,10 @@ namespace FieaGameEngine {
             predicate = [](const Datum& d1, Datum::size_type i1, const Datum& d2, Datum::size_type i2){ return d1.CGetPointerElement(i1)->Equals(d2.CGetPointerElement(i2)); };
             break;
 
+        case DatumType::Handle:
+            predicate = [](const Datum& d1, Datum::size_type i1, const Datum& d2, Datum::size_type i2){ return d1.CGetHandleElement(i1) == d2.CGetHandleElement(i2); };
+            break;
+
         case DatumType::Table:
         case DatumType::InternalTable:
         case DatumType::ExternalTable:
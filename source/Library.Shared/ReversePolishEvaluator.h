@@ -1,9 +1,11 @@
 #pragma once
 #include <functional>
+#include <gsl/gsl>
 #include "Algorithms.h"
 #include "Datum.h"
 #include "HashMap.h"
 #include "Scope.h"
+#include "SList.h"
 
 #define __REVERSEPOLISHEVALUATOR_FOREACHUNARYDATUMELEMENT_DECLARATION(_DatumType)                                                                                                            \
         Datum ForEachUnary ## _DatumType ## DatumElement(Datum& input, std::function<Datum::_DatumType(Datum::size_type index, Datum::_DatumType& element)> function) const;                 \
@@ -80,21 +82,298 @@ namespace FieaGameEngine {
         static const std::string DEFAULT_SUBTRACTION;
         static const std::string DEFAULT_TANGENT;
 
+        /// <summary>
+        /// Expression compiled once into bytecode, so it can be evaluated many times without being tokenized again.
+        /// Literals are parsed into a constant pool and variable paths are split into their steps ahead of time.
+        /// Each path is bound to the datum it resolves to, and only resolved again when evaluated in another context or once the tree changes.
+        /// When optimized, operations on constants are folded into the pool, and repeated reads of a variable share one path and binding.
+        /// </summary>
+        class CompiledExpression final {
+
+        public:
+            friend class ReversePolishEvaluator;
+
+            using size_type = Vector<Datum>::size_type;
+
+            /// <returns>Does the expression hold no instructions? Default constructed expressions are empty.</returns>
+            [[nodiscard]] bool IsEmpty() const;
+
+            /// <returns>Number of instructions the expression was compiled into.</returns>
+            [[nodiscard]] size_type Size() const;
+
+            /// <returns>Number of distinct variable paths the expression reads or writes.</returns>
+            [[nodiscard]] size_type PathCount() const;
+
+            /// <summary>
+            /// Paths assigned to and then assigned again within the expression, without being read in between.
+            /// Paths are compared by name, so two names for the same datum are not caught.
+            /// </summary>
+            /// <returns>Path of each dead assignment, in the order they were found.</returns>
+            [[nodiscard]] const Vector<std::string>& DeadAssignments() const;
+
+            /// <returns>Type of the result, if it was inferred ahead of time. Unknown if it is only known once evaluated.</returns>
+            [[nodiscard]] Datum::DatumType ResultType() const;
+
+        private:
+            /// <summary>
+            /// Opcodes after ApplyBinary are binary operations specialized to one pair of inline operand types.
+            /// They still carry their operation, so operands of any other types fall back to ApplyBinary.
+            /// </summary>
+            enum class Opcode : uint8_t {
+                PushConstant,
+                PushPath,
+                PushValue,
+                ApplyUnary,
+                ApplyBinary,
+                AddIntegers,
+                AddFloats,
+                AddVectors,
+                SubtractIntegers,
+                SubtractFloats,
+                SubtractVectors,
+                MultiplyIntegers,
+                MultiplyFloats,
+                DivideFloats,
+                IsLessIntegers,
+                IsLessFloats,
+                IsGreaterIntegers,
+                IsGreaterFloats,
+                IsEquivalentIntegers,
+                AndIntegers,
+                OrIntegers,
+                __Opcode_Count
+            };
+
+            struct Instruction final {
+                Opcode opcode;
+                OperationID operation;
+
+                /// <summary>
+                /// Index into the constant pool or into the paths, depending on the opcode.
+                /// PushValue reads its path by value, which is only compiled where nothing could write to the path before the value is used.
+                /// </summary>
+                std::uint32_t operand;
+            };
+
+            struct PathStep final {
+                std::string name;
+                Datum::size_type index;
+            };
+
+            struct Path final {
+                /// <summary>
+                /// Should the key be searched for from the context, instead of walking the steps?
+                /// </summary>
+                bool isSearchingFromThis;
+
+                Vector<PathStep> steps;
+                std::string key;
+
+                /// <summary>
+                /// Token the path was compiled from, which is pushed as a string if the path does not resolve.
+                /// </summary>
+                Datum token;
+
+                /// <summary>
+                /// Datum the path last resolved to, and the context it was resolved in. Reused until the tree changes.
+                /// </summary>
+                mutable Scope::Binding binding{};
+            };
+
+            /// <summary>
+            /// Binary operations of optimized expressions are rewritten to a specialized opcode while evaluating, once their operand types are seen.
+            /// </summary>
+            mutable Vector<Instruction> _instructions{};
+            Vector<Datum> _constants{};
+            Vector<Path> _paths{};
+
+            /// <summary>
+            /// Deepest the operand stack gets while evaluating, so its storage can be reserved up front.
+            /// </summary>
+            size_type _maxDepth{0};
+
+            bool _isOptimized{false};
+
+            /// <summary>
+            /// Does the expression assign to or step any of its operands?
+            /// </summary>
+            bool _isWriting{false};
+
+            Vector<std::string> _deadAssignments{};
+            Datum::DatumType _resultType{Datum::DatumType::Unknown};
+
+            /// <summary>
+            /// Operand on the evaluation stack. Scalars are held inline, anything else by reference to a datum in the context or in the scratch datums.
+            /// </summary>
+            struct Value final {
+                Value() : datum{nullptr}, type{Datum::DatumType::Unknown}, m{} {}
+
+                Datum* datum;
+                Datum::DatumType type;
+
+                union {
+                    Datum::Matrix m;
+                    Datum::Vector v;
+                    Datum::Integer i;
+                    Datum::Float f;
+                };
+            };
+
+            /// <summary>
+            /// Operands of one stack slot across a batch of contexts. Integers and floats are gathered into contiguous lanes, anything else is held per context.
+            /// </summary>
+            struct Column final {
+                enum class Kind : uint8_t {
+                    Integer,
+                    Float,
+                    Value
+                };
+
+                Kind kind{Kind::Value};
+                Vector<Datum::Integer> integers{};
+                Vector<Datum::Float> floats{};
+                Vector<Value> values{};
+            };
+
+            /// <summary>
+            /// Operand stack and datums for operands which are not scalars. Kept between evaluations, so evaluating scalars allocates nothing once the stack has grown.
+            /// </summary>
+            mutable Vector<Value> _stack{};
+            mutable SList<Datum> _scratch{};
+
+            /// <summary>
+            /// Operand stack for batches, and the binding of each path in each context of the last batch, indexed by path and then by context.
+            /// </summary>
+            mutable Vector<Column> _columns{};
+            mutable Vector<Scope::Binding> _batchBindings{};
+
+            /// <summary>
+            /// Datum each path resolved to in each context of the last batch of a writing expression, paired with the index of the context.
+            /// </summary>
+            mutable Vector<std::pair<const Datum*, std::size_t>> _batchTargets{};
+
+        };
+
         ReversePolishEvaluator();
         explicit ReversePolishEvaluator(std::initializer_list<std::pair<OperationID, std::string>> operatorOverrides);
 
         Datum Evaluate(std::string expression) const;
         Datum Evaluate(std::string expression, Scope& scope) const;
 
+        /// <summary>
+        /// Tokenizes the given expression once. Throws an exception if an operator is missing operands, or if the expression does not leave exactly one result.
+        /// </summary>
+        /// <param name="expression">Expression in reverse polish notation.</param>
+        /// <param name="isOptimizing">Should constants be folded and repeated variables share a path? Evaluates the same either way.</param>
+        /// <returns>Compiled expression, which can only be evaluated by this evaluator.</returns>
+        [[nodiscard]] CompiledExpression Compile(const std::string& expression, bool isOptimizing = true) const;
+
+        /// <summary>
+        /// Infers the type of each operand ahead of time, from the prescribed attributes the registry holds for the type of the context.
+        /// Binary operations of optimized expressions on known scalars are specialized now, instead of once they are evaluated, and type errors are thrown now instead of mid-frame.
+        /// Only prescribed attributes with external storage have a fixed type, so auxiliary attributes, nested paths and anything computed from them are still typed when evaluated.
+        /// Specialized operations still check their operands, so the expression can be evaluated in contexts of other types.
+        /// Throws std::invalid_argument if an operation is applied to types it cannot take, or if the expression leaves no result.
+        /// </summary>
+        void InferTypes(CompiledExpression& expression, RTTI::IdType contextType) const;
+
+        /// <summary>
+        /// Evaluates a compiled expression against the given context.
+        /// </summary>
+        Datum Evaluate(const CompiledExpression& expression, Scope& scope) const;
+
+        /// <summary>
+        /// Evaluates a compiled expression against the given context, writing its result into the given datum.
+        /// Scalar operands are never boxed into datums, so scalar expressions allocate nothing once the result already holds a scalar of the same type.
+        /// Instructions are dispatched by computed goto where the compiler supports it, and by a switch otherwise.
+        /// A compiled expression must not be evaluated on more than one thread at once, since its stack and instructions are reused.
+        /// </summary>
+        void Evaluate(const CompiledExpression& expression, Scope& scope, Datum& result) const;
+
+        /// <summary>
+        /// Evaluates a compiled expression against each of the given contexts, writing each result into the datum at the same index.
+        /// Operands are gathered into columns, so operations on integers and floats run as one loop across every context, which the compiler can vectorize.
+        /// Anything else is evaluated context by context. If any context throws, assignments may already have been made in the others.
+        /// Expressions which write are evaluated one whole context at a time instead if any datum they use is shared between contexts,
+        /// such as an attribute of a common parent, so each context sees the writes of those before it, as if each had been evaluated alone.
+        /// </summary>
+        void Evaluate(const CompiledExpression& expression, gsl::span<Scope* const> contexts, gsl::span<Datum> results) const;
+
     private:
         using DatumType = Datum::DatumType;
+        using UnaryOperation = Datum(ReversePolishEvaluator::*)(Datum& input) const;
+        using BinaryOperation = Datum(ReversePolishEvaluator::*)(Datum& lhs, const Datum& rhs) const;
 
         static const std::string TO_STRING_OPERATION_ID[];
 
-        HashMap<std::string, Datum(ReversePolishEvaluator::*)(Datum& input) const> _unaryOperators;
-        HashMap<std::string, Datum(ReversePolishEvaluator::*)(Datum& lhs, const Datum& rhs) const> _binaryOperators;
+        /// <summary>
+        /// Member functions for each operation, indexed by OperationID. Null where the operation does not take that many operands.
+        /// </summary>
+        static const UnaryOperation UNARY_OPERATIONS[];
+        static const BinaryOperation BINARY_OPERATIONS[];
+
+        HashMap<std::string, OperationID> _unaryOperators;
+        HashMap<std::string, OperationID> _binaryOperators;
+
+        /// <returns>Compiled form of the given variable path.</returns>
+        static CompiledExpression::Path CompilePath(const std::string& path);
+
+        /// <returns>Datum the compiled path names within the given context, or nullptr if there is none. Rebinds the binding if it is stale.</returns>
+        Datum* TryExtractDatum(const CompiledExpression::Path& path, Scope& scope, Scope::Binding& binding) const;
+
+        /// <summary>
+        /// Replaces the operation's operands with its result, if they are all constants. Operations that throw are left to throw when evaluated.
+        /// </summary>
+        /// <returns>Was the operation folded?</returns>
+        bool TryFoldConstants(CompiledExpression& compiled, CompiledExpression::Opcode opcode, OperationID operationID) const;
+
+        /// <summary>
+        /// Resolves every path of the expression in every context, binding each in the batch bindings.
+        /// </summary>
+        /// <returns>Does any path resolve to the same datum in more than one context?</returns>
+        bool IsAnyDatumShared(const CompiledExpression& expression, gsl::span<Scope* const> contexts) const;
+
+        /// <summary>
+        /// Loads the datum into the value inline, if it holds a single integer, float, vector or matrix.
+        /// </summary>
+        /// <returns>Was the datum loaded?</returns>
+        static bool TryLoadInline(const Datum& datum, CompiledExpression::Value& value);
+
+        /// <returns>Datum the value refers to, or a scratch datum holding the value if it is inline.</returns>
+        static Datum& Materialize(CompiledExpression::Value& value, SList<Datum>& scratch);
+
+        static void StoreResult(const CompiledExpression::Value& value, Datum& result);
+
+        /// <summary>
+        /// Applies the operation to inline operands, mirroring what the operation on datums would produce.
+        /// </summary>
+        /// <returns>Was the operation applied? If not, it must be done on datums, which also raises any error.</returns>
+        static bool TryApplyUnaryInline(OperationID operationID, CompiledExpression::Value& operand);
+        static bool TryApplyBinaryInline(OperationID operationID, CompiledExpression::Value& lhs, const CompiledExpression::Value& rhs);
+
+        void ApplyUnary(OperationID operationID, CompiledExpression::Value& operand, SList<Datum>& scratch) const;
+        void ApplyBinary(OperationID operationID, CompiledExpression::Value& lhs, CompiledExpression::Value& rhs, SList<Datum>& scratch) const;
+
+        /// <returns>Opcode specialized to the operation on inline operands of the given types, or ApplyBinary if there is none.</returns>
+        static CompiledExpression::Opcode SpecializeBinary(OperationID operationID, DatumType lhsType, DatumType rhsType);
+
+        /// <summary>
+        /// Gathers the column into integer or float lanes, if every context holds a single integer, or every context a single float.
+        /// </summary>
+        /// <returns>Is the column held in integer or float lanes?</returns>
+        static bool TryGatherNumbers(CompiledExpression::Column& column, std::size_t count);
+
+        /// <summary>
+        /// Spreads integer or float lanes back out into values, so the column can be evaluated context by context.
+        /// </summary>
+        static void ScatterValues(CompiledExpression::Column& column, std::size_t count);
 
-        Datum* TryExtractDatum(std::string path, Scope& scope) const;
+        /// <summary>
+        /// Applies the operation across integer and float lanes, mirroring what the operation on each context would produce.
+        /// </summary>
+        /// <returns>Was the operation applied? If not, it must be done context by context, which also raises any error.</returns>
+        static bool TryApplyUnaryColumn(OperationID operationID, CompiledExpression::Column& operand, std::size_t count);
+        static bool TryApplyBinaryColumns(OperationID operationID, CompiledExpression::Column& lhs, CompiledExpression::Column& rhs, std::size_t count);
 
         Datum::DatumType ValidateUnaryInputType(OperationID operationID, const Datum& input, std::initializer_list<DatumType> validTypes) const;
         std::pair<bool, bool> ValidateBinaryInputSizes(OperationID operationID, const Datum& lhs, const Datum& rhs) const;
@@ -8,7 +8,19 @@ namespace FieaGameEngine {
     inline ReversePolishEvaluator::ReversePolishEvaluator()
         : ReversePolishEvaluator{std::initializer_list<std::pair<OperationID, std::string>>{}} {}
 
+    inline bool ReversePolishEvaluator::CompiledExpression::IsEmpty() const { return _instructions.IsEmpty(); }
+    inline typename ReversePolishEvaluator::CompiledExpression::size_type ReversePolishEvaluator::CompiledExpression::Size() const { return _instructions.Size(); }
+    inline typename ReversePolishEvaluator::CompiledExpression::size_type ReversePolishEvaluator::CompiledExpression::PathCount() const { return _paths.Size(); }
+    inline const Vector<std::string>& ReversePolishEvaluator::CompiledExpression::DeadAssignments() const { return _deadAssignments; }
+    inline typename Datum::DatumType ReversePolishEvaluator::CompiledExpression::ResultType() const { return _resultType; }
+
     inline Datum ReversePolishEvaluator::Evaluate(std::string expression) const { Scope _; return Evaluate(std::move(expression), _); }
+    inline Datum ReversePolishEvaluator::Evaluate(std::string expression, Scope& scope) const { return Evaluate(Compile(expression), scope); }
+    inline Datum ReversePolishEvaluator::Evaluate(const CompiledExpression& expression, Scope& scope) const {
+        Datum result{};
+        Evaluate(expression, scope, result);
+        return result;
+    }
 
     inline typename ReversePolishEvaluator::DatumType ReversePolishEvaluator::ValidateBinaryInputSameType(OperationID operationID, const Datum& lhs, const Datum& rhs) const {
         bool _, __;
@@ -2,11 +2,38 @@
 #include "Scope.h"
 
 namespace FieaGameEngine {
+    namespace {
+        inline constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+        inline constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+
+        /// <returns>The given FNV-1a hash, continued over the given bytes.</returns>
+        std::uint64_t HashBytes(std::uint64_t hash, const void* data, std::size_t count) {
+            const auto* bytes = static_cast<const std::uint8_t*>(data);
+
+            for (std::size_t i = std::size_t(0); i < count; ++i) {
+                hash = (hash ^ bytes[i]) * FNV_PRIME;
+            }
+
+            return hash;
+        }
+
+        /// <returns>The given hash, continued over the given value.</returns>
+        std::uint64_t HashValue(std::uint64_t hash, std::uint64_t value) { return HashBytes(hash, &value, sizeof(value)); }
+
+        /// <returns>The given hash with its bits well mixed, so that sums of finalized hashes stay well distributed.</returns>
+        std::uint64_t FinalizeHash(std::uint64_t hash) {
+            hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+            hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+            return hash ^ (hash >> 31);
+        }
+    }
+
     RTTI_DEFINITIONS(Scope);
 
     using namespace std::literals::string_literals;
 
     const typename Scope::key_type Scope::THIS_KEY = "this"s;
+    const typename Scope::size_type Scope::THIS_KEY_HASH_CODE = Scope::KeyHashCode(Scope::THIS_KEY);
 
     Scope::Scope(const Scope& other)
         : RTTI(other)
@@ -43,8 +70,44 @@ namespace FieaGameEngine {
     }
 
     Scope::~Scope() {
+        // Released first, so that handles already resolve to null while the scope is being torn down.
+        if (_handle._generation != std::uint64_t(0)) {
+            ScopeHandle::Release(_handle);
+        }
+
         DetachFromTree();
-        FullClear();
+        DestroyNestedScopes();
+
+        // Only this scope and its descendants can have cached or bound this scope's datums, and they are all being destroyed,
+        // so unlike FullClear this does not invalidate every other search cache. Scopes whose searches find datums of other scopes,
+        // like actions with their arguments, are never bound. Actions also search the top of the action argument
+        // stack, which invalidates their searches itself as arguments are pushed and popped.
+        _array.Clear();
+        _map.Clear();
+
+        // Nested scopes are all gone, so nothing else is destroyed before operator delete reads this.
+        _isDeletingPooled = _isPooled;
+    }
+
+    ScopeHandle Scope::Handle() const {
+        if (_handle._generation == std::uint64_t(0)) {
+            _handle = ScopeHandle::Issue(const_cast<Scope&>(*this));
+        }
+
+        return _handle;
+    }
+
+    void Scope::operator delete(void* pointer, std::size_t size) {
+        // Also reached without a destructor if a constructor throws, in which case the tag is stale, so the pool still checks.
+        if (!_isDeletingPooled || !ObjectPool::Release(pointer)) {
+            ::operator delete(pointer, size);
+        }
+    }
+
+    void Scope::operator delete(void* pointer, std::size_t size, std::align_val_t alignment) {
+        if (!_isDeletingPooled || !ObjectPool::Release(pointer)) {
+            ::operator delete(pointer, size, alignment);
+        }
     }
 
     void Scope::ParentDatumsToThis() {
@@ -54,8 +117,16 @@ namespace FieaGameEngine {
     }
 
     void Scope::FinalizeMove(Scope&& other) noexcept {
+        const bool isSearchable = IsSearchable() || other.IsSearchable();
+        other.MarkContentChanged();
         other.DetachFromTree();
         ParentDatumsToThis();
+
+        // The datums now belong to this scope, so searches bound from the moved-from scope must not find them.
+        // Moving a scope that is still being built leaves every search current.
+        if (isSearchable) {
+            InvalidateSearches();
+        }
     }
 
     void Scope::ForEachNestedScope(IsNestedScopeForEachBreakingFunctor isForEachBreakingFunctor) {
@@ -108,44 +179,227 @@ namespace FieaGameEngine {
         return AppendScope(validated, Factory<Scope>::StaticCreate(classname));
     }
 
+    Scope& Scope::AppendScope(const key_type& key, Factory<Scope>::ClassId classId) {
+        Datum& validated = ValidatedAppendScopeDatum(key);
+        return AppendScope(validated, Factory<Scope>::StaticCreate(classId));
+    }
+
     bool Scope::operator==(const Scope& other) const {
-        if (this == &other) {
-            return true;
+        // Nested scopes are compared from a stack of pending pairs rather than recursively.
+        Vector<std::pair<const Scope*, const Scope*>> pending{};
+        pending.EmplaceBack(this, &other);
+
+        while (!pending.IsEmpty()) {
+            const Scope& lhs = *(pending.Back().first);
+            const Scope& rhs = *(pending.Back().second);
+            pending.PopBack();
+
+            if (&lhs == &rhs) {
+                continue;
+            }
+
+            if ((lhs.Size() != rhs.Size()) || IsContentHashDifferent(lhs, rhs)) {
+                return false;
+            }
+
+            for (const auto& key : rhs._map) {
+                auto found = lhs._map.CFind(key.first);
+
+                if (found == lhs._map.cend()) {
+                    return false;
+                } else {
+                    if (found->first == THIS_KEY) {
+                        continue;
+                    }
+
+                    if (!IsDatumShallowEqual(found->second, key.second, pending)) {
+                        return false;
+                    }
+                }
+            }
         }
 
-        if (Size() != other.Size()) {
-            return false;
+        return true;
+    }
+
+    typename Scope::size_type Scope::ContentHash() const {
+        if (IsContentHashCurrent()) {
+            return _contentHash;
         }
 
-        for (const auto& key : other._map) {
-            auto found = _map.CFind(key.first);
+        // Stale scopes are hashed in post-order from an explicit stack, so each one is hashed after the scopes nested within it.
+        // Nested scopes with a current hash are not descended into.
+        Vector<std::pair<const Scope*, bool>> pending{};
+        pending.EmplaceBack(this, false);
 
-            if (found == _map.cend()) {
-                return false;
-            } else {
-                if (found->first == THIS_KEY) {
+        while (!pending.IsEmpty()) {
+            auto& [scope, isExpanded] = pending.Back();
+
+            if (isExpanded) {
+                scope->UpdateContentHash();
+                pending.PopBack();
+                continue;
+            }
+
+            isExpanded = true;
+            const Scope* expanded = scope;
+
+            for (const auto* pair : expanded->_array) {
+                const Datum& datum = pair->second;
+                const bool isInternalTable = (datum._type == Datum::DatumType::InternalTable);
+
+                if (!isInternalTable && (datum._type != Datum::DatumType::ExternalTable)) {
                     continue;
                 }
 
-                if (found->second != key.second) {
-                    return false;
+                for (auto i = size_type(0); i < datum._size; ++i) {
+                    const Scope* nested = isInternalTable ? (datum._data.t + i)->get() : *(datum._data.x + i);
+
+                    if ((nested != nullptr) && !nested->IsContentHashCurrent()) {
+                        pending.EmplaceBack(nested, false);
+                    }
                 }
             }
         }
 
+        return _contentHash;
+    }
+
+    void Scope::UpdateContentHash() const {
+        std::uint64_t hash = HashValue(FNV_OFFSET_BASIS, Size());
+        bool isVolatile = false;
+        bool isConclusive = true;
+
+        // Pairs are summed, as comparisons do not depend on the order keys were appended in.
+        for (const auto* pair : _array) {
+            const Datum& datum = pair->second;
+            std::uint64_t pairHash = HashBytes(FNV_OFFSET_BASIS, pair->first.data(), pair->first.size());
+
+            // Same as operator==, which never compares the "this" pointer of attributed scopes.
+            if (pair->first != THIS_KEY) {
+                pairHash = HashValue(HashValue(pairHash, static_cast<std::uint64_t>(datum._type)), datum._size);
+
+                switch (datum._type) {
+
+                case Datum::DatumType::Unknown:
+                case Datum::DatumType::Pointer:
+                    // Pointed objects are compared with Equals, which a hash cannot follow.
+                    break;
+
+                case Datum::DatumType::String:
+                    for (auto i = size_type(0); i < datum._size; ++i) {
+                        const Datum::String& element = *(datum._data.s + i);
+                        pairHash = HashBytes(HashValue(pairHash, element.size()), element.data(), element.size());
+                    }
+                    break;
+
+                case Datum::DatumType::InternalTable:
+                case Datum::DatumType::ExternalTable:
+                    for (auto i = size_type(0); i < datum._size; ++i) {
+                        const Scope* nested = (datum._type == Datum::DatumType::InternalTable) ? (datum._data.t + i)->get() : *(datum._data.x + i);
+
+                        if (nested == nullptr) {
+                            isConclusive = false;
+                            pairHash = HashValue(pairHash, std::uint64_t(0));
+                        } else {
+                            isVolatile = isVolatile || nested->_isContentHashVolatile;
+                            isConclusive = isConclusive && nested->_isContentHashConclusive;
+                            pairHash = HashValue(pairHash, nested->_contentHash);
+                        }
+                    }
+                    break;
+
+                default:
+                    pairHash = HashBytes(pairHash, datum._data.vp, datum._size * datum.TypeSize());
+                    break;
+
+                }
+
+                // External storage is written by whoever owns it, such as an archetype store or an attributed instance writing
+                // its own members, without the datum being told. That holds for const storage too, which only the datum cannot write.
+                if (!datum._isDataInternal) {
+                    isVolatile = true;
+                }
+            }
+
+            hash += FinalizeHash(pairHash);
+        }
+
+        _contentHash = static_cast<size_type>(FinalizeHash(hash));
+        _isContentHashValid = true;
+        _isContentHashVolatile = isVolatile;
+        _isContentHashConclusive = isConclusive;
+    }
+
+    bool Scope::IsDatumShallowEqual(const Datum& lhs, const Datum& rhs, Vector<std::pair<const Scope*, const Scope*>>& pending) {
+        const bool isInternalTable = (lhs._type == Datum::DatumType::InternalTable);
+        const bool isExternalTable = (lhs._type == Datum::DatumType::ExternalTable);
+
+        if (!isInternalTable && !isExternalTable) {
+            return lhs == rhs;
+        }
+
+        if ((lhs._type != rhs._type) || (lhs._size != rhs._size)) {
+            return false;
+        }
+
+        if (lhs._data.vp == rhs._data.vp) {
+            return true;
+        }
+
+        for (auto i = size_type(0); i < lhs._size; ++i) {
+            const Scope* lhsNested = isInternalTable ? (lhs._data.t + i)->get() : *(lhs._data.x + i);
+            const Scope* rhsNested = isInternalTable ? (rhs._data.t + i)->get() : *(rhs._data.x + i);
+
+            if ((lhsNested == rhsNested) || (lhsNested == nullptr)) {
+                continue;
+            }
+
+            // Same as Scope::Equals, with the comparison itself deferred.
+            if ((rhsNested == nullptr) || !rhsNested->Is(lhsNested->TypeIdInstance())) {
+                return false;
+            }
+
+            pending.EmplaceBack(lhsNested, rhsNested);
+        }
+
         return true;
     }
 
     typename Datum* Scope::Search(const key_type& key, Scope*& outputContainingScope) {
-        auto found = Find(key);
+        if (_searchCache == nullptr) {
+            _searchCache = std::make_unique<SearchCache>();
+            _searchCache->generation = _searchGeneration;
+        } else if (_searchCache->generation != _searchGeneration) {
+            _searchCache->results.Clear();
+            _searchCache->generation = _searchGeneration;
+        }
+
+        auto& results = _searchCache->results;
+        const size_type hashCode = results.HashCode(key);
+        auto cached = results.FindWithHashCode(key, hashCode);
 
-        if (found == end()) {
-            outputContainingScope = _parent;
-            return (_parent == nullptr) ? nullptr : _parent->Search(key, outputContainingScope);
+        if (cached != results.end()) {
+            outputContainingScope = cached->second.first;
+            return cached->second.second;
         }
 
-        outputContainingScope = this;
-        return &(found->second);
+        Datum* datum = nullptr;
+        outputContainingScope = nullptr;
+
+        for (Scope* scope = this; scope != nullptr; scope = scope->_parent) {
+            scope->_isSearchedThrough = true;
+            auto found = scope->Find(key);
+
+            if (found != scope->end()) {
+                outputContainingScope = scope;
+                datum = &(found->second);
+                break;
+            }
+        }
+
+        results.InsertWithHashCode(std::make_pair(key, std::make_pair(outputContainingScope, datum)), hashCode);
+        return datum;
     }
 
     void Scope::AttachAsChild(const key_type& key, Scope&& child, bool& outputDidDetachFromOtherParent) {
@@ -168,21 +422,40 @@ namespace FieaGameEngine {
         AppendScope(ValidatedAppendScopeDatum(key), std::forward<ScopeUniquePointer>(child));
     }
 
+    std::pair<Datum*, typename Scope::size_type> Scope::FindPositionInParent() {
+        assert(_parent != nullptr);
+        Datum* datum = _containingDatum;
+
+        if ((datum != nullptr)
+            && (datum->_parent == _parent)
+            && (datum->ActualType() == Datum::DatumType::InternalTable)
+            && (_containingIndex < datum->Size())
+            && ((datum->_data.t + _containingIndex)->get() == this)
+        ) {
+            return std::make_pair(datum, _containingIndex);
+        }
+
+        return _parent->FindContainingDatum(*this);
+    }
+
     void Scope::DetachFromTree() {
         if (_parent != nullptr) {
-            auto position = _parent->FindContainingDatum(*this);
+            auto position = FindPositionInParent();
+            _parent = nullptr;
+            _containingDatum = nullptr;
+            InvalidateSearches();
 
             if (position.first != nullptr) {
+                // The datum owns this scope, so removing it destroys this scope.
                 position.first->RemoveAt(position.second);
             }
-
-            _parent = nullptr;
         }
     }
 
     bool Scope::TrySetParent(Scope* parent) {
         if ((_parent == nullptr) && (parent != nullptr) && !IsThisOrAncestorOf(*parent)) {
             _parent = parent;
+            InvalidateSearches();
             return true;
         }
 
@@ -190,18 +463,100 @@ namespace FieaGameEngine {
     }
 
     bool Scope::IsDescendantOf(const Scope& other) const {
-        return (_parent != nullptr) && _parent->IsThisOrDescendantOf(other);
+        for (const Scope* ancestor = _parent; ancestor != nullptr; ancestor = ancestor->_parent) {
+            if (ancestor == &other) {
+                return true;
+            }
+        }
+
+        return false;
     }
 
-    void Scope::FullClear() {
-        ForEachNestedScope([](Datum&, Scope& scope, size_type) {
-            scope._parent = nullptr;
-            scope.FullClear();
-            return false;
-        });
+    void Scope::ForEachScopeInTree(IsScopeVisitBreakingFunctor isVisitBreakingFunctor, TraversalOrder order) {
+        // Each frame holds the position of the next nested scope to visit, re-checked against the datum every step.
+        struct Frame final {
+            Scope* scope;
+            size_type pairIndex;
+            size_type elementIndex;
+        };
+
+        if ((order == TraversalOrder::PreOrder) && isVisitBreakingFunctor(*this, size_type(0))) {
+            return;
+        }
+
+        Vector<Frame> frames{};
+        frames.EmplaceBack(Frame{this, size_type(0), size_type(0)});
+
+        while (!frames.IsEmpty()) {
+            Frame& frame = frames.Back();
+            Scope* nested = nullptr;
+
+            while ((nested == nullptr) && (frame.pairIndex < frame.scope->Size())) {
+                Datum& datum = frame.scope->_array[frame.pairIndex]->second;
+
+                if ((datum.ActualType() == Datum::DatumType::InternalTable) && (frame.elementIndex < datum.Size())) {
+                    if (datum.IsElementRetrievable(frame.elementIndex)) {
+                        nested = &(datum.GetTableElement(frame.elementIndex));
+                    }
+
+                    ++frame.elementIndex;
+                } else {
+                    ++frame.pairIndex;
+                    frame.elementIndex = size_type(0);
+                }
+            }
 
+            if (nested != nullptr) {
+                if ((order == TraversalOrder::PreOrder) && isVisitBreakingFunctor(*nested, frames.Size())) {
+                    return;
+                }
+
+                frames.EmplaceBack(Frame{nested, size_type(0), size_type(0)});
+            } else {
+                Scope& visited = *(frame.scope);
+                frames.PopBack();
+
+                if ((order == TraversalOrder::PostOrder) && isVisitBreakingFunctor(visited, frames.Size())) {
+                    return;
+                }
+            }
+        }
+    }
+
+    void Scope::FullClear() {
+        // Destroying a datum unparents each nested scope before deleting it, so nested scopes do not detach themselves one by one.
+        DestroyNestedScopes();
         _array.Clear();
         _map.Clear();
+        InvalidateSearches();
+        MarkContentChanged();
+    }
+
+    void Scope::DestroyNestedScopes() {
+        bool isNesting = false;
+
+        for (const auto* pair : _array) {
+            if ((pair->second.ActualType() == Datum::DatumType::InternalTable) && !pair->second.IsEmpty()) {
+                isNesting = true;
+                break;
+            }
+        }
+
+        if (!isNesting) {
+            return;
+        }
+
+        // In post-order every scope nested within the visited scope has already been emptied, so clearing its tables
+        // only destroys leaves and no destructor recurses further.
+        ForEachScopeInTree([](Scope& scope, size_type) {
+            for (auto* pair : scope._array) {
+                if (pair->second.ActualType() == Datum::DatumType::InternalTable) {
+                    pair->second.Clear();
+                }
+            }
+
+            return false;
+        }, TraversalOrder::PostOrder);
     }
 
     std::string Scope::ElementToString(size_type index) const {
@@ -214,17 +569,69 @@ namespace FieaGameEngine {
     std::string Scope::ToString() const {
         using namespace std::literals::string_literals;
 
+        // Builds the same string as formatting each pair with ElementToString, but expands nested plain scopes
+        // from an explicit stack. Nested scopes of other types may override ToString, so they are asked for their own.
+        struct Frame final {
+            const Scope* scope;
+            size_type pairIndex;
+            size_type step;
+        };
+
+        Vector<Frame> frames{};
+        frames.EmplaceBack(Frame{this, size_type(0), size_type(0)});
+
         String s = "{ "s;
 
-        if (Size() >= size_type(1)) {
-            s += "pair"s + ElementToString(size_type(0));
-        }
+        while (!frames.IsEmpty()) {
+            Frame& frame = frames.Back();
 
-        for (size_type index = size_type(1); index < Size(); ++index) {
-            s += ", pair"s + ElementToString(index);
-        }
+            if (frame.pairIndex == frame.scope->Size()) {
+                s += " }"s;
+                frames.PopBack();
+                continue;
+            }
+
+            const auto* pair = frame.scope->_array[frame.pairIndex];
+            const Datum& datum = pair->second;
+            const bool isTable = (datum.ActualType() == Datum::DatumType::InternalTable) || (datum.ActualType() == Datum::DatumType::ExternalTable);
 
-        s += " }"s;
+            if (frame.step == size_type(0)) {
+                s += ((frame.pairIndex == size_type(0)) ? "pair{ \""s : ", pair{ \""s) + pair->first + "\": "s;
+
+                if (!isTable) {
+                    s += datum.ToString() + " }"s;
+                    ++frame.pairIndex;
+                    continue;
+                }
+
+                s += "[ "s;
+                ++frame.step;
+            }
+
+            // Step `n` writes element `n - 1` of the table.
+            const size_type index = frame.step - size_type(1);
+
+            if (index == datum.Size()) {
+                s += " ] }"s;
+                ++frame.pairIndex;
+                frame.step = size_type(0);
+                continue;
+            }
+
+            if (index > size_type(0)) {
+                s += ", "s;
+            }
+
+            ++frame.step;
+            const Scope& nested = datum.CGetTableElement(index);
+
+            if (nested.TypeIdInstance() == Scope::TypeIdClass()) {
+                s += "{ "s;
+                frames.EmplaceBack(Frame{&nested, size_type(0), size_type(0)});
+            } else {
+                s += nested.ToString();
+            }
+        }
 
         return s;
     }
@@ -232,6 +639,9 @@ namespace FieaGameEngine {
     void Scope::swap(Scope& other) {
         _map.swap(other._map);
         _array.swap(other._array);
+        InvalidateSearches();
+        MarkContentChanged();
+        other.MarkContentChanged();
         ParentDatumsToThis();
         other.ParentDatumsToThis();
     }
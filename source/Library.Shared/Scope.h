@@ -13,6 +13,16 @@ namespace FieaGameEngine {
         // Datum is our friend :)
         friend class Datum;
 
+        // Prototypes record and rebuild scopes in order, with cached hash codes.
+        friend class ScopePrototype;
+
+        // The binary serializer writes and reads scopes in order, with cached hash codes.
+        friend class ScopeBinaryWriter;
+        friend class ScopeBinaryReader;
+
+        // The pool tags the scopes it constructs, so only those are handed back to it.
+        friend class ObjectPool;
+
         using ScopeUniquePointer = Datum::InternalTablePointer;
         using String = Datum::String;
         using key_type = String;
@@ -27,6 +37,81 @@ namespace FieaGameEngine {
         Vector<value_type*> _array{};
         Scope* _parent{nullptr};
 
+    private:
+        /// <summary>
+        /// Datum of the parent which owns this scope, and the index of this scope within it. Kept up to date by the datum,
+        /// so that detaching from the tree does not need to search the parent.
+        /// </summary>
+        Datum* _containingDatum{nullptr};
+        size_type _containingIndex{0};
+
+        /// <summary>
+        /// Results of previous searches started from this scope, including misses. Discarded once the search generation changes.
+        /// </summary>
+        struct SearchCache final {
+            size_type generation{0};
+            HashMap<key_type, std::pair<Scope*, Datum*>> results{MAX_HASH_VAL};
+        };
+
+        std::unique_ptr<SearchCache> _searchCache{};
+
+        /// <summary>
+        /// Set once a search has passed through this scope, after which cached searches may depend on which keys it has.
+        /// </summary>
+        bool _isSearchedThrough{false};
+
+        /// <summary>
+        /// Cleared for scopes whose searches can find datums that do not belong to the tree, which bindings cannot tell have gone.
+        /// </summary>
+        bool _isSearchBindable{true};
+
+        /// <summary>
+        /// Content hash of this scope and every scope nested within it, as of the last call to ContentHash.
+        /// Invalidated along the chain of parents whenever a datum of this scope or of a nested scope changes.
+        /// </summary>
+        mutable size_type _contentHash{0};
+        mutable bool _isContentHashValid{false};
+
+        /// <summary>
+        /// Set when this scope, or a scope nested within it, has datums with external storage. Such storage can change
+        /// without any datum being told, so the cached hash of a volatile scope is never reused.
+        /// </summary>
+        mutable bool _isContentHashVolatile{false};
+
+        /// <summary>
+        /// Cleared when this scope, or a scope nested within it, holds a null table element. Comparisons skip null elements
+        /// on one side only, so differing hashes do not prove such scopes differ.
+        /// </summary>
+        mutable bool _isContentHashConclusive{false};
+
+        /// <summary>
+        /// Handle issued for this scope, if any. Issued on first request, released as the scope is destroyed.
+        /// </summary>
+        mutable ScopeHandle _handle{};
+
+        /// <summary>
+        /// Set for scopes constructed in a slab by ObjectPool. Never copied or moved, as it describes the memory, not the content.
+        /// </summary>
+        bool _isPooled{false};
+
+        /// <summary>
+        /// Set for scopes which are told through ContentChanged whenever one of their own datums changes. Never copied or moved,
+        /// as it describes the object, not the content.
+        /// </summary>
+        bool _isObservingContent{false};
+
+        /// <summary>
+        /// Whether the scope most recently destroyed on this thread was pooled. The destructor sets it last, right before
+        /// operator delete runs, so that deleting a scope which was not pooled never searches the pool.
+        /// </summary>
+        inline static thread_local bool _isDeletingPooled{false};
+
+        /// <summary>
+        /// Incremented whenever any scope gains or loses a key, or is reparented, moved or destroyed as a table element,
+        /// which makes every search cache and binding stale.
+        /// </summary>
+        inline static size_type _searchGeneration{0};
+
     public:
         /// <summary>
         /// Random-access iterator of the scope. This iterator is non-const.
@@ -38,6 +123,35 @@ namespace FieaGameEngine {
         /// </summary>
         using const_iterator = decltype(_map)::const_iterator;
 
+        /// <summary>
+        /// Datum found by a search from some scope, which can be reused without searching again for as long as it is current.
+        /// It stops being current once the search generation changes, and is never current for a scope other than the one it was bound from.
+        /// </summary>
+        class Binding final {
+
+        public:
+            /// <returns>Was the binding made from the given scope, with no key added or removed, and no scope reparented or destroyed, since?</returns>
+            [[nodiscard]] bool IsCurrent(const Scope& context) const;
+
+            /// <returns>Bound datum, which is null if the search found nothing.</returns>
+            [[nodiscard]] Datum* Get() const;
+
+            /// <summary>
+            /// Binds the given datum, as found by a search from the given scope.
+            /// </summary>
+            void Bind(const Scope& context, Datum* datum);
+
+        private:
+            /// <summary>
+            /// Handle of the scope the binding was made from. Handles are never reused, so a destroyed scope cannot be mistaken for a new one at its address.
+            /// </summary>
+            ScopeHandle _context{};
+
+            Datum* _datum{nullptr};
+            size_type _generation{0};
+
+        };
+
     private:
         /// <summary>
         /// Helper function which completes the move operation of scopes.
@@ -56,6 +170,75 @@ namespace FieaGameEngine {
         // TODO comment
         void FullClear();
 
+        /// <summary>
+        /// Destroys every scope nested within this one, deepest first, so that no destructor has to recurse into the tree.
+        /// </summary>
+        void DestroyNestedScopes();
+
+        /// <summary>
+        /// Tags a scope just constructed in a slab by ObjectPool.
+        /// </summary>
+        void MarkPooled();
+
+        /// <summary>
+        /// Compares the datums of two scopes without comparing nested scopes, which are instead added to the given pending pairs.
+        /// </summary>
+        [[nodiscard]] static bool IsDatumShallowEqual(const Datum& lhs, const Datum& rhs, Vector<std::pair<const Scope*, const Scope*>>& pending);
+
+        /// <summary>
+        /// Returns the datum of the parent which owns this scope and the index of this scope within it.
+        /// Uses the position recorded by the datum, and only searches the parent when that position is stale.
+        /// </summary>
+        [[nodiscard]] std::pair<Datum*, size_type> FindPositionInParent();
+
+        /// <returns>Can the cached content hash be used as is?</returns>
+        [[nodiscard]] bool IsContentHashCurrent() const;
+
+        /// <returns>Could a cached search or binding depend on the keys of this scope? False only for an unparented scope,
+        /// such as one still being built, that no search has passed through and that has no handle to be bound from.</returns>
+        [[nodiscard]] bool IsSearchable() const;
+
+        /// <summary>
+        /// Recomputes the content hash of this scope alone, from its datums and the current hashes of the scopes nested within it.
+        /// </summary>
+        void UpdateContentHash() const;
+
+        /// <returns>Do the cached hashes of the given scopes prove they are not equal?</returns>
+        [[nodiscard]] static bool IsContentHashDifferent(const Scope& lhs, const Scope& rhs);
+
+    protected:
+        /// <summary>
+        /// Invalidates the cached results of every search. Must be called whenever a key is added or removed, or a scope is reparented.
+        /// </summary>
+        static void InvalidateSearches();
+
+        /// <summary>
+        /// Invalidates the cached results of every search, unless no search can depend on the keys of this scope.
+        /// Must be called whenever this scope gains a key.
+        /// </summary>
+        void InvalidateSearchesThrough() const;
+
+        /// <summary>
+        /// Invalidates the cached content hash of this scope and of its ancestors. Must be called whenever the content of this scope changes.
+        /// </summary>
+        void MarkContentChanged();
+
+        /// <summary>
+        /// Stops searches from this scope from being bound. For classes whose searches look beyond the tree, which does not
+        /// invalidate searches as what they find outside of it comes and goes.
+        /// </summary>
+        void DisableSearchBinding();
+
+        /// <summary>
+        /// Has ContentChanged called whenever a datum of this scope changes, or it gains a key. Changes within nested scopes are not reported.
+        /// </summary>
+        void ObserveContent();
+
+        /// <summary>
+        /// Called whenever the content of this scope changes, once it observes its content. Must not change the content itself.
+        /// </summary>
+        virtual void ContentChanged();
+
     protected:
         /// <summary>
         /// Functor to perform operations on every nested scope. Returns true if the iteration should terminate early.
@@ -78,9 +261,22 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] std::pair<Datum*, size_type> FindContainingDatum(const Scope& scope);
 
+        /// <summary>
+        /// Same as Append, but uses a hash code previously computed by `KeyHashCode` instead of hashing the key again.
+        /// </summary>
+        template <typename... Args> Datum& AppendWithHashCode(const key_type& key, size_type hashCode, Args&&... args);
+
     public:
         static const key_type THIS_KEY;
 
+        /// <summary>
+        /// Hash code of `THIS_KEY`, as returned by `KeyHashCode`.
+        /// </summary>
+        static const size_type THIS_KEY_HASH_CODE;
+
+        /// <returns>The hash code scopes use for the given key. Can be cached to skip hashing when appending.</returns>
+        [[nodiscard]] static size_type KeyHashCode(const key_type& key);
+
         /// <summary>
         /// Default constructor.
         /// </summary>
@@ -94,6 +290,12 @@ namespace FieaGameEngine {
         Scope& operator=(Scope&&) noexcept;
         virtual ~Scope();
 
+        /// <summary>
+        /// Deallocates a scope. Scopes created in slabs by Factory::CreateMany are handed back to ObjectPool instead.
+        /// </summary>
+        static void operator delete(void* pointer, std::size_t size);
+        static void operator delete(void* pointer, std::size_t size, std::align_val_t alignment);
+
         /// <summary>
         /// Creates a datum within the scope at the given key. If the key is already in use,
         /// the existing datum is returned.
@@ -126,9 +328,20 @@ namespace FieaGameEngine {
         /// </summary>
         const Datum& operator[](size_type index) const;
 
+        /// <summary>
+        /// Compares the datums of both scopes and every scope nested within them. When both scopes have a current content hash,
+        /// scopes with differing hashes are found unequal without being walked.
+        /// </summary>
         [[nodiscard]] bool operator==(const Scope& other) const;
         [[nodiscard]] bool operator!=(const Scope& other) const;
 
+        /// <summary>
+        /// Hash of the datums of this scope and of every scope nested within it, independent of the order of keys.
+        /// Equal scopes have equal hashes. Cached per scope, so after a change only the changed scopes and their ancestors are rehashed.
+        /// Element references retrieved before a change must not be written through afterwards, since the scope is not told.
+        /// </summary>
+        [[nodiscard]] size_type ContentHash() const;
+
         /// <returns>Reference to the datum at the given position, with bounds checking.</returns>
         [[nodiscard]] Datum& At(const key_type& key);
 
@@ -162,6 +375,14 @@ namespace FieaGameEngine {
         /// <returns>Reference to the newly appended scope.</returns>
         Scope& AppendScope(const key_type& key, const std::string& classname);
 
+        /// <summary>
+        /// Appends a new scope at the given position. If the given key is already in use, a new scope is appended
+        /// alongside any existing ones at the same key.
+        /// </summary>
+        /// <param name="classId"> - Id of the Scope-derived class which should be instantiated, as resolved by Factory::FindClassId.</param>
+        /// <returns>Reference to the newly appended scope.</returns>
+        Scope& AppendScope(const key_type& key, Factory<Scope>::ClassId classId);
+
         /// <returns>Does the scope contain a datum mapped to the given key?</returns>
         [[nodiscard]] bool IsContainingKey(const key_type& key) const;
 
@@ -182,6 +403,8 @@ namespace FieaGameEngine {
 
         /// <summary>
         /// Searches within the local scope and all parent scopes to find an element mapped to the given key.
+        /// The result, found or not, is cached until a key is added to or removed from any scope, or any scope is reparented,
+        /// so repeated searches from the same scope are a single lookup. Parent scopes are walked directly, without their overrides.
         /// </summary>
         /// <param name="outputContainingScope"> - Output parameter. Pointer to the scope which locally contains the element.</param>
         [[nodiscard]] virtual Datum* Search(const key_type& key, Scope*& outputContainingScope);
@@ -201,6 +424,21 @@ namespace FieaGameEngine {
         /// </summary>
         [[nodiscard]] const Datum* Search(const key_type& key) const;
 
+        /// <summary>
+        /// Searches within the local scope and all parent scopes to find an element mapped to the given key,
+        /// unless the given binding is current for this scope. The binding is updated with the result, if this scope's searches are bindable.
+        /// </summary>
+        [[nodiscard]] Datum* Search(const key_type& key, Binding& binding);
+
+        /// <summary>
+        /// Searches within the local scope and all parent scopes to find an element mapped to the given key,
+        /// unless the given binding is current for this scope. The binding is updated with the result, if this scope's searches are bindable.
+        /// </summary>
+        [[nodiscard]] const Datum* CSearch(const key_type& key, Binding& binding) const;
+
+        /// <returns>Can the results of searches from this scope be bound? False if they may find datums outside of the tree.</returns>
+        [[nodiscard]] bool IsSearchBindable() const;
+
         /// <summary>
         /// Attaches the given scope to this scope as a child. Cannot be used to create cyclic dependencies,
         /// and if the child had a different parent it will be removed from that parent before being added
@@ -274,12 +512,44 @@ namespace FieaGameEngine {
         /// <returns>Is this scope the same as or an ancestor of the given scope?</returns>
         [[nodiscard]] bool IsThisOrAncestorOf(const Scope& scope) const;
 
+        /// <summary>
+        /// Order in which `ForEachScopeInTree` visits scopes. Pre-order visits a scope before the scopes nested within it,
+        /// post-order visits it after them.
+        /// </summary>
+        enum class TraversalOrder { PreOrder, PostOrder };
+
+        /// <summary>
+        /// Functor to perform operations on a scope within a tree, given its depth below the scope the traversal started from.
+        /// Returns true if the traversal should terminate early.
+        /// </summary>
+        using IsScopeVisitBreakingFunctor = std::function<bool(Scope&, size_type)>;
+
+        /// <summary>
+        /// Performs the given operation on this scope and every scope nested within it, depth first and in the given order.
+        /// Uses an explicit stack instead of recursion, so trees of any depth can be traversed. Scopes nested into a scope
+        /// during its pre-order visit are visited as well. If the functor returns `true`, the traversal terminates early.
+        /// </summary>
+        void ForEachScopeInTree(IsScopeVisitBreakingFunctor isVisitBreakingFunctor, TraversalOrder order = TraversalOrder::PreOrder);
+
+        /// <summary>
+        /// Returns a handle to this scope, which resolves to it for as long as it lives, wherever it is moved within the tree.
+        /// The first call issues the handle, later calls return the same one. Copies and moved-to scopes get handles of their own.
+        /// </summary>
+        [[nodiscard]] ScopeHandle Handle() const;
+
         /// <summary>
         /// Clones this object.
         /// </summary>
         /// <returns>A pointer to the heap allocated clone. The caller is responsible for deleting this object.</returns>
         [[nodiscard]] virtual ScopeUniquePointer Clone() const;
 
+        /// <summary>
+        /// Clones this object, with the datums of the clone sharing their internal arrays with this scope until either side writes to them.
+        /// Cheaper than Clone for copies which are mostly read, such as save states. Storage external to the datums is still copied.
+        /// </summary>
+        /// <returns>A pointer to the heap allocated clone. The caller is responsible for deleting this object.</returns>
+        [[nodiscard]] ScopeUniquePointer Snapshot() const;
+
         /// <summary>
         /// Clears the scope.
         /// </summary>
@@ -3,18 +3,25 @@
 
 namespace FieaGameEngine {
     template <typename... Args> inline Datum& Scope::Append(const key_type& key, Args&&... args) {
+        return AppendWithHashCode(key, KeyHashCode(key), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args> inline Datum& Scope::AppendWithHashCode(const key_type& key, size_type hashCode, Args&&... args) {
         if (key.empty()) {
             using namespace std::literals::string_literals;
 
             throw std::invalid_argument("Cannot append empty key!"s);
         }
 
-        auto found = _map.Find(key);
+        assert(hashCode == _map.HashCode(key));
+        auto found = _map.FindWithHashCode(key, hashCode);
 
         if (found == _map.end()) {
-            found = _map.Insert(std::make_pair(key, Datum{std::forward<Args>(args)...}));
+            found = _map.InsertWithHashCode(std::make_pair(key, Datum{std::forward<Args>(args)...}), hashCode);
             found->second.SetAndPromulgateParent(this);
             _array.EmplaceBack(&(*found));
+            InvalidateSearchesThrough();
+            MarkContentChanged();
         }
 
         return found->second;
@@ -22,6 +29,33 @@ namespace FieaGameEngine {
 
     inline Scope::Scope(size_type capacity, GrowCapacityFunctorType functor) : _array{capacity, functor} {}
 
+    inline typename Scope::size_type Scope::KeyHashCode(const key_type& key) { return DefaultHash<key_type>{}(key); }
+
+    inline void Scope::InvalidateSearches() { ++_searchGeneration; }
+    inline void Scope::InvalidateSearchesThrough() const { if (IsSearchable()) { InvalidateSearches(); } }
+
+    inline void Scope::MarkContentChanged() {
+        if (_isObservingContent) {
+            ContentChanged();
+        }
+
+        // A valid hash implies the hashes nested within it were valid when it was computed, so the walk can stop at the first invalid one.
+        for (Scope* scope = this; (scope != nullptr) && scope->_isContentHashValid; scope = scope->_parent) {
+            scope->_isContentHashValid = false;
+        }
+    }
+
+    inline void Scope::MarkPooled() { _isPooled = true; }
+
+    inline bool Scope::IsContentHashCurrent() const { return _isContentHashValid && !_isContentHashVolatile; }
+    inline bool Scope::IsSearchable() const { return (_parent != nullptr) || _isSearchedThrough || (_handle._generation != std::uint64_t(0)); }
+
+    inline bool Scope::IsContentHashDifferent(const Scope& lhs, const Scope& rhs) {
+        return lhs.IsContentHashCurrent() && rhs.IsContentHashCurrent()
+            && lhs._isContentHashConclusive && rhs._isContentHashConclusive
+            && (lhs._contentHash != rhs._contentHash);
+    }
+
     inline Datum& Scope::operator[](const key_type& key) { return Append(key); }
     inline const Datum& Scope::operator[](const key_type& key) const { return _map[key]; }
     inline Datum& Scope::operator[](size_type index) { return _array[index]->second; }
@@ -45,6 +79,27 @@ namespace FieaGameEngine {
     inline Datum* Scope::Search(const key_type& key) { Scope* _; return Search(key, _); }
     inline const Datum* Scope::CSearch(const key_type& key) const { return const_cast<const Datum*>((const_cast<Scope*>(this))->Search(key)); }
     inline const Datum* Scope::Search(const key_type& key) const { return CSearch(key); }
+
+    inline Datum* Scope::Search(const key_type& key, Binding& binding) {
+        if (!_isSearchBindable) {
+            return Search(key);
+        }
+
+        if (!binding.IsCurrent(*this)) {
+            binding.Bind(*this, Search(key));
+        }
+
+        return binding.Get();
+    }
+    inline const Datum* Scope::CSearch(const key_type& key, Binding& binding) const { return const_cast<Scope*>(this)->Search(key, binding); }
+    inline bool Scope::IsSearchBindable() const { return _isSearchBindable; }
+    inline void Scope::DisableSearchBinding() { _isSearchBindable = false; }
+    inline void Scope::ObserveContent() { _isObservingContent = true; }
+    inline void Scope::ContentChanged() {}
+
+    inline bool Scope::Binding::IsCurrent(const Scope& context) const { return (_generation == _searchGeneration) && (_context == context.Handle()); }
+    inline Datum* Scope::Binding::Get() const { return _datum; }
+    inline void Scope::Binding::Bind(const Scope& context, Datum* datum) { _context = context.Handle(); _datum = datum; _generation = _searchGeneration; }
     inline void Scope::AttachAsChild(const key_type& key, Scope&& child) { bool _; AttachAsChild(key, std::forward<Scope>(child), _); }
     inline void Scope::AttachAsChild(const key_type& key, ScopeUniquePointer&& child) { bool _; AttachAsChild(key, std::forward<ScopeUniquePointer>(child), _); }
 
@@ -53,6 +108,7 @@ namespace FieaGameEngine {
     inline bool Scope::IsThisOrAncestorOf(const Scope& scope) const { return (this == &scope) || IsAncestorOf(scope); }
 
     inline typename Scope::ScopeUniquePointer Scope::Clone() const { return std::make_unique<Scope>(*this); }
+    inline typename Scope::ScopeUniquePointer Scope::Snapshot() const { Datum::SharingCopies sharing{}; return Clone(); }
     inline bool Scope::Equals(const RTTI* other) const { return RTTI::Equals(other) || (other->Is(TypeIdInstance()) && (operator==(*(other->As<Scope>())))); }
 
     inline Scope* Scope::Parent() const { return _parent; }
@@ -0,0 +1,83 @@
+#pragma once
+#include "Datum.h"
+
+namespace FieaGameEngine {
+    /// <summary>
+    /// Layout of the binary scope format written by ScopeBinaryWriter and read by ScopeBinaryReader.
+    /// A document is a Header, followed by the key table and the class table, each of which is a sequence of
+    /// (u32 length, bytes) strings. The body starts at the next 16 byte boundary and holds the root ScopeRecord.
+    /// Every ScopeRecord is followed by its DatumRecords, and every DatumRecord is followed by `payloadSize` bytes:
+    /// - Integer, Float, Vector and Matrix elements are stored raw, starting at the next 16 byte boundary.
+    /// - String elements are stored as (u32 length, bytes).
+    /// - InternalTable and ExternalTable elements are stored as nested ScopeRecords.
+    /// - Unknown datums have no payload.
+    /// Values are stored in the byte order of the machine which wrote them.
+    /// </summary>
+    struct ScopeBinaryFormat final {
+        using index_type = std::uint32_t;
+
+        /// <summary>
+        /// Identifies a scope binary document.
+        /// </summary>
+        inline static constexpr char MAGIC[4] = {'F', 'S', 'C', 'B'};
+
+        /// <summary>
+        /// Version of the layout described here. Bumped whenever the layout changes.
+        /// </summary>
+        inline static constexpr std::uint16_t VERSION = 1;
+
+        /// <summary>
+        /// Alignment of the body and of every raw payload, within the document.
+        /// </summary>
+        inline static constexpr std::size_t PAYLOAD_ALIGNMENT = 16;
+
+        struct Header final {
+            char magic[4];
+            std::uint16_t version;
+            std::uint16_t reserved;
+            index_type keyCount;
+            index_type classCount;
+        };
+
+        struct ScopeRecord final {
+            index_type classIndex;
+            index_type datumCount;
+        };
+
+        struct DatumRecord final {
+            index_type keyIndex;
+            Datum::DatumType type;
+            std::uint8_t reserved0;
+            std::uint16_t reserved1;
+            index_type count;
+            std::uint32_t reserved2;
+            std::uint64_t payloadSize;
+        };
+
+        static_assert(sizeof(Header) == 16);
+        static_assert(sizeof(ScopeRecord) == 8);
+        static_assert(sizeof(DatumRecord) == 24);
+
+        /// <returns>Number of padding bytes needed to bring the given offset to the next payload boundary.</returns>
+        [[nodiscard]] static constexpr std::size_t PaddingAt(std::uint64_t offset) {
+            return static_cast<std::size_t>((PAYLOAD_ALIGNMENT - (offset % PAYLOAD_ALIGNMENT)) % PAYLOAD_ALIGNMENT);
+        }
+
+        /// <returns>Are elements of the given type stored raw?</returns>
+        [[nodiscard]] static constexpr bool IsRawType(Datum::DatumType type) {
+            return (type == Datum::DatumType::Integer) || (type == Datum::DatumType::Float)
+                || (type == Datum::DatumType::Vector) || (type == Datum::DatumType::Matrix);
+        }
+
+        /// <returns>Size of a single raw element of the given type, or zero if the type is not stored raw.</returns>
+        [[nodiscard]] static constexpr std::size_t RawTypeSize(Datum::DatumType type) {
+            switch (type) {
+            case Datum::DatumType::Integer: return sizeof(Datum::Integer);
+            case Datum::DatumType::Float: return sizeof(Datum::Float);
+            case Datum::DatumType::Vector: return sizeof(Datum::Vector);
+            case Datum::DatumType::Matrix: return sizeof(Datum::Matrix);
+            default: return std::size_t(0);
+            }
+        }
+    };
+}
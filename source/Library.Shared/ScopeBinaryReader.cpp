@@ -0,0 +1,289 @@
+#include "pch.h"
+#include "ScopeBinaryReader.h"
+#include <limits>
+#include "Attributed.h"
+
+using namespace std::literals::string_literals;
+
+namespace FieaGameEngine {
+    typename ScopeBinaryReader::ScopeUniquePointer ScopeBinaryReader::Read() {
+        ReadPreamble();
+        return CreateScope(ReadValue<ScopeBinaryFormat::ScopeRecord>(), _endOffset);
+    }
+
+    void ScopeBinaryReader::ReadInto(Scope& root) {
+        ReadPreamble();
+        const auto record = ReadValue<ScopeBinaryFormat::ScopeRecord>();
+        const std::string& name = FindClass(record.classIndex).name;
+
+        if (name != root.TypeNameInstance()) {
+            throw std::runtime_error("Cannot read "s + name + " into "s + root.TypeNameInstance() + "!"s);
+        }
+
+        ReadScope(record, root, _endOffset);
+    }
+
+    typename ScopeBinaryReader::ScopeUniquePointer ScopeBinaryReader::ReadAt(std::uint64_t offset) {
+        ReadPreamble();
+
+        if (offset < _offset) {
+            throw std::runtime_error("Offset "s + std::to_string(offset) + " is not within the body!"s);
+        }
+
+        SkipBytes(offset - _offset);
+        return CreateScope(ReadValue<ScopeBinaryFormat::ScopeRecord>(), _endOffset);
+    }
+
+    void ScopeBinaryReader::ReadPreamble() {
+        _offset = 0;
+        _keys.Clear();
+        _classes.Clear();
+        _endOffset = std::numeric_limits<std::uint64_t>::max();
+
+        const auto start = _stream.tellg();
+
+        if (start != std::istream::pos_type(-1)) {
+            _stream.seekg(0, std::ios_base::end);
+            const auto end = _stream.tellg();
+            _stream.seekg(start);
+
+            if (end != std::istream::pos_type(-1)) {
+                _endOffset = static_cast<std::uint64_t>(end - start);
+            }
+        }
+
+        const auto header = ReadValue<ScopeBinaryFormat::Header>();
+
+        if (std::memcmp(header.magic, ScopeBinaryFormat::MAGIC, sizeof(header.magic)) != 0) {
+            throw std::runtime_error("Not a scope binary stream!"s);
+        }
+
+        if (header.version != ScopeBinaryFormat::VERSION) {
+            throw std::runtime_error("Cannot read scope binary version "s + std::to_string(header.version) + "!"s);
+        }
+
+        ValidateCount(header.keyCount, sizeof(index_type), _endOffset);
+        _keys.Reserve(header.keyCount);
+        for (auto i = index_type(0); i < header.keyCount; ++i) {
+            std::string key = ReadString(_endOffset);
+            const size_type hashCode = Scope::KeyHashCode(key);
+            _keys.PushBack(KeyEntry{std::move(key), hashCode});
+        }
+
+        ValidateCount(header.classCount, sizeof(index_type), _endOffset);
+        _classes.Reserve(header.classCount);
+        for (auto i = index_type(0); i < header.classCount; ++i) {
+            _classes.PushBack(ClassEntry{ReadString(_endOffset), nullptr, false});
+        }
+
+        SkipBytes(ScopeBinaryFormat::PaddingAt(_offset));
+    }
+
+    void ScopeBinaryReader::ReadBytes(void* destination, std::size_t count) {
+        if (count == std::size_t(0)) {
+            return;
+        }
+
+        _stream.read(static_cast<char*>(destination), static_cast<std::streamsize>(count));
+
+        if (static_cast<std::size_t>(_stream.gcount()) != count) {
+            throw std::runtime_error("Unexpected end of scope binary stream!"s);
+        }
+
+        _offset += count;
+    }
+
+    void ScopeBinaryReader::SkipBytes(std::uint64_t count) {
+        if (count == std::uint64_t(0)) {
+            return;
+        }
+
+        _stream.ignore(static_cast<std::streamsize>(count));
+
+        if (static_cast<std::uint64_t>(_stream.gcount()) != count) {
+            throw std::runtime_error("Unexpected end of scope binary stream!"s);
+        }
+
+        _offset += count;
+    }
+
+    std::string ScopeBinaryReader::ReadString(std::uint64_t endOffset) {
+        const auto length = ReadValue<index_type>();
+        ValidateCount(length, sizeof(char), endOffset);
+
+        std::string value(length, '\0');
+        ReadBytes(value.data(), value.size());
+        return value;
+    }
+
+    void ScopeBinaryReader::ValidateCount(std::uint64_t count, std::size_t elementSize, std::uint64_t endOffset) const {
+        assert(elementSize > std::size_t(0));
+
+        if ((_offset > endOffset) || (count > ((endOffset - _offset) / elementSize))) {
+            throw std::runtime_error("Count "s + std::to_string(count) + " at offset "s + std::to_string(_offset) + " overruns its data!"s);
+        }
+    }
+
+    const typename ScopeBinaryReader::KeyEntry& ScopeBinaryReader::FindKey(index_type index) const {
+        if (index >= _keys.Size()) {
+            throw std::runtime_error("Key index "s + std::to_string(index) + " is out of range!"s);
+        }
+
+        return _keys[index];
+    }
+
+    typename ScopeBinaryReader::ClassEntry& ScopeBinaryReader::FindClass(index_type index) {
+        if (index >= _classes.Size()) {
+            throw std::runtime_error("Class index "s + std::to_string(index) + " is out of range!"s);
+        }
+
+        return _classes[index];
+    }
+
+    typename ScopeBinaryReader::ScopeUniquePointer ScopeBinaryReader::CreateScope(const ScopeBinaryFormat::ScopeRecord& record, std::uint64_t endOffset) {
+        ClassEntry& entry = FindClass(record.classIndex);
+        ValidateCount(record.datumCount, sizeof(ScopeBinaryFormat::DatumRecord), endOffset);
+
+        if (!entry.isResolved) {
+            if (entry.name != Scope::TypeNameClass()) {
+                entry.factory = Factory<Scope>::Find(entry.name);
+
+                if (entry.factory == nullptr) {
+                    throw std::runtime_error("Cannot load "s + entry.name + ", no factory creates it!"s);
+                }
+            }
+
+            entry.isResolved = true;
+        }
+
+        ScopeUniquePointer instance = (entry.factory != nullptr) ? entry.factory->Create() : std::make_unique<Scope>(record.datumCount);
+        ReadScope(record, *instance, endOffset);
+        return instance;
+    }
+
+    void ScopeBinaryReader::ReadScope(const ScopeBinaryFormat::ScopeRecord& record, Scope& target, std::uint64_t endOffset) {
+        ValidateCount(record.datumCount, sizeof(ScopeBinaryFormat::DatumRecord), endOffset);
+
+        // Attributed instances populate "this" themselves, so it is never stored.
+        const size_type firstRead = target.Is(Attributed::TypeIdClass()) ? size_type(1) : size_type(0);
+        target._array.Reserve(firstRead + record.datumCount);
+
+        for (auto i = index_type(0); i < record.datumCount; ++i) {
+            ReadDatum(target, endOffset);
+        }
+    }
+
+    void ScopeBinaryReader::ReadDatum(Scope& target, std::uint64_t endOffset) {
+        const auto record = ReadValue<ScopeBinaryFormat::DatumRecord>();
+        const KeyEntry& key = FindKey(record.keyIndex);
+        const DatumType type = record.type;
+
+        if ((type >= DatumType::__SIZE) || (type == DatumType::Pointer) || (type == DatumType::Handle) || (type == DatumType::Table)) {
+            throw std::runtime_error("Attribute "s + key.key + " has no readable type!"s);
+        }
+
+        const std::uint64_t payloadOffset = _offset;
+
+        if ((payloadOffset > endOffset) || (record.payloadSize > (endOffset - payloadOffset))) {
+            throw std::runtime_error("Attribute "s + key.key + " has a corrupt payload!"s);
+        }
+
+        const std::uint64_t payloadEndOffset = payloadOffset + record.payloadSize;
+        Datum& datum = target.AppendWithHashCode(key.key, key.hashCode);
+        const size_type count = record.count;
+
+        const bool isMismatched = (type == DatumType::ExternalTable)
+            ? ((datum.ActualType() != DatumType::ExternalTable) || (datum.Size() != count))
+            : (!datum.IsDataInternal() && ((datum.ActualType() != type) || (datum.Size() != count)))
+                || ((type != DatumType::Unknown) && (datum.ActualType() != DatumType::Unknown) && (datum.ActualType() != type));
+
+        if (isMismatched) {
+            throw std::runtime_error("Attribute "s + key.key + " of "s + target.TypeNameInstance() + " does not match the stored data!"s);
+        }
+
+        switch (type) {
+
+        case DatumType::Unknown:
+            break;
+
+        case DatumType::InternalTable:
+            ValidateCount(count, sizeof(ScopeBinaryFormat::ScopeRecord), payloadEndOffset);
+            datum.SetType(DatumType::InternalTable);
+            datum.Reserve(datum.Size() + count);
+            for (auto j = size_type(0); j < count; ++j) {
+                datum.PushBack(CreateScope(ReadValue<ScopeBinaryFormat::ScopeRecord>(), payloadEndOffset));
+            }
+            break;
+
+        case DatumType::ExternalTable:
+            ValidateCount(count, sizeof(ScopeBinaryFormat::ScopeRecord), payloadEndOffset);
+            for (auto j = size_type(0); j < count; ++j) {
+                const auto nestedRecord = ReadValue<ScopeBinaryFormat::ScopeRecord>();
+                Scope& nested = datum.GetTableElement(j);
+
+                if (FindClass(nestedRecord.classIndex).name != nested.TypeNameInstance()) {
+                    throw std::runtime_error("Attribute "s + key.key + " of "s + target.TypeNameInstance() + " does not match the stored data!"s);
+                }
+
+                ReadScope(nestedRecord, nested, payloadEndOffset);
+            }
+            break;
+
+        default:
+            if (datum.IsDataInternal()) {
+                if (!datum.IsEmpty()) {
+                    datum.Clear();
+                }
+
+                datum.SetType(type);
+                ReadElements(record, datum, true, payloadEndOffset);
+            } else if (datum.IsDataExternalConst()) {
+                SkipBytes(record.payloadSize);
+            } else {
+                ReadElements(record, datum, false, payloadEndOffset);
+            }
+            break;
+
+        }
+
+        if (_offset != payloadEndOffset) {
+            throw std::runtime_error("Attribute "s + key.key + " has a corrupt payload!"s);
+        }
+    }
+
+    void ScopeBinaryReader::ReadElements(const ScopeBinaryFormat::DatumRecord& record, Datum& datum, bool isAppending, std::uint64_t endOffset) {
+        const size_type count = record.count;
+        const bool isString = record.type == DatumType::String;
+
+        if (!isString) {
+            SkipBytes(ScopeBinaryFormat::PaddingAt(_offset));
+        }
+
+        ValidateCount(count, isString ? sizeof(index_type) : ScopeBinaryFormat::RawTypeSize(record.type), endOffset);
+
+        if (isAppending && (count > size_type(0))) {
+            datum.Reserve(count);
+        }
+
+        if (isString) {
+            for (auto j = size_type(0); j < count; ++j) {
+                if (isAppending) {
+                    datum.PushBack(ReadString(endOffset));
+                } else {
+                    datum._data.s[j] = ReadString(endOffset);
+                }
+            }
+        } else {
+
+            if (count > size_type(0)) {
+                ReadBytes(datum._data.vp, count * datum.TypeSize());
+
+                if (isAppending) {
+                    datum._size = count;
+                }
+            }
+        }
+
+        datum.MarkContentChanged();
+    }
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include <istream>
+#include "ScopeBinaryFormat.h"
+#include "Scope.h"
+#include "Factory.h"
+
+namespace FieaGameEngine {
+    /// <summary>
+    /// Reads scope trees written by ScopeBinaryWriter, streaming records straight from the stream into the new scopes.
+    /// Each key is hashed once per document and each class name is resolved through Factory&lt;Scope&gt; once per document,
+    /// and raw payloads are read directly into datum storage. Scope-derived classes must have a registered factory.
+    /// Any malformed or mismatched input throws a std::runtime_error. Counts and lengths are checked against the bytes left in
+    /// the enclosing payload, or in the stream if it can seek, before anything is allocated for them.
+    /// </summary>
+    class ScopeBinaryReader final {
+
+    public:
+        using size_type = Scope::size_type;
+        using key_type = Scope::key_type;
+        using index_type = ScopeBinaryFormat::index_type;
+        using DatumType = Datum::DatumType;
+        using ScopeUniquePointer = Scope::ScopeUniquePointer;
+
+    private:
+        struct KeyEntry final {
+            key_type key;
+            size_type hashCode;
+        };
+
+        struct ClassEntry final {
+            std::string name;
+            const Factory<Scope>* factory;
+            bool isResolved;
+        };
+
+        std::istream& _stream;
+
+        /// <summary>
+        /// Number of bytes consumed from the start of the document, used to find payload boundaries.
+        /// </summary>
+        std::uint64_t _offset{0};
+
+        /// <summary>
+        /// Offset of the end of the stream from the start of the document, or the largest offset if the stream cannot seek.
+        /// </summary>
+        std::uint64_t _endOffset{0};
+
+        Vector<KeyEntry> _keys{};
+        Vector<ClassEntry> _classes{};
+
+        /// <summary>
+        /// Helper function which reads the header and both tables, leaving the stream at the root record.
+        /// </summary>
+        void ReadPreamble();
+
+        /// <summary>
+        /// Helper function which fills the given buffer from the stream.
+        /// </summary>
+        void ReadBytes(void* destination, std::size_t count);
+
+        /// <summary>
+        /// Helper function which discards bytes from the stream.
+        /// </summary>
+        void SkipBytes(std::uint64_t count);
+
+        /// <summary>
+        /// Helper function which reads a single trivially copyable value from the stream.
+        /// </summary>
+        template <typename T> [[nodiscard]] T ReadValue();
+
+        /// <summary>
+        /// Helper function which reads a length-prefixed string from the stream, which must end before the given offset.
+        /// </summary>
+        [[nodiscard]] std::string ReadString(std::uint64_t endOffset);
+
+        /// <summary>
+        /// Helper function which throws unless the given number of elements, each taking at least the given number of bytes,
+        /// can be read before the given offset.
+        /// </summary>
+        void ValidateCount(std::uint64_t count, std::size_t elementSize, std::uint64_t endOffset) const;
+
+        /// <returns>The key stored at the given index.</returns>
+        [[nodiscard]] const KeyEntry& FindKey(index_type index) const;
+
+        /// <returns>The class stored at the given index.</returns>
+        [[nodiscard]] ClassEntry& FindClass(index_type index);
+
+        /// <summary>
+        /// Helper function which creates and fills the scope described by the given record.
+        /// </summary>
+        [[nodiscard]] ScopeUniquePointer CreateScope(const ScopeBinaryFormat::ScopeRecord& record, std::uint64_t endOffset);
+
+        /// <summary>
+        /// Helper function which reads the datums of a record into an existing scope.
+        /// </summary>
+        void ReadScope(const ScopeBinaryFormat::ScopeRecord& record, Scope& target, std::uint64_t endOffset);
+
+        /// <summary>
+        /// Helper function which reads a single datum and its payload, which must end before the given offset, into the given scope.
+        /// </summary>
+        void ReadDatum(Scope& target, std::uint64_t endOffset);
+
+        /// <summary>
+        /// Helper function which reads a raw or String payload into the given datum's storage.
+        /// </summary>
+        void ReadElements(const ScopeBinaryFormat::DatumRecord& record, Datum& datum, bool isAppending, std::uint64_t endOffset);
+
+    public:
+        /// <summary>
+        /// Constructor. The stream should be opened in binary mode.
+        /// </summary>
+        explicit ScopeBinaryReader(std::istream& stream);
+
+        ScopeBinaryReader(const ScopeBinaryReader&) = delete;
+        ScopeBinaryReader(ScopeBinaryReader&&) = delete;
+        ScopeBinaryReader& operator=(const ScopeBinaryReader&) = delete;
+        ScopeBinaryReader& operator=(ScopeBinaryReader&&) = delete;
+        ~ScopeBinaryReader() = default;
+
+        /// <summary>
+        /// Reads one document, creating its root through the class table.
+        /// </summary>
+        /// <returns>Heap allocated root of the new tree, which has no parent.</returns>
+        [[nodiscard]] ScopeUniquePointer Read();
+
+        /// <summary>
+        /// Reads one document into the given scope, which must be of the same class as the root that was written.
+        /// Values of attributes the scope already has are replaced, prescribed ones in place, and nested scopes are appended.
+        /// </summary>
+        void ReadInto(Scope& root);
+
+        /// <summary>
+        /// Reads the scope record at the given offset of one document, skipping everything before it.
+        /// Offsets are found through ScopeView::Offset.
+        /// </summary>
+        /// <returns>Heap allocated root of the new tree, which has no parent.</returns>
+        [[nodiscard]] ScopeUniquePointer ReadAt(std::uint64_t offset);
+
+    };
+}
+
+#include "ScopeBinaryReader.inl"
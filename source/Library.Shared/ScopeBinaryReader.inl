@@ -0,0 +1,13 @@
+#pragma once
+#include "ScopeBinaryReader.h"
+
+namespace FieaGameEngine {
+    inline ScopeBinaryReader::ScopeBinaryReader(std::istream& stream) : _stream(stream) {}
+
+    template <typename T> inline T ScopeBinaryReader::ReadValue() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value;
+        ReadBytes(&value, sizeof(T));
+        return value;
+    }
+}
@@ -0,0 +1,135 @@
+#include "pch.h"
+#include "ScopeBinaryWriter.h"
+#include "Attributed.h"
+
+using namespace std::literals::string_literals;
+
+namespace FieaGameEngine {
+    typename ScopeBinaryWriter::index_type ScopeBinaryWriter::Intern(const std::string& value, Vector<std::string>& table, HashMap<std::string, index_type>& indices) {
+        auto found = indices.Find(value);
+
+        if (found != indices.end()) {
+            return found->second;
+        }
+
+        const index_type index = ToIndex(table.Size());
+        table.PushBack(value);
+        indices.Insert(std::make_pair(value, index));
+        return index;
+    }
+
+    typename ScopeBinaryWriter::index_type ScopeBinaryWriter::ToIndex(size_type value) {
+        if (value > std::numeric_limits<index_type>::max()) {
+            throw std::length_error("Cannot write "s + std::to_string(value) + " entries, the binary format is limited to 32 bit counts!"s);
+        }
+
+        return static_cast<index_type>(value);
+    }
+
+    void ScopeBinaryWriter::Write(const Scope& root) {
+        _keys.Clear();
+        _keyIndices.Clear();
+        _classes.Clear();
+        _classIndices.Clear();
+        _body.clear();
+
+        WriteScope(root);
+
+        ScopeBinaryFormat::Header header{};
+        std::memcpy(header.magic, ScopeBinaryFormat::MAGIC, sizeof(header.magic));
+        header.version = ScopeBinaryFormat::VERSION;
+        header.keyCount = ToIndex(_keys.Size());
+        header.classCount = ToIndex(_classes.Size());
+
+        _stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        std::uint64_t offset = sizeof(header);
+
+        WriteTable(_keys);
+        WriteTable(_classes);
+
+        for (const auto& key : _keys) {
+            offset += sizeof(index_type) + key.size();
+        }
+
+        for (const auto& name : _classes) {
+            offset += sizeof(index_type) + name.size();
+        }
+
+        const char padding[ScopeBinaryFormat::PAYLOAD_ALIGNMENT]{};
+        _stream.write(padding, ScopeBinaryFormat::PaddingAt(offset));
+        _stream.write(_body.data(), _body.size());
+
+        if (!_stream) {
+            throw std::runtime_error("Failed to write the scope binary stream!"s);
+        }
+
+        _body.clear();
+    }
+
+    void ScopeBinaryWriter::WriteTable(const Vector<std::string>& table) {
+        for (const auto& value : table) {
+            const index_type length = ToIndex(value.size());
+            _stream.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            _stream.write(value.data(), value.size());
+        }
+    }
+
+    void ScopeBinaryWriter::WriteScope(const Scope& scope) {
+        // Attributed instances populate "this" themselves.
+        const size_type firstWritten = scope.Is(Attributed::TypeIdClass()) ? size_type(1) : size_type(0);
+        assert((firstWritten == size_type(0)) || (scope._array[0]->first == Scope::THIS_KEY));
+
+        const ScopeBinaryFormat::ScopeRecord record{Intern(scope.TypeNameInstance(), _classes, _classIndices), ToIndex(scope.Size() - firstWritten)};
+        AppendBytes(&record, sizeof(record));
+
+        for (auto i = firstWritten; i < scope.Size(); ++i) {
+            const auto* pair = scope._array[i];
+            WriteDatum(pair->first, pair->second);
+        }
+    }
+
+    void ScopeBinaryWriter::WriteDatum(const key_type& key, const Datum& datum) {
+        const DatumType type = datum.ActualType();
+        assert(type != DatumType::Table);
+
+        if (type == DatumType::Pointer) {
+            throw std::invalid_argument("Cannot write attribute "s + key + ", pointers have no binary form!"s);
+        }
+
+        if (type == DatumType::Handle) {
+            throw std::invalid_argument("Cannot write attribute "s + key + ", handles have no binary form!"s);
+        }
+
+        ScopeBinaryFormat::DatumRecord record{};
+        record.keyIndex = Intern(key, _keys, _keyIndices);
+        record.type = type;
+        record.count = ToIndex(datum.Size());
+
+        const std::size_t recordOffset = _body.size();
+        AppendBytes(&record, sizeof(record));
+        const std::size_t payloadOffset = _body.size();
+
+        if (ScopeBinaryFormat::IsRawType(type)) {
+            _body.append(ScopeBinaryFormat::PaddingAt(_body.size()), '\0');
+            AppendBytes(datum._data.vp, datum.Size() * datum.TypeSize());
+        } else if (type == DatumType::String) {
+            for (auto i = size_type(0); i < datum.Size(); ++i) {
+                AppendString(datum.CGetStringElement(i));
+            }
+        } else if ((type == DatumType::InternalTable) || (type == DatumType::ExternalTable)) {
+            for (auto i = size_type(0); i < datum.Size(); ++i) {
+                WriteScope(datum.CGetTableElement(i));
+            }
+        }
+
+        // The body may have been reallocated by nested scopes, so patch the size in by offset.
+        const std::uint64_t payloadSize = _body.size() - payloadOffset;
+        std::memcpy(&_body[recordOffset + offsetof(ScopeBinaryFormat::DatumRecord, payloadSize)], &payloadSize, sizeof(payloadSize));
+    }
+
+    void ScopeBinaryWriter::AppendString(const std::string& value) {
+        const index_type length = ToIndex(value.size());
+        AppendBytes(&length, sizeof(length));
+        AppendBytes(value.data(), value.size());
+    }
+}
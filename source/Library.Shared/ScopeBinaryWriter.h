@@ -0,0 +1,92 @@
+#pragma once
+#include <ostream>
+#include "ScopeBinaryFormat.h"
+#include "Scope.h"
+
+namespace FieaGameEngine {
+    /// <summary>
+    /// Writes scope trees to a stream in the layout described by ScopeBinaryFormat.
+    /// Keys and class names are interned, so each is written once per document no matter how many scopes use it.
+    /// Attributed "this" pointers are implied by the class and are not written. Any other Pointer datum cannot be written.
+    /// </summary>
+    class ScopeBinaryWriter final {
+
+    public:
+        using size_type = Scope::size_type;
+        using key_type = Scope::key_type;
+        using index_type = ScopeBinaryFormat::index_type;
+        using DatumType = Datum::DatumType;
+
+    private:
+        std::ostream& _stream;
+
+        /// <summary>
+        /// Interned keys, in order of first appearance.
+        /// </summary>
+        Vector<key_type> _keys{};
+        HashMap<key_type, index_type> _keyIndices{Scope::MAX_HASH_VAL};
+
+        /// <summary>
+        /// Interned class names, in order of first appearance.
+        /// </summary>
+        Vector<std::string> _classes{};
+        HashMap<std::string, index_type> _classIndices{Scope::MAX_HASH_VAL};
+
+        /// <summary>
+        /// The body is gathered here while the tables are filled, since the tables are written before it.
+        /// </summary>
+        std::string _body{};
+
+        /// <returns>Index of the given string within the given table, appending it if it is new.</returns>
+        [[nodiscard]] static index_type Intern(const std::string& value, Vector<std::string>& table, HashMap<std::string, index_type>& indices);
+
+        /// <returns>The given size as a stored index. Throws an exception if it does not fit.</returns>
+        [[nodiscard]] static index_type ToIndex(size_type value);
+
+        /// <summary>
+        /// Helper function which appends the given scope and all of its descendants to the body.
+        /// </summary>
+        void WriteScope(const Scope& scope);
+
+        /// <summary>
+        /// Helper function which appends the given datum and its payload to the body.
+        /// </summary>
+        void WriteDatum(const key_type& key, const Datum& datum);
+
+        /// <summary>
+        /// Helper function which appends raw bytes to the body.
+        /// </summary>
+        void AppendBytes(const void* bytes, std::size_t count);
+
+        /// <summary>
+        /// Helper function which appends a length-prefixed string to the body.
+        /// </summary>
+        void AppendString(const std::string& value);
+
+        /// <summary>
+        /// Helper function which writes a string table to the stream.
+        /// </summary>
+        void WriteTable(const Vector<std::string>& table);
+
+    public:
+        /// <summary>
+        /// Constructor. The stream should be opened in binary mode.
+        /// </summary>
+        explicit ScopeBinaryWriter(std::ostream& stream);
+
+        ScopeBinaryWriter(const ScopeBinaryWriter&) = delete;
+        ScopeBinaryWriter(ScopeBinaryWriter&&) = delete;
+        ScopeBinaryWriter& operator=(const ScopeBinaryWriter&) = delete;
+        ScopeBinaryWriter& operator=(ScopeBinaryWriter&&) = delete;
+        ~ScopeBinaryWriter() = default;
+
+        /// <summary>
+        /// Writes the given scope and all of its descendants to the stream as one document.
+        /// Throws an exception if the tree contains a Pointer datum, or if the stream fails.
+        /// </summary>
+        void Write(const Scope& root);
+
+    };
+}
+
+#include "ScopeBinaryWriter.inl"
@@ -0,0 +1,8 @@
+#pragma once
+#include "ScopeBinaryWriter.h"
+
+namespace FieaGameEngine {
+    inline ScopeBinaryWriter::ScopeBinaryWriter(std::ostream& stream) : _stream(stream) {}
+
+    inline void ScopeBinaryWriter::AppendBytes(const void* bytes, std::size_t count) { _body.append(static_cast<const char*>(bytes), count); }
+}
@@ -0,0 +1,39 @@
+#include "pch.h"
+#include "ScopeHandle.h"
+#include "Scope.h"
+
+namespace FieaGameEngine {
+    ScopeHandle ScopeHandle::Issue(Scope& scope) {
+        const std::uint64_t generation = _nextGeneration++;
+        const size_type index = _firstFree;
+
+        if (index == _slots.Size()) {
+            _slots.PushBack(Slot{&scope, generation, size_type(0)});
+            _firstFree = _slots.Size();
+        } else {
+            _firstFree = _slots[index].nextFree;
+            _slots[index] = Slot{&scope, generation, size_type(0)};
+        }
+
+        ++_liveCount;
+        return ScopeHandle{index, generation};
+    }
+
+    void ScopeHandle::Release(const ScopeHandle& handle) {
+        assert(handle.ResolveObject() != nullptr);
+
+        const auto index = static_cast<size_type>(handle._index);
+        _slots[index] = Slot{nullptr, 0, _firstFree};
+        _firstFree = index;
+
+        if (--_liveCount == size_type(0)) {
+            _slots.Clear();
+            _slots.ShrinkToFit();
+            _firstFree = size_type(0);
+        }
+    }
+
+    Scope* ScopeHandle::Resolve() const {
+        return static_cast<Scope*>(ResolveObject());
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "RTTI.h"
+#include "Vector.h"
+
+namespace FieaGameEngine {
+    // Forward declaration.
+    class Scope;
+
+    /// <summary>
+    /// Weak reference to a scope, which is small, is copied by value, and can be stored in datums.
+    /// Resolving a handle is a single lookup in a table of slots, and returns null once the scope has been destroyed,
+    /// so holders never need to search the tree, or be told, to find out whether the scope still exists.
+    /// A handle stays with the scope it was issued for, so it is not carried over by copies or moves of that scope.
+    /// Slots are not synchronized, so handles must be issued, resolved and released on one thread.
+    /// </summary>
+    class ScopeHandle final {
+
+    public:
+        using size_type = std::size_t;
+
+        // Scope issues and releases its own slot.
+        friend class Scope;
+
+    private:
+        struct Slot final {
+            RTTI* object;
+            std::uint64_t generation;
+            size_type nextFree;
+        };
+
+        /// <summary>
+        /// Slots of every scope with a handle, freed slots included. Freed once no handle is issued, so that it does not outlive its users.
+        /// </summary>
+        inline static Vector<Slot> _slots{};
+
+        /// <summary>
+        /// Index of the most recently freed slot, which is reused first, or the slot count if no slot is free.
+        /// </summary>
+        inline static size_type _firstFree{0};
+
+        inline static size_type _liveCount{0};
+
+        /// <summary>
+        /// Generation given to the next issued slot. Never reused, even once the slots are freed, so a stale handle never matches a new slot.
+        /// </summary>
+        inline static std::uint64_t _nextGeneration{1};
+
+        std::uint64_t _index{0};
+
+        /// <summary>
+        /// Generation of the slot when the handle was issued. Zero for null handles.
+        /// </summary>
+        std::uint64_t _generation{0};
+
+        ScopeHandle(std::uint64_t index, std::uint64_t generation);
+
+        /// <summary>
+        /// Gives the given scope a slot, which it must release as it is destroyed.
+        /// </summary>
+        [[nodiscard]] static ScopeHandle Issue(Scope& scope);
+
+        /// <summary>
+        /// Frees the slot of the given handle, so that every copy of it resolves to null from then on.
+        /// </summary>
+        static void Release(const ScopeHandle& handle);
+
+        /// <returns>Object the handle refers to, or null if the handle is null or stale.</returns>
+        [[nodiscard]] RTTI* ResolveObject() const;
+
+    public:
+        /// <summary>
+        /// Default constructor. The handle is null until assigned, for instance from Scope::Handle.
+        /// </summary>
+        ScopeHandle() = default;
+
+        /// <returns>Is the scope this handle was issued for still alive?</returns>
+        [[nodiscard]] bool IsValid() const;
+
+        /// <returns>Scope this handle was issued for, or null if it has been destroyed.</returns>
+        [[nodiscard]] Scope* Resolve() const;
+
+        /// <returns>Scope this handle was issued for, as the given type, or null if it has been destroyed or is not of that type.</returns>
+        template <typename T> [[nodiscard]] T* Resolve() const;
+
+        /// <returns>Were both handles issued for the same scope? Null handles are equal to each other.</returns>
+        [[nodiscard]] bool operator==(const ScopeHandle& other) const;
+        [[nodiscard]] bool operator!=(const ScopeHandle& other) const;
+
+        /// <returns>Number of scopes which currently have a handle.</returns>
+        [[nodiscard]] static size_type LiveCount();
+
+    };
+}
+
+#include "ScopeHandle.inl"
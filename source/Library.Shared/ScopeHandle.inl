@@ -0,0 +1,27 @@
+#pragma once
+#include "ScopeHandle.h"
+
+namespace FieaGameEngine {
+    inline ScopeHandle::ScopeHandle(std::uint64_t index, std::uint64_t generation) : _index{index}, _generation{generation} {}
+
+    inline RTTI* ScopeHandle::ResolveObject() const {
+        if (_index >= _slots.Size()) {
+            return nullptr;
+        }
+
+        const Slot& slot = _slots[static_cast<size_type>(_index)];
+        return (slot.generation == _generation) ? slot.object : nullptr;
+    }
+
+    inline bool ScopeHandle::IsValid() const { return ResolveObject() != nullptr; }
+
+    template <typename T> inline T* ScopeHandle::Resolve() const {
+        RTTI* object = ResolveObject();
+        return (object != nullptr) ? object->As<T>() : nullptr;
+    }
+
+    inline bool ScopeHandle::operator==(const ScopeHandle& other) const { return (_index == other._index) && (_generation == other._generation); }
+    inline bool ScopeHandle::operator!=(const ScopeHandle& other) const { return !operator==(other); }
+
+    inline typename ScopeHandle::size_type ScopeHandle::LiveCount() { return _liveCount; }
+}
@@ -0,0 +1,129 @@
+#include "pch.h"
+#include "ScopeImage.h"
+
+using namespace std::literals::string_literals;
+
+namespace FieaGameEngine {
+    ScopeImage::ScopeImage(const std::string& filename) {
+        _file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+
+        if (_file == INVALID_HANDLE_VALUE) {
+            _file = nullptr;
+            throw std::runtime_error("Cannot open "s + filename + "!"s);
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(_file, &fileSize) || (fileSize.QuadPart <= 0)) {
+            Release();
+            throw std::runtime_error("Cannot map "s + filename + ", it is empty!"s);
+        }
+
+        _mapping = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        _data = (_mapping != nullptr) ? static_cast<const std::byte*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+
+        if (_data == nullptr) {
+            Release();
+            throw std::runtime_error("Cannot map "s + filename + "!"s);
+        }
+
+        _size = static_cast<size_type>(fileSize.QuadPart);
+
+        try {
+            Parse();
+        } catch (...) {
+            Release();
+            throw;
+        }
+    }
+
+    ScopeImage::ScopeImage(const std::byte* data, size_type size) : _data(data), _size(size) {
+        if ((reinterpret_cast<std::uintptr_t>(data) % ScopeBinaryFormat::PAYLOAD_ALIGNMENT) != 0) {
+            std::size_t space = std::size_t(size) + ScopeBinaryFormat::PAYLOAD_ALIGNMENT - 1;
+            _alignedCopy = std::make_unique<std::byte[]>(space);
+
+            void* aligned = _alignedCopy.get();
+            std::align(ScopeBinaryFormat::PAYLOAD_ALIGNMENT, size, aligned, space);
+            std::memcpy(aligned, data, size);
+            _data = static_cast<const std::byte*>(aligned);
+        }
+
+        Parse();
+    }
+
+    ScopeImage::~ScopeImage() {
+        Release();
+    }
+
+    void ScopeImage::Release() {
+        if (_mapping != nullptr) {
+            if (_data != nullptr) {
+                UnmapViewOfFile(_data);
+            }
+
+            CloseHandle(_mapping);
+            _mapping = nullptr;
+        }
+
+        if (_file != nullptr) {
+            CloseHandle(_file);
+            _file = nullptr;
+        }
+
+        _alignedCopy.reset();
+        _offsetTables.Clear();
+        _data = nullptr;
+        _size = size_type(0);
+    }
+
+    void ScopeImage::Parse() {
+        const auto header = Read<ScopeBinaryFormat::Header>(0);
+
+        if (std::memcmp(header.magic, ScopeBinaryFormat::MAGIC, sizeof(header.magic)) != 0) {
+            throw std::runtime_error("Not a scope binary image!"s);
+        }
+
+        if (header.version != ScopeBinaryFormat::VERSION) {
+            throw std::runtime_error("Cannot view scope binary version "s + std::to_string(header.version) + "!"s);
+        }
+
+        std::uint64_t offset = sizeof(header);
+        auto readTable = [this, &offset](Vector<std::string_view>& table, index_type count) {
+            table.Reserve(count);
+            for (auto i = index_type(0); i < count; ++i) {
+                const auto length = Read<index_type>(offset);
+                offset += sizeof(index_type);
+                Validate(offset, length);
+                table.PushBack(std::string_view{reinterpret_cast<const char*>(_data + offset), length});
+                offset += length;
+            }
+        };
+
+        readTable(_keys, header.keyCount);
+        readTable(_classes, header.classCount);
+
+        _bodyOffset = offset + ScopeBinaryFormat::PaddingAt(offset);
+        Validate(_bodyOffset, sizeof(ScopeBinaryFormat::ScopeRecord));
+    }
+
+    void ScopeImage::Validate(std::uint64_t offset, std::uint64_t size) const {
+        if ((offset > _size) || (size > (_size - offset))) {
+            throw std::runtime_error("Scope binary image is truncated!"s);
+        }
+    }
+
+    std::string_view ScopeImage::Key(index_type index) const {
+        if (index >= _keys.Size()) {
+            throw std::runtime_error("Key index "s + std::to_string(index) + " is out of range!"s);
+        }
+
+        return _keys[index];
+    }
+
+    std::string_view ScopeImage::ClassName(index_type index) const {
+        if (index >= _classes.Size()) {
+            throw std::runtime_error("Class index "s + std::to_string(index) + " is out of range!"s);
+        }
+
+        return _classes[index];
+    }
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include <string_view>
+#include "ScopeBinaryFormat.h"
+#include "ScopeView.h"
+
+namespace FieaGameEngine {
+    /// <summary>
+    /// Read-only image of a document written by ScopeBinaryWriter, either mapped from a file or viewed in place in memory.
+    /// Nothing is copied out of the image when it is opened, besides views of its key and class tables,
+    /// and pages of a mapped file are only brought into memory as views touch them.
+    /// The image must outlive every view, bound datum and promoted scope which refers into it. Any read past the end of
+    /// the image, or of a record, throws a std::runtime_error. Indexing views fills the image's offset tables as it goes,
+    /// so an image must not be indexed from several threads at once.
+    /// </summary>
+    class ScopeImage final {
+
+    public:
+        using size_type = Datum::size_type;
+        using index_type = ScopeBinaryFormat::index_type;
+
+        // Views decode records straight out of the image.
+        friend class ScopeView;
+        friend class DatumView;
+
+    private:
+        const std::byte* _data{nullptr};
+        size_type _size{0};
+
+        /// <summary>
+        /// Handles of the mapped file, if any. Null when viewing memory owned by someone else.
+        /// </summary>
+        void* _file{nullptr};
+        void* _mapping{nullptr};
+
+        /// <summary>
+        /// Aligned copy of a document given in memory which was not aligned itself. Null when the document is viewed in place.
+        /// </summary>
+        std::unique_ptr<std::byte[]> _alignedCopy{};
+
+        /// <summary>
+        /// Offsets of the records held by a scope or table datum, keyed by the offset of the scope's or datum's own record.
+        /// Each table is built the first time its records are indexed, so opening the image still walks none of them.
+        /// </summary>
+        mutable HashMap<std::size_t, Vector<std::uint64_t>> _offsetTables{};
+
+        Vector<std::string_view> _keys{};
+        Vector<std::string_view> _classes{};
+
+        /// <summary>
+        /// Offset of the root record.
+        /// </summary>
+        std::uint64_t _bodyOffset{0};
+
+        /// <summary>
+        /// Helper function which reads the header and both tables.
+        /// </summary>
+        void Parse();
+
+        /// <summary>
+        /// Helper function which unmaps the file, if any.
+        /// </summary>
+        void Release();
+
+        /// <summary>
+        /// Throws an exception if the given range does not lie within the image.
+        /// </summary>
+        void Validate(std::uint64_t offset, std::uint64_t size) const;
+
+        /// <returns>Value stored at the given offset, which does not need to be aligned.</returns>
+        template <typename T> [[nodiscard]] T Read(std::uint64_t offset) const;
+
+        /// <summary>
+        /// Returns the offsets of the given number of consecutive records, starting at the given offset, which are held by the
+        /// record at the owner offset. Records are views of the given type, each starting where the previous one ends.
+        /// The offsets are walked once and stored, so later calls are constant time.
+        /// </summary>
+        template <typename TView> [[nodiscard]] const Vector<std::uint64_t>& OffsetTable(std::uint64_t owner, std::uint64_t first, size_type count) const;
+
+        /// <returns>Key stored at the given index of the key table.</returns>
+        [[nodiscard]] std::string_view Key(index_type index) const;
+
+        /// <returns>Class name stored at the given index of the class table.</returns>
+        [[nodiscard]] std::string_view ClassName(index_type index) const;
+
+    public:
+        /// <summary>
+        /// Constructor. Maps the given file read-only. Throws an exception if it cannot be mapped or is not a scope binary document.
+        /// </summary>
+        explicit ScopeImage(const std::string& filename);
+
+        /// <summary>
+        /// Constructor. Views a document already in memory, which must stay alive and unchanged for as long as the image.
+        /// If the document is not aligned to ScopeBinaryFormat::PAYLOAD_ALIGNMENT, it is copied into an aligned buffer owned
+        /// by the image instead, so raw payloads can always be referenced in place.
+        /// </summary>
+        ScopeImage(const std::byte* data, size_type size);
+
+        ScopeImage(const ScopeImage&) = delete;
+        ScopeImage(ScopeImage&&) = delete;
+        ScopeImage& operator=(const ScopeImage&) = delete;
+        ScopeImage& operator=(ScopeImage&&) = delete;
+        ~ScopeImage();
+
+        /// <returns>View of the root scope.</returns>
+        [[nodiscard]] ScopeView Root() const;
+
+        /// <returns>Size of the image, in bytes.</returns>
+        [[nodiscard]] size_type Size() const;
+
+        /// <returns>Start of the image.</returns>
+        [[nodiscard]] const std::byte* Data() const;
+
+    };
+}
+
+#include "ScopeImage.inl"
@@ -0,0 +1,37 @@
+#pragma once
+#include "ScopeImage.h"
+
+namespace FieaGameEngine {
+    template <typename T> inline T ScopeImage::Read(std::uint64_t offset) const {
+        static_assert(std::is_trivially_copyable_v<T>);
+        Validate(offset, sizeof(T));
+        T value;
+        std::memcpy(&value, _data + offset, sizeof(T));
+        return value;
+    }
+
+    template <typename TView> inline const Vector<std::uint64_t>& ScopeImage::OffsetTable(std::uint64_t owner, std::uint64_t first, size_type count) const {
+        const auto key = static_cast<std::size_t>(owner);
+        auto found = _offsetTables.Find(key);
+
+        if (found == _offsetTables.end()) {
+            // Walk into a local table first, so a corrupt record leaves nothing half-built behind.
+            Vector<std::uint64_t> table{};
+            table.Reserve(count);
+            std::uint64_t offset = first;
+
+            for (auto i = size_type(0); i < count; ++i) {
+                table.PushBack(offset);
+                offset = TView{*this, offset}.EndOffset();
+            }
+
+            found = _offsetTables.Insert(std::make_pair(key, std::move(table)));
+        }
+
+        return found->second;
+    }
+
+    inline ScopeView ScopeImage::Root() const { return ScopeView{*this, _bodyOffset}; }
+    inline typename ScopeImage::size_type ScopeImage::Size() const { return _size; }
+    inline const std::byte* ScopeImage::Data() const { return _data; }
+}
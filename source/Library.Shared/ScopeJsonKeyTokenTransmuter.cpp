@@ -1,9 +1,15 @@
 #include "pch.h"
 #include "ScopeJsonKeyTokenTransmuter.h"
 #include <cassert>
-#include <regex>
 
 namespace FieaGameEngine::ScopeJsonParse {
+    namespace {
+        /// <returns>Is the given character part of a word, as matched by \w?</returns>
+        bool IsWordCharacter(char c) {
+            return (std::isalnum(static_cast<unsigned char>(c)) != 0) || (c == '_');
+        }
+    }
+
     RTTI_DEFINITIONS(ScopeJsonKeyTokenTransmuter);
 
     typename ScopeJsonKeyTokenTransmuter::pair_type ScopeJsonKeyTokenTransmuter::Transmute(Wrapper& wrapper, const Json::String& key, const Json::Value& value) {
@@ -14,14 +20,36 @@ namespace FieaGameEngine::ScopeJsonParse {
             return output;
         }
 
-        std::string tokenString{key};
-        std::regex extractTokens{"\\s*(\\b[^\\s]+\\b)(.*)"};
-        std::smatch stringMatches{};
+        // Tokens are runs of non-whitespace, bounded by words as in the pattern "\s*(\b[^\s]+\b)(.*)": each one starts at a word
+        // character and ends at its run's last word character. Tokenizing stops at a run starting otherwise, or after one cut short.
+        std::string_view rest{key};
         Vector<std::string> tokens{};
 
-        while (std::regex_match(tokenString, stringMatches, extractTokens)) {
-            tokens.PushBack(stringMatches[1].str());
-            tokenString = stringMatches[2].str();
+        while (true) {
+            while (!rest.empty() && std::isspace(static_cast<unsigned char>(rest.front()))) {
+                rest.remove_prefix(1);
+            }
+
+            if (rest.empty() || !IsWordCharacter(rest.front())) {
+                break;
+            }
+
+            std::size_t runSize = 0;
+            std::size_t tokenSize = 0;
+
+            for (; (runSize < rest.size()) && !std::isspace(static_cast<unsigned char>(rest[runSize])); ++runSize) {
+                if (IsWordCharacter(rest[runSize])) {
+                    tokenSize = runSize + 1;
+                }
+            }
+
+            tokens.PushBack(std::string{rest.substr(0, tokenSize)});
+
+            if (tokenSize < runSize) {
+                break;
+            }
+
+            rest.remove_prefix(runSize);
         }
 
         assert(!tokens.IsEmpty());
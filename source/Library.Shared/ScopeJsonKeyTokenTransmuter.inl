@@ -7,7 +7,16 @@ namespace FieaGameEngine::ScopeJsonParse {
     inline std::unique_ptr<IJsonValueTransmuter> ScopeJsonKeyTokenTransmuter::Create() const { return std::make_unique<ScopeJsonKeyTokenTransmuter>(); }
 
     inline bool ScopeJsonKeyTokenTransmuter::IsAbleToTransmute(Wrapper& wrapper, const Json::String& key, const Json::Value&) {
-        const std::regex isContainingSpace{"\\s*[^\\s]+\\s+[^\\s]+.*"};
-        return wrapper.Is(ScopeParseWrapper::TypeIdClass()) && std::regex_match(key, isContainingSpace);
+        // Keys made of at least two runs of non-whitespace, as matched by the pattern "\s*[^\s]+\s+[^\s]+.*".
+        std::size_t runCount = 0;
+        bool isInRun = false;
+
+        for (const char c : key) {
+            const bool isSpace = std::isspace(static_cast<unsigned char>(c)) != 0;
+            runCount += (!isSpace && !isInRun) ? std::size_t(1) : std::size_t(0);
+            isInRun = !isSpace;
+        }
+
+        return wrapper.Is(ScopeParseWrapper::TypeIdClass()) && (runCount >= std::size_t(2));
     }
 }
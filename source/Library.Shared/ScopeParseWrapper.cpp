@@ -15,6 +15,8 @@ namespace FieaGameEngine {
         : ParseCoordinator::Wrapper{std::forward<ParseCoordinator::Wrapper>(other)}
         , _scope{std::move(other._scope)}
         , _stack{std::move(other._stack)}
+        , _resolvedClassIds{std::move(other._resolvedClassIds)}
+        , _batchedClasses{std::move(other._batchedClasses)}
     {
         other._depth = depth_type(0);
         other._scope.reset();
@@ -29,6 +31,8 @@ namespace FieaGameEngine {
             other._depth = depth_type(0);
             other._scope.reset();
             other._stack.Clear();
+            _resolvedClassIds = std::move(other._resolvedClassIds);
+            _batchedClasses = std::move(other._batchedClasses);
         }
 
         return *this;
@@ -55,7 +59,7 @@ namespace FieaGameEngine {
             if (!(frame->_name.empty())) {
                 auto found = frame->_scope->Find(frame->_name);
                 newFrameScope = ((found == frame->_scope->end()) || (found->second.Size() == arrayIndex))
-                    ? &(frame->_scope->AppendScope(frame->_name, frame->_class))
+                    ? &AppendFrameScope(*frame)
                     : &(found->second.GetTableElement(arrayIndex));
                 assert((found == frame->_scope->end()) || (found->second.Size() >= arrayIndex));
 
@@ -73,11 +77,59 @@ namespace FieaGameEngine {
         _stack.Push(StackFrame{newFrameScope, subobjectName, arrayIndex});
     }
 
+    Factory<Scope>::ClassId ScopeParseWrapper::ResolveClassId(const std::string& classname) {
+        for (const auto& resolved : _resolvedClassIds) {
+            if (resolved.first == classname) {
+                return resolved.second;
+            }
+        }
+
+        const Factory<Scope>::ClassId classId = Factory<Scope>::FindClassId(classname);
+        _resolvedClassIds.EmplaceBack(classname, classId);
+        return classId;
+    }
+
+    Scope& ScopeParseWrapper::AppendFrameScope(StackFrame& frame) {
+        for (auto& batched : _batchedClasses) {
+            if (batched._classname == frame._class) {
+                if (batched._reserve.IsEmpty()) {
+                    Factory<Scope>::StaticCreateMany(ResolveClassId(frame._class), batched._batchSize, batched._reserve);
+                }
+
+                if (batched._reserve.IsEmpty()) {
+                    break;
+                }
+
+                Scope::ScopeUniquePointer child = std::move(batched._reserve.Back());
+                batched._reserve.PopBack();
+                frame._scope->AttachAsChild(frame._name, std::move(child));
+                return frame._scope->At(frame._name).BackTable();
+            }
+        }
+
+        return frame._scope->AppendScope(frame._name, ResolveClassId(frame._class));
+    }
+
+    void ScopeParseWrapper::CreateInBatches(const std::string& classname, std::size_t batchSize) {
+        for (auto& batched : _batchedClasses) {
+            if (batched._classname == classname) {
+                batched._batchSize = batchSize;
+                return;
+            }
+        }
+
+        _batchedClasses.PushBack(BatchedClass{classname, batchSize, Vector<Scope::ScopeUniquePointer>{}});
+    }
+
     typename ScopeParseWrapper::WrapperSharedPointer ScopeParseWrapper::Create() const {
         WrapperSharedPointer clone = std::make_shared<ScopeParseWrapper>(_scope->Clone(), Coordinator());
         ScopeParseWrapper* pointer = clone->As<ScopeParseWrapper>();
         pointer->_scope->Clear();
 
+        for (const auto& batched : _batchedClasses) {
+            pointer->CreateInBatches(batched._classname, batched._batchSize);
+        }
+
         return clone;
     }
 
@@ -79,6 +79,13 @@ namespace FieaGameEngine {
         void DestroyShuntingYardParser();
         [[nodiscard]] const ShuntingYardParser& GetShuntingYardParser() const;
 
+        /// <summary>
+        /// Creates instances of the given class in batches of the given size through Factory::CreateMany, rather than one at a time.
+        /// Instances left over when a document ends are destroyed. The document's instance count is not known ahead of time, so each
+        /// document may construct and destroy up to one batch less one instance for nothing; batches should be small next to documents.
+        /// </summary>
+        void CreateInBatches(const std::string& classname, std::size_t batchSize);
+
     protected:
         virtual void HandleSubobjectNameAndIndex(const std::string& subobjectName, bool isArray, std::size_t arrayIndex) override;
 
@@ -87,6 +94,31 @@ namespace FieaGameEngine {
         Stack<StackFrame> _stack{};
         std::unique_ptr<ShuntingYardParser> _shuntingYardParser{};
 
+        /// <summary>
+        /// Class names already resolved within the current document. Documents name few classes, so a linear search is enough.
+        /// </summary>
+        Vector<std::pair<std::string, Factory<Scope>::ClassId>> _resolvedClassIds{};
+
+        /// <summary>
+        /// Class created in batches, along with the instances created but not yet appended.
+        /// </summary>
+        struct BatchedClass final {
+            std::string _classname;
+            std::size_t _batchSize;
+            Vector<Scope::ScopeUniquePointer> _reserve;
+        };
+
+        Vector<BatchedClass> _batchedClasses{};
+
+        /// <returns>Id of the class with the given name, looked up in the factory registry only the first time within a document.</returns>
+        [[nodiscard]] Factory<Scope>::ClassId ResolveClassId(const std::string& classname);
+
+        /// <summary>
+        /// Appends a new scope of the frame's class to the frame's scope, taking it from the class's batch if it is created in batches.
+        /// </summary>
+        /// <returns>Reference to the newly appended scope.</returns>
+        Scope& AppendFrameScope(StackFrame& frame);
+
         bool CreateShuntingYardParser(
             bool useDefaultConfiguration,
             std::string leftParenthesis,
@@ -20,7 +20,20 @@ namespace FieaGameEngine {
         return (key == ScopeParseWrapper::KEYWORD_TYPE) || (key == ScopeParseWrapper::KEYWORD_CLASS) || (key == ScopeParseWrapper::KEYWORD_VALUE);
     }
 
-    inline bool ScopeParseWrapper::DecrementDepth() { _stack.Pop(); return ParseCoordinator::Wrapper::DecrementDepth(); }
+    inline bool ScopeParseWrapper::DecrementDepth() {
+        _stack.Pop();
+        bool isDecremented = ParseCoordinator::Wrapper::DecrementDepth();
+
+        if (_depth == depth_type(0)) {
+            _resolvedClassIds.Clear();
+
+            for (auto& batched : _batchedClasses) {
+                batched._reserve.Clear();
+            }
+        }
+
+        return isDecremented;
+    }
 
     inline bool ScopeParseWrapper::IsEmpty() const { return _stack.IsEmpty(); }
 
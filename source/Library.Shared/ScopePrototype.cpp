@@ -0,0 +1,213 @@
+#include "pch.h"
+#include "ScopePrototype.h"
+#include "Attributed.h"
+
+using namespace std::literals::string_literals;
+
+namespace FieaGameEngine {
+    const Factory<Scope>* ScopePrototype::FindFactory(const Scope& scope) {
+        if (scope.TypeIdInstance() == Scope::TypeIdClass()) {
+            return nullptr;
+        }
+
+        const Factory<Scope>* factory = Factory<Scope>::Find(scope.TypeNameInstance());
+
+        if (factory == nullptr) {
+            throw std::logic_error("Cannot snapshot "s + scope.TypeNameInstance() + ", no factory creates it!"s);
+        }
+
+        return factory;
+    }
+
+    void ScopePrototype::Snapshot(const Scope& source) {
+        Clear();
+        Record(source, FindFactory(source));
+    }
+
+    void ScopePrototype::Clear() {
+        _nodes.Clear();
+        _entries.Clear();
+        _children.Clear();
+        _payload.Clear();
+        _strings.Clear();
+    }
+
+    typename ScopePrototype::size_type ScopePrototype::Record(const Scope& scope, const Factory<Scope>* factory) {
+        const Attributed* attributed = scope.As<Attributed>();
+        const size_type prescribedCount = (attributed != nullptr) ? attributed->PrescribedAttributeCount() : size_type(0);
+
+        // Attributed instances populate "this" themselves.
+        const size_type firstRecorded = (attributed != nullptr) ? size_type(1) : size_type(0);
+        assert((attributed == nullptr) || (scope._array[0]->first == Scope::THIS_KEY));
+
+        const size_type nodeIndex = _nodes.Size();
+        const size_type firstEntry = _entries.Size();
+        _nodes.PushBack(Node{factory, firstEntry, scope.Size() - firstRecorded, scope.Size()});
+
+        for (auto i = firstRecorded; i < scope.Size(); ++i) {
+            const auto* pair = scope._array[i];
+            const Datum& datum = pair->second;
+            const bool isPrescribed = (i < prescribedCount);
+
+            Entry entry{pair->first, Scope::KeyHashCode(pair->first), EntryKind::Internal, datum.ActualType(), datum.Size(), size_type(0)};
+            assert(entry.type != DatumType::Table);
+
+            // Auxiliary attributes with external storage are copied like internal ones, as the storage belongs to the source.
+            if ((entry.type == DatumType::InternalTable) || ((entry.type == DatumType::ExternalTable) && !isPrescribed)) {
+                entry.kind = EntryKind::InternalTable;
+                entry.type = DatumType::InternalTable;
+            } else if (datum.IsDataInternal() || !isPrescribed) {
+                entry.kind = EntryKind::Internal;
+            } else {
+                entry.kind = (entry.type == DatumType::ExternalTable) ? EntryKind::ExternalTable : EntryKind::External;
+            }
+
+            if ((entry.kind == EntryKind::InternalTable) || (entry.kind == EntryKind::ExternalTable)) {
+                // Reserve the child slots now, they are filled once the whole node has been recorded.
+                entry.first = _children.Size();
+                for (auto j = size_type(0); j < entry.count; ++j) {
+                    _children.PushBack(size_type(0));
+                }
+            } else {
+                RecordElements(entry, datum);
+            }
+
+            _entries.PushBack(std::move(entry));
+        }
+
+        const size_type entryCount = _nodes[nodeIndex].entryCount;
+        for (auto i = size_type(0); i < entryCount; ++i) {
+            const Entry& entry = _entries[firstEntry + i];
+
+            if ((entry.kind == EntryKind::InternalTable) || (entry.kind == EntryKind::ExternalTable)) {
+                const Datum& datum = scope._array[firstRecorded + i]->second;
+                const bool isInternal = (entry.kind == EntryKind::InternalTable);
+                const size_type first = entry.first;
+                const size_type count = entry.count;
+
+                for (auto j = size_type(0); j < count; ++j) {
+                    const Scope& nested = datum.CGetTableElement(j);
+                    _children[first + j] = Record(nested, isInternal ? FindFactory(nested) : nullptr);
+                }
+            }
+        }
+
+        return nodeIndex;
+    }
+
+    void ScopePrototype::RecordElements(Entry& entry, const Datum& datum) {
+        if (entry.type == DatumType::String) {
+            entry.first = _strings.Size();
+            for (auto i = size_type(0); i < entry.count; ++i) {
+                _strings.PushBack(datum.CGetStringElement(i));
+            }
+        } else {
+            entry.first = _payload.Size();
+            const size_type bytes = entry.count * datum.TypeSize();
+            for (auto i = size_type(0); i < bytes; ++i) {
+                _payload.PushBack(datum._data.bp[i]);
+            }
+        }
+    }
+
+    typename ScopePrototype::ScopeUniquePointer ScopePrototype::Instantiate() const {
+        if (IsEmpty()) {
+            throw std::logic_error("Cannot instantiate an empty prototype!"s);
+        }
+
+        return Instantiate(size_type(0));
+    }
+
+    typename ScopePrototype::ScopeUniquePointer ScopePrototype::Instantiate(size_type nodeIndex) const {
+        const Node& node = _nodes[nodeIndex];
+        ScopeUniquePointer instance = (node.factory != nullptr) ? node.factory->Create() : std::make_unique<Scope>(node.capacity);
+        Apply(nodeIndex, *instance);
+        return instance;
+    }
+
+    void ScopePrototype::Apply(size_type nodeIndex, Scope& target) const {
+        const Node& node = _nodes[nodeIndex];
+        target._array.Reserve(node.capacity);
+
+        for (auto i = node.firstEntry; i < node.firstEntry + node.entryCount; ++i) {
+            const Entry& entry = _entries[i];
+            Datum& datum = target.AppendWithHashCode(entry.key, entry.keyHashCode);
+
+            switch (entry.kind) {
+
+            case EntryKind::Internal:
+                if (!datum.IsEmpty()) {
+                    datum.Clear();
+                }
+
+                if (entry.type != DatumType::Unknown) {
+                    datum.SetType(entry.type);
+                }
+
+                if (entry.count > size_type(0)) {
+                    datum.Reserve(entry.count);
+
+                    if (entry.type == DatumType::String) {
+                        for (auto j = size_type(0); j < entry.count; ++j) {
+                            datum.PushBack(_strings[entry.first + j]);
+                        }
+                    } else {
+                        CopyElements(entry, datum._data.vp);
+                        datum._size = entry.count;
+                        datum.MarkContentChanged();
+                    }
+                }
+                break;
+
+            case EntryKind::External:
+                if (datum.IsDataInternal() || (datum.ActualType() != entry.type) || (datum.Size() != entry.count)) {
+                    throw std::logic_error("Attribute "s + entry.key + " of "s + target.TypeNameInstance() + " does not match the prototype!"s);
+                }
+
+                if (!datum.IsDataExternalConst()) {
+                    if (entry.type == DatumType::String) {
+                        for (auto j = size_type(0); j < entry.count; ++j) {
+                            datum._data.s[j] = _strings[entry.first + j];
+                        }
+                    } else {
+                        CopyElements(entry, datum._data.vp);
+                    }
+
+                    datum.MarkContentChanged();
+                }
+                break;
+
+            case EntryKind::InternalTable:
+                datum.SetType(DatumType::InternalTable);
+                datum.Reserve(datum.Size() + entry.count);
+                for (auto j = size_type(0); j < entry.count; ++j) {
+                    datum.PushBack(Instantiate(_children[entry.first + j]));
+                }
+                break;
+
+            case EntryKind::ExternalTable:
+                if ((datum.ActualType() != DatumType::ExternalTable) || (datum.Size() != entry.count)) {
+                    throw std::logic_error("Attribute "s + entry.key + " of "s + target.TypeNameInstance() + " does not match the prototype!"s);
+                }
+
+                for (auto j = size_type(0); j < entry.count; ++j) {
+                    Apply(_children[entry.first + j], datum.GetTableElement(j));
+                }
+                break;
+
+            default:
+                assert(false);
+
+            }
+        }
+    }
+
+    void ScopePrototype::CopyElements(const Entry& entry, void* destination) const {
+        assert(entry.type != DatumType::String);
+        const size_type bytes = entry.count * Datum::TYPE_SIZES[static_cast<int>(entry.type)];
+
+        if (bytes > size_type(0)) {
+            std::memcpy(destination, &_payload[entry.first], bytes);
+        }
+    }
+}
@@ -0,0 +1,159 @@
+#pragma once
+#include "Scope.h"
+#include "Factory.h"
+
+namespace FieaGameEngine {
+    /// <summary>
+    /// Snapshot of a scope tree which can be instantiated many times over without walking the source.
+    /// The tree is flattened into index-linked nodes and entries, so the snapshot holds no pointers into the source
+    /// and stays valid if the source is modified or destroyed. Auxiliary attributes with external storage are therefore copied,
+    /// and are instantiated with internal storage, or as nested scopes for external tables. Keys are stored with their hash codes precomputed,
+    /// and the elements of every trivially copyable datum are packed into one payload buffer which is copied into
+    /// each instance with memcpy. Scope-derived classes are recreated through the factory found when the snapshot was taken,
+    /// so those factories must remain registered for as long as the prototype is used.
+    /// </summary>
+    class ScopePrototype final {
+
+    public:
+        using size_type = Scope::size_type;
+        using key_type = Scope::key_type;
+        using DatumType = Datum::DatumType;
+        using ScopeUniquePointer = Scope::ScopeUniquePointer;
+
+    private:
+        /// <summary>
+        /// How an entry's elements are reproduced within an instance.
+        /// </summary>
+        enum class EntryKind : std::uint8_t {
+            Internal,
+            External,
+            InternalTable,
+            ExternalTable
+        };
+
+        /// <summary>
+        /// A single datum of a recorded scope.
+        /// For Internal and External entries, `first` is the offset into the payload (or into the strings if the type is String).
+        /// For table entries, `first` is the index of the entry's first child node index.
+        /// </summary>
+        struct Entry final {
+            key_type key;
+            size_type keyHashCode;
+            EntryKind kind;
+            DatumType type;
+            size_type count;
+            size_type first;
+        };
+
+        /// <summary>
+        /// A single recorded scope. Its entries are contiguous, in the scope's order.
+        /// </summary>
+        struct Node final {
+            const Factory<Scope>* factory;
+            size_type firstEntry;
+            size_type entryCount;
+            size_type capacity;
+        };
+
+        /// <summary>
+        /// Recorded scopes. The root is always the first node.
+        /// </summary>
+        Vector<Node> _nodes{};
+
+        /// <summary>
+        /// Recorded datums of every node.
+        /// </summary>
+        Vector<Entry> _entries{};
+
+        /// <summary>
+        /// Node indices of nested scopes, referenced by table entries.
+        /// </summary>
+        Vector<size_type> _children{};
+
+        /// <summary>
+        /// Raw elements of every trivially copyable datum.
+        /// </summary>
+        Vector<std::byte> _payload{};
+
+        /// <summary>
+        /// Elements of every String datum.
+        /// </summary>
+        Vector<Datum::String> _strings{};
+
+        /// <returns>The factory creating instances of the given scope's class, or nullptr if the scope is a plain Scope.</returns>
+        [[nodiscard]] static const Factory<Scope>* FindFactory(const Scope& scope);
+
+        /// <summary>
+        /// Helper function which records the given scope and all of its descendants.
+        /// </summary>
+        /// <returns>Index of the node recorded for the given scope.</returns>
+        size_type Record(const Scope& scope, const Factory<Scope>* factory);
+
+        /// <summary>
+        /// Helper function which records the elements of the given non-table datum.
+        /// </summary>
+        void RecordElements(Entry& entry, const Datum& datum);
+
+        /// <summary>
+        /// Helper function which creates a scope from the given node.
+        /// </summary>
+        [[nodiscard]] ScopeUniquePointer Instantiate(size_type nodeIndex) const;
+
+        /// <summary>
+        /// Helper function which reproduces the entries of the given node within the given scope.
+        /// </summary>
+        void Apply(size_type nodeIndex, Scope& target) const;
+
+        /// <summary>
+        /// Helper function which copies the recorded elements of the given entry into the given storage.
+        /// </summary>
+        void CopyElements(const Entry& entry, void* destination) const;
+
+    public:
+        /// <summary>
+        /// Default constructor. The prototype is empty until a scope is snapshot.
+        /// </summary>
+        ScopePrototype() = default;
+
+        /// <summary>
+        /// Constructor. Takes a snapshot of the given scope.
+        /// </summary>
+        explicit ScopePrototype(const Scope& source);
+
+        ScopePrototype(const ScopePrototype&) = default;
+        ScopePrototype(ScopePrototype&&) noexcept = default;
+        ScopePrototype& operator=(const ScopePrototype&) = default;
+        ScopePrototype& operator=(ScopePrototype&&) noexcept = default;
+        ~ScopePrototype() = default;
+
+        /// <summary>
+        /// Replaces the contents of the prototype with a snapshot of the given scope and all of its descendants.
+        /// Throws an exception if the tree contains a Scope-derived class with no registered factory.
+        /// </summary>
+        void Snapshot(const Scope& source);
+
+        /// <summary>
+        /// Creates a new tree equivalent to the snapshot. State that is not exposed through attributes is left as the
+        /// factory constructed it, as are prescribed attributes with constant storage.
+        /// </summary>
+        /// <returns>Heap allocated root of the new tree, which has no parent.</returns>
+        [[nodiscard]] ScopeUniquePointer Instantiate() const;
+
+        /// <returns>Number of scopes recorded.</returns>
+        [[nodiscard]] size_type NodeCount() const;
+
+        /// <returns>Number of bytes of trivially copyable elements recorded.</returns>
+        [[nodiscard]] size_type PayloadSize() const;
+
+        /// <returns>Has nothing been snapshot?</returns>
+        [[nodiscard]] bool IsEmpty() const;
+
+        /// <summary>
+        /// Empties the prototype.
+        /// </summary>
+        void Clear();
+
+    };
+}
+
+#include "ScopePrototype.inl"
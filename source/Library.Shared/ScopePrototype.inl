@@ -0,0 +1,10 @@
+#pragma once
+#include "ScopePrototype.h"
+
+namespace FieaGameEngine {
+    inline ScopePrototype::ScopePrototype(const Scope& source) { Snapshot(source); }
+
+    inline typename ScopePrototype::size_type ScopePrototype::NodeCount() const { return _nodes.Size(); }
+    inline typename ScopePrototype::size_type ScopePrototype::PayloadSize() const { return _payload.Size(); }
+    inline bool ScopePrototype::IsEmpty() const { return _nodes.IsEmpty(); }
+}
@@ -0,0 +1,189 @@
+#include "pch.h"
+#include "ScopeView.h"
+#include "ScopeImage.h"
+#include "ScopeBinaryReader.h"
+
+using namespace std::literals::string_literals;
+
+namespace FieaGameEngine {
+    namespace {
+        /// <summary>
+        /// Stream buffer reading straight out of an image, so promotion can reuse the binary reader without copying the image.
+        /// </summary>
+        class ImageStreamBuffer final : public std::streambuf {
+
+        public:
+            ImageStreamBuffer(const std::byte* data, std::size_t size) {
+                char* begin = const_cast<char*>(reinterpret_cast<const char*>(data));
+                setg(begin, begin, begin + size);
+            }
+
+        };
+    }
+
+    std::string_view ScopeView::ClassName() const {
+        return _image->ClassName(_image->Read<ScopeBinaryFormat::ScopeRecord>(_offset).classIndex);
+    }
+
+    typename ScopeView::size_type ScopeView::Size() const {
+        return _image->Read<ScopeBinaryFormat::ScopeRecord>(_offset).datumCount;
+    }
+
+    DatumView ScopeView::At(size_type index) const {
+        if (index >= Size()) {
+            throw std::out_of_range("Index out of range, cannot view datum."s);
+        }
+
+        const auto& offsets = _image->OffsetTable<DatumView>(_offset, _offset + sizeof(ScopeBinaryFormat::ScopeRecord), Size());
+        return DatumView{*_image, offsets[index]};
+    }
+
+    bool ScopeView::TryFind(std::string_view key, DatumView& found) const {
+        const size_type size = Size();
+        std::uint64_t offset = _offset + sizeof(ScopeBinaryFormat::ScopeRecord);
+
+        for (auto i = size_type(0); i < size; ++i) {
+            DatumView datum{*_image, offset};
+
+            if (datum.Key() == key) {
+                found = datum;
+                return true;
+            }
+
+            offset = datum.EndOffset();
+        }
+
+        return false;
+    }
+
+    void ScopeView::ForEachDatum(const DatumViewFunctor& functor) const {
+        const size_type size = Size();
+        std::uint64_t offset = _offset + sizeof(ScopeBinaryFormat::ScopeRecord);
+
+        for (auto i = size_type(0); i < size; ++i) {
+            DatumView datum{*_image, offset};
+            functor(datum);
+            offset = datum.EndOffset();
+        }
+    }
+
+    std::uint64_t ScopeView::EndOffset() const {
+        const size_type size = Size();
+        std::uint64_t offset = _offset + sizeof(ScopeBinaryFormat::ScopeRecord);
+
+        for (auto i = size_type(0); i < size; ++i) {
+            offset = DatumView{*_image, offset}.EndOffset();
+        }
+
+        return offset;
+    }
+
+    typename ScopeView::ScopeUniquePointer ScopeView::Promote() const {
+        ImageStreamBuffer buffer{_image->Data(), _image->Size()};
+        std::istream stream{&buffer};
+        return ScopeBinaryReader{stream}.ReadAt(_offset);
+    }
+
+    DatumView::DatumView(const ScopeImage& image, std::uint64_t offset) : _image(&image), _offset(offset), _record(image.Read<ScopeBinaryFormat::DatumRecord>(offset)) {
+        _image->Validate(PayloadOffset(), _record.payloadSize);
+
+        if (ScopeBinaryFormat::IsRawType(_record.type)) {
+            const std::uint64_t rawSize = std::uint64_t(_record.count) * ScopeBinaryFormat::RawTypeSize(_record.type);
+
+            if ((RawOffset() + rawSize) > EndOffset()) {
+                throw std::runtime_error("Attribute "s + std::string{Key()} + " has a corrupt payload!"s);
+            }
+        }
+    }
+
+    std::string_view DatumView::Key() const {
+        return _image->Key(_record.keyIndex);
+    }
+
+    void DatumView::ValidateElement(DatumType type, size_type index) const {
+        if (_record.type != type) {
+            throw std::invalid_argument("Datum is not "s + ToStringDatumType(type) + " type."s);
+        }
+
+        if (index >= _record.count) {
+            throw std::out_of_range("Index out of range, cannot view "s + ToStringDatumType(type) + " element."s);
+        }
+    }
+
+    template <typename T> const T& DatumView::GetRawElement(DatumType type, size_type index) const {
+        ValidateElement(type, index);
+        return *reinterpret_cast<const T*>(_image->Data() + RawOffset() + (index * sizeof(T)));
+    }
+
+    const Datum::Integer& DatumView::GetIntegerElement(size_type index) const { return GetRawElement<Datum::Integer>(DatumType::Integer, index); }
+    const Datum::Float& DatumView::GetFloatElement(size_type index) const { return GetRawElement<Datum::Float>(DatumType::Float, index); }
+    const Datum::Vector& DatumView::GetVectorElement(size_type index) const { return GetRawElement<Datum::Vector>(DatumType::Vector, index); }
+    const Datum::Matrix& DatumView::GetMatrixElement(size_type index) const { return GetRawElement<Datum::Matrix>(DatumType::Matrix, index); }
+
+    std::string_view DatumView::GetStringElement(size_type index) const {
+        ValidateElement(DatumType::String, index);
+        std::uint64_t offset = PayloadOffset();
+
+        for (auto i = size_type(0); i < index; ++i) {
+            offset += sizeof(ScopeBinaryFormat::index_type) + _image->Read<ScopeBinaryFormat::index_type>(offset);
+        }
+
+        const auto length = _image->Read<ScopeBinaryFormat::index_type>(offset);
+        offset += sizeof(ScopeBinaryFormat::index_type);
+        _image->Validate(offset, length);
+        return std::string_view{reinterpret_cast<const char*>(_image->Data() + offset), length};
+    }
+
+    ScopeView DatumView::GetTableElement(size_type index) const {
+        if ((_record.type != DatumType::InternalTable) && (_record.type != DatumType::ExternalTable)) {
+            throw std::invalid_argument("Datum is not "s + ToStringDatumType(DatumType::Table) + " type."s);
+        }
+
+        if (index >= _record.count) {
+            throw std::out_of_range("Index out of range, cannot view "s + ToStringDatumType(DatumType::Table) + " element."s);
+        }
+
+        const auto& offsets = _image->OffsetTable<ScopeView>(_offset, PayloadOffset(), _record.count);
+        return ScopeView{*_image, offsets[index]};
+    }
+
+    void DatumView::ForEachTableElement(const ScopeViewFunctor& functor) const {
+        if ((_record.type != DatumType::InternalTable) && (_record.type != DatumType::ExternalTable)) {
+            throw std::invalid_argument("Datum is not "s + ToStringDatumType(DatumType::Table) + " type."s);
+        }
+
+        std::uint64_t offset = PayloadOffset();
+        for (auto i = size_type(0); i < _record.count; ++i) {
+            ScopeView nested{*_image, offset};
+            functor(nested);
+            offset = nested.EndOffset();
+        }
+    }
+
+    void DatumView::Bind(Datum& datum) const {
+        void* elements = const_cast<std::byte*>(_image->Data() + RawOffset());
+
+        switch (_record.type) {
+
+        case DatumType::Integer:
+            datum.SetStorage(static_cast<Datum::Integer*>(elements), _record.count, true);
+            break;
+
+        case DatumType::Float:
+            datum.SetStorage(static_cast<Datum::Float*>(elements), _record.count, true);
+            break;
+
+        case DatumType::Vector:
+            datum.SetStorage(static_cast<Datum::Vector*>(elements), _record.count, true);
+            break;
+
+        case DatumType::Matrix:
+            datum.SetStorage(static_cast<Datum::Matrix*>(elements), _record.count, true);
+            break;
+
+        default:
+            throw std::invalid_argument("Cannot bind "s + std::string{Key()} + ", only numeric datums can point into an image!"s);
+
+        }
+    }
+}
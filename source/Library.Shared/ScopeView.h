@@ -0,0 +1,151 @@
+#pragma once
+#include <string_view>
+#include "ScopeBinaryFormat.h"
+#include "Scope.h"
+
+namespace FieaGameEngine {
+    class ScopeImage;
+    class DatumView;
+
+    /// <summary>
+    /// Read-only view of a scope stored in a ScopeImage. Views are small, are copied by value, and allocate nothing.
+    /// Datums are indexed through an offset table the image builds the first time the scope is indexed, so At is constant
+    /// time from then on. Lookups by key walk the scope's records in order, so they are linear in the number of datums.
+    /// </summary>
+    class ScopeView final {
+
+    public:
+        using size_type = Scope::size_type;
+        using ScopeUniquePointer = Scope::ScopeUniquePointer;
+        using DatumViewFunctor = std::function<void(const DatumView&)>;
+
+        friend class ScopeImage;
+        friend class DatumView;
+
+    private:
+        const ScopeImage* _image;
+
+        /// <summary>
+        /// Offset of the scope's record within the image.
+        /// </summary>
+        std::uint64_t _offset;
+
+        ScopeView(const ScopeImage& image, std::uint64_t offset);
+
+        /// <returns>Offset just past the scope's last datum.</returns>
+        [[nodiscard]] std::uint64_t EndOffset() const;
+
+    public:
+        /// <returns>Name of the class the scope was written as.</returns>
+        [[nodiscard]] std::string_view ClassName() const;
+
+        /// <returns>Number of datums stored. Attributed "this" pointers are not stored.</returns>
+        [[nodiscard]] size_type Size() const;
+
+        /// <returns>View of the datum stored at the given index. Throws an exception if the index is out of range.</returns>
+        [[nodiscard]] DatumView At(size_type index) const;
+
+        /// <summary>
+        /// Finds the datum stored with the given key.
+        /// </summary>
+        /// <returns>Was the datum found? If so, it is assigned to the output parameter.</returns>
+        [[nodiscard]] bool TryFind(std::string_view key, DatumView& found) const;
+
+        /// <summary>
+        /// Calls the given functor with a view of every datum stored, in order, walking the records only once.
+        /// </summary>
+        void ForEachDatum(const DatumViewFunctor& functor) const;
+
+        /// <returns>Offset of the scope's record within the image, as accepted by ScopeBinaryReader::ReadAt.</returns>
+        [[nodiscard]] std::uint64_t Offset() const;
+
+        /// <summary>
+        /// Creates a mutable copy of the viewed scope and all of its descendants, which does not refer into the image.
+        /// Scope-derived classes must have a registered factory.
+        /// </summary>
+        /// <returns>Heap allocated root of the new tree, which has no parent.</returns>
+        [[nodiscard]] ScopeUniquePointer Promote() const;
+
+    };
+
+    /// <summary>
+    /// Read-only view of a datum stored in a ScopeImage. Elements are returned by reference straight out of the image.
+    /// String elements are found by walking the payload in order, so their lookups are linear in the index.
+    /// Table elements are indexed through an offset table, like the datums of a ScopeView.
+    /// </summary>
+    class DatumView final {
+
+    public:
+        using size_type = Datum::size_type;
+        using DatumType = Datum::DatumType;
+        using ScopeViewFunctor = std::function<void(const ScopeView&)>;
+
+        friend class ScopeImage;
+        friend class ScopeView;
+
+    private:
+        const ScopeImage* _image{nullptr};
+
+        /// <summary>
+        /// Offset of the datum's record within the image.
+        /// </summary>
+        std::uint64_t _offset{0};
+
+        ScopeBinaryFormat::DatumRecord _record{};
+
+        DatumView(const ScopeImage& image, std::uint64_t offset);
+
+        /// <returns>Offset of the first byte of the payload.</returns>
+        [[nodiscard]] std::uint64_t PayloadOffset() const;
+
+        /// <returns>Offset just past the payload, which is where the next datum starts.</returns>
+        [[nodiscard]] std::uint64_t EndOffset() const;
+
+        /// <returns>Offset of the first raw element.</returns>
+        [[nodiscard]] std::uint64_t RawOffset() const;
+
+        /// <summary>
+        /// Throws an exception if the datum is not of the given type, or if the index is out of range.
+        /// </summary>
+        void ValidateElement(DatumType type, size_type index) const;
+
+        /// <returns>Raw element at the given index, after validating it is of the given type.</returns>
+        template <typename T> [[nodiscard]] const T& GetRawElement(DatumType type, size_type index) const;
+
+    public:
+        /// <summary>
+        /// Default constructor. The view refers to nothing until it is assigned, for instance by ScopeView::TryFind.
+        /// </summary>
+        DatumView() = default;
+
+        /// <returns>Key the datum is stored with.</returns>
+        [[nodiscard]] std::string_view Key() const;
+
+        /// <returns>Type the datum was written as.</returns>
+        [[nodiscard]] DatumType Type() const;
+
+        /// <returns>Number of elements stored.</returns>
+        [[nodiscard]] size_type Size() const;
+
+        [[nodiscard]] const Datum::Integer& GetIntegerElement(size_type index = size_type(0)) const;
+        [[nodiscard]] const Datum::Float& GetFloatElement(size_type index = size_type(0)) const;
+        [[nodiscard]] const Datum::Vector& GetVectorElement(size_type index = size_type(0)) const;
+        [[nodiscard]] const Datum::Matrix& GetMatrixElement(size_type index = size_type(0)) const;
+        [[nodiscard]] std::string_view GetStringElement(size_type index = size_type(0)) const;
+        [[nodiscard]] ScopeView GetTableElement(size_type index = size_type(0)) const;
+
+        /// <summary>
+        /// Calls the given functor with a view of every table element, in order, walking the payload only once.
+        /// </summary>
+        void ForEachTableElement(const ScopeViewFunctor& functor) const;
+
+        /// <summary>
+        /// Points the given datum's storage at the elements within the image, as constant external storage. Nothing is copied.
+        /// Only Integer, Float, Vector and Matrix datums can be bound.
+        /// </summary>
+        void Bind(Datum& datum) const;
+
+    };
+}
+
+#include "ScopeView.inl"
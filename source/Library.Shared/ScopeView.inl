@@ -0,0 +1,15 @@
+#pragma once
+#include "ScopeView.h"
+
+namespace FieaGameEngine {
+    inline ScopeView::ScopeView(const ScopeImage& image, std::uint64_t offset) : _image(&image), _offset(offset) {}
+
+    inline std::uint64_t ScopeView::Offset() const { return _offset; }
+
+    inline typename DatumView::DatumType DatumView::Type() const { return _record.type; }
+    inline typename DatumView::size_type DatumView::Size() const { return _record.count; }
+
+    inline std::uint64_t DatumView::PayloadOffset() const { return _offset + sizeof(ScopeBinaryFormat::DatumRecord); }
+    inline std::uint64_t DatumView::EndOffset() const { return PayloadOffset() + _record.payloadSize; }
+    inline std::uint64_t DatumView::RawOffset() const { return PayloadOffset() + ScopeBinaryFormat::PaddingAt(PayloadOffset()); }
+}
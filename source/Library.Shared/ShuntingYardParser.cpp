@@ -1,7 +1,7 @@
 #include "pch.h"
 #include "ShuntingYardParser.h"
-#include <regex>
 #include <sstream>
+#include "ExpressionLexer.h"
 #include "Stack.h"
 
 using namespace std::literals::string_literals;
@@ -68,28 +68,24 @@ namespace FieaGameEngine {
     std::string ShuntingYardParser::Parse(const std::string& expression) const {
         std::stringstream output{};
         bool isOutputNotEmpty = false;
-        std::string input = AddSpacesToSpecialCharacters(expression);
-        std::regex extractTokens{"\\s*([^\\s]+)(.*)"};
-        std::smatch stringMatches{};
+        ExpressionLexer lexer{expression, {_leftParenthesis, _rightParenthesis, _comma}};
+        ExpressionLexer::Token token{};
         Stack<std::string> operatorStack{};
 
-        while (std::regex_match(input, stringMatches, extractTokens)) {
-            std::string token = stringMatches[1].str();
-            input = stringMatches[2].str();
-
-            if (token == _comma) {
+        while (lexer.Next(token)) {
+            if (token.text == _comma) {
                 if (*(operatorStack.CTop()) != _leftParenthesis) {
                     throw std::logic_error("Cannot parse \""s + _comma + "\" when not within a \""s + _leftParenthesis + _rightParenthesis + "\" block!"s);
                 }
                 continue;
             }
 
-            if (token == _leftParenthesis) {
-                operatorStack.Push(token);
+            if (token.text == _leftParenthesis) {
+                operatorStack.Push(_leftParenthesis);
                 continue;
             }
 
-            if (token == _rightParenthesis) {
+            if (token.text == _rightParenthesis) {
                 while (!(operatorStack.IsEmpty()) && (*(operatorStack.CTop()) != _leftParenthesis)) {
                     output << ' ' << *(operatorStack.CTop());
                     operatorStack.Pop();
@@ -99,12 +95,12 @@ namespace FieaGameEngine {
                 continue;
             }
 
-            auto found = _operators.CFind(token);
+            auto found = _operators.CFind(std::string{token.text});
             if (found == _operators.cend()) {
                 if (isOutputNotEmpty) {
                     output << ' ';
                 }
-                output << token;
+                output << token.text;
                 isOutputNotEmpty = true;
             } else {
                 if (!operatorStack.IsEmpty()) {
@@ -126,7 +122,7 @@ namespace FieaGameEngine {
                     }
                 }
 
-                operatorStack.Push(token);
+                operatorStack.Push(found->first);
             }
         }
 
@@ -137,42 +133,4 @@ namespace FieaGameEngine {
 
         return output.str();
     }
-
-    std::string ShuntingYardParser::AddSpacesToSpecialCharacters(const std::string& expression) const {
-        using str_size_type = std::string::size_type;
-
-        std::string result{expression};
-
-        auto index = str_size_type(0);
-        auto leftParenthesisReplace = " "s + _leftParenthesis + " "s;
-        auto rightParenthesisReplace = " "s + _rightParenthesis + " "s;
-        auto commaReplace = " "s + _comma + " "s;
-        auto leftParenthesisSize = _leftParenthesis.size();
-        auto rightParenthesisSize = _rightParenthesis.size();
-        auto commaSize = _comma.size();
-        auto leftParenthesisOffset = leftParenthesisReplace.size();
-        auto rightParenthesisOffset = rightParenthesisReplace.size();
-        auto commaOffset = commaReplace.size();
-
-        while ((index = result.find_first_of(_leftParenthesis, index)) < result.size()) {
-            result.replace(index, leftParenthesisSize, leftParenthesisReplace);
-            index += leftParenthesisOffset;
-        }
-
-        index = std::string::size_type(0);
-
-        while ((index = result.find_first_of(_rightParenthesis, index)) < result.size()) {
-            result.replace(index, rightParenthesisSize, rightParenthesisReplace);
-            index += rightParenthesisOffset;
-        }
-
-        index = std::string::size_type(0);
-
-        while ((index = result.find_first_of(_comma, index)) < result.size()) {
-            result.replace(index, commaSize, commaReplace);
-            index += commaOffset;
-        }
-
-        return result;
-    }
 }
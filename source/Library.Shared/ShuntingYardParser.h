@@ -72,8 +72,6 @@ namespace FieaGameEngine {
         std::string _rightParenthesis{};
         std::string _comma{};
 
-        std::string AddSpacesToSpecialCharacters(const std::string& rawExpression) const;
-
     };
 }
 
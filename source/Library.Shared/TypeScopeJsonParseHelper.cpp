@@ -38,6 +38,7 @@ namespace FieaGameEngine::ScopeJsonParse {
         case Datum::DatumType::InternalTable:
         case Datum::DatumType::ExternalTable:
         case Datum::DatumType::Pointer:
+        case Datum::DatumType::Handle:
             throw std::logic_error("Datum type "s + str + " cannot be used to deserialize. Did you mean to put \""s + ScopeParseWrapper::TYPE_OBJECT + "\"?"s);
 
         default: